@@ -37,6 +37,8 @@
 #include "driver_stcc4_basic.h"
 
 static stcc4_handle_t gs_handle;        /**< stcc4 handle */
+static stcc4_cache_t gs_cache;          /**< stcc4 read cache */
+static uint8_t gs_cache_enable;         /**< read cache enable flag */
 
 /**
  * @brief     basic example init
@@ -50,6 +52,9 @@ uint8_t stcc4_basic_init(stcc4_address_t address)
 {
     uint8_t res;
     
+    /* the cache starts disabled */
+    gs_cache_enable = 0;
+    
     /* link functions */
     DRIVER_STCC4_LINK_INIT(&gs_handle, stcc4_handle_t);
     DRIVER_STCC4_LINK_IIC_INIT(&gs_handle, stcc4_interface_iic_init);
@@ -108,6 +113,12 @@ uint8_t stcc4_basic_read(int16_t *co2_ppm, float *temperature, float *humidity)
     uint16_t humidity_raw;
     uint16_t sensor_status;
     
+    /* serve it from the cache */
+    if (gs_cache_enable != 0)
+    {
+        return stcc4_cache_read(&gs_cache, co2_ppm, temperature, humidity);
+    }
+    
     /* read data */
     res = stcc4_read(&gs_handle, &co2_raw, co2_ppm,
                      &temperature_raw, temperature,
@@ -120,6 +131,59 @@ uint8_t stcc4_basic_read(int16_t *co2_ppm, float *temperature, float *humidity)
     return 0;
 }
 
+/**
+ * @brief     basic example set the read cache
+ * @param[in] ttl_ms frame time to live in ms, 0 disables the cache
+ * @param[in] *lock pointer to a lock function address, NULL for one caller
+ * @param[in] *unlock pointer to an unlock function address, NULL for one caller
+ * @return    status code
+ *            - 0 success
+ *            - 1 set cache failed
+ * @note      call it after stcc4_basic_init, the counters restart from 0
+ */
+uint8_t stcc4_basic_set_cache(uint32_t ttl_ms, void (*lock)(void), void (*unlock)(void))
+{
+    /* disable */
+    gs_cache_enable = 0;
+    if (ttl_ms == 0)
+    {
+        return 0;
+    }
+    
+    /* cache init */
+    if (stcc4_cache_init(&gs_cache, &gs_handle, ttl_ms, stcc4_interface_timestamp_us, lock, unlock) != 0)
+    {
+        return 1;
+    }
+    gs_cache_enable = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief      basic example get the read cache counters
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get cache stats failed
+ * @note       the cache must be enabled
+ */
+uint8_t stcc4_basic_get_cache_stats(stcc4_cache_stats_t *stats)
+{
+    if (gs_cache_enable == 0)
+    {
+        return 1;
+    }
+    
+    /* get stats */
+    if (stcc4_cache_get_stats(&gs_cache, stats) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -129,6 +193,9 @@ uint8_t stcc4_basic_read(int16_t *co2_ppm, float *temperature, float *humidity)
  */
 uint8_t stcc4_basic_deinit(void)
 {
+    /* disable the cache */
+    gs_cache_enable = 0;
+    
     /* stop */
     if (stcc4_stop_continuous_measurement(&gs_handle) != 0)
     {
@@ -178,6 +245,10 @@ uint8_t stcc4_basic_wake_up(void)
     {
         return 1;
     }
+    if (gs_cache_enable != 0)
+    {
+        (void)stcc4_cache_invalidate(&gs_cache);
+    }
     
     return 0;
 }
@@ -196,6 +267,10 @@ uint8_t stcc4_basic_power_down(void)
     {
         return 1;
     }
+    if (gs_cache_enable != 0)
+    {
+        (void)stcc4_cache_invalidate(&gs_cache);
+    }
     
     return 0;
 }
@@ -37,7 +37,7 @@
 #ifndef DRIVER_STCC4_BASIC_H
 #define DRIVER_STCC4_BASIC_H
 
-#include "driver_stcc4_interface.h"
+#include "driver_stcc4_cache.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -81,6 +81,28 @@ uint8_t stcc4_basic_deinit(void);
  */
 uint8_t stcc4_basic_read(int16_t *co2_ppm, float *temperature, float *humidity);
 
+/**
+ * @brief     basic example set the read cache
+ * @param[in] ttl_ms frame time to live in ms, 0 disables the cache
+ * @param[in] *lock pointer to a lock function address, NULL for one caller
+ * @param[in] *unlock pointer to an unlock function address, NULL for one caller
+ * @return    status code
+ *            - 0 success
+ *            - 1 set cache failed
+ * @note      call it after stcc4_basic_init, the counters restart from 0
+ */
+uint8_t stcc4_basic_set_cache(uint32_t ttl_ms, void (*lock)(void), void (*unlock)(void));
+
+/**
+ * @brief      basic example get the read cache counters
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get cache stats failed
+ * @note       the cache must be enabled
+ */
+uint8_t stcc4_basic_get_cache_stats(stcc4_cache_stats_t *stats);
+
 /**
  * @brief      basic example get product id
  * @param[out] *product_id pointer to a product id buffer
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_cache.c
+ * @brief     driver stcc4 cache source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_cache.h"
+
+/**
+ * @brief     cache example init
+ * @param[in] *cache pointer to a cache structure
+ * @param[in] *handle pointer to a stcc4 handle in continuous mode
+ * @param[in] ttl_ms frame time to live in ms
+ * @param[in] *timestamp_us pointer to a monotonic timestamp_us function address
+ * @param[in] *lock pointer to a lock function address, NULL for one caller
+ * @param[in] *unlock pointer to an unlock function address, NULL for one caller
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the sensor updates once a second in continuous mode, so a ttl up to 1000ms never hides a new sample for long
+ */
+uint8_t stcc4_cache_init(stcc4_cache_t *cache, stcc4_handle_t *handle, uint32_t ttl_ms,
+                         uint32_t (*timestamp_us)(void), void (*lock)(void), void (*unlock)(void))
+{
+    if ((cache == NULL) || (handle == NULL) || (timestamp_us == NULL))
+    {
+        return 1;
+    }
+    if (((lock == NULL) != (unlock == NULL)) || (ttl_ms > 0x7FFFFFFFU / 1000U))
+    {
+        return 1;
+    }
+    
+    /* set the cache */
+    memset(cache, 0, sizeof(stcc4_cache_t));
+    cache->handle = handle;
+    cache->timestamp_us = timestamp_us;
+    cache->lock = lock;
+    cache->unlock = unlock;
+    cache->ttl_us = ttl_ms * 1000U;
+    
+    return 0;
+}
+
+/**
+ * @brief      cache example read
+ * @param[in]  *cache pointer to a cache structure
+ * @param[out] *co2_ppm pointer to a converted co2 buffer
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a frame younger than the ttl is served without bus traffic,
+ *             callers blocked behind an in flight transaction take its result
+ *             unless the frame was dropped by stcc4_cache_invalidate or has expired meanwhile
+ */
+uint8_t stcc4_cache_read(stcc4_cache_t *cache, int16_t *co2_ppm, float *temperature, float *humidity)
+{
+    uint8_t res;
+    uint32_t generation;
+    uint32_t age_us;
+    
+    if ((cache == NULL) || (co2_ppm == NULL) || (temperature == NULL) || (humidity == NULL))
+    {
+        return 1;
+    }
+    
+    /* remember the transactions seen before waiting for the lock */
+#if defined(__GNUC__) || defined(__clang__)
+    generation = __atomic_load_n(&cache->generation, __ATOMIC_RELAXED);
+#else
+    generation = *(volatile uint32_t *)&cache->generation;
+#endif
+    if (cache->lock != NULL)
+    {
+        cache->lock();
+    }
+    
+    age_us = cache->timestamp_us() - cache->stamp_us;
+    if ((generation != cache->generation) && ((cache->valid != 0) || (cache->result != 0)) &&
+        (age_us < cache->ttl_us))
+    {
+        /* another caller finished a transaction while this one waited, and it is neither dropped nor expired */
+        cache->stats.coalesced++;
+    }
+    else if ((cache->valid != 0) && (age_us < cache->ttl_us))
+    {
+        /* the frame is still fresh */
+        cache->stats.hits++;
+    }
+    else
+    {
+        /* go to the bus */
+        cache->stats.misses++;
+        res = stcc4_read(cache->handle, &cache->co2_raw, &cache->co2_ppm,
+                         &cache->temperature_raw, &cache->temperature,
+                         &cache->humidity_raw, &cache->humidity, &cache->sensor_status);
+        cache->result = res;
+        cache->valid = (res == 0) ? 1 : 0;
+        cache->stamp_us = cache->timestamp_us();
+#if defined(__GNUC__) || defined(__clang__)
+        __atomic_store_n(&cache->generation, cache->generation + 1, __ATOMIC_RELAXED);
+#else
+        *(volatile uint32_t *)&cache->generation = cache->generation + 1;
+#endif
+    }
+    
+    /* copy the frame or the failure of the last transaction */
+    res = cache->result;
+    *co2_ppm = cache->co2_ppm;
+    *temperature = cache->temperature;
+    *humidity = cache->humidity;
+    
+    if (cache->unlock != NULL)
+    {
+        cache->unlock();
+    }
+    
+    return (res == 0) ? 0 : 1;
+}
+
+/**
+ * @brief     cache example drop the cached frame
+ * @param[in] *cache pointer to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 invalidate failed
+ * @note      call it after a command that restarts the measurement,
+ *            callers already waiting for the lock go to the bus instead of taking the dropped frame
+ */
+uint8_t stcc4_cache_invalidate(stcc4_cache_t *cache)
+{
+    if (cache == NULL)
+    {
+        return 1;
+    }
+    
+    if (cache->lock != NULL)
+    {
+        cache->lock();
+    }
+    cache->valid = 0;
+    cache->result = 0;
+    if (cache->unlock != NULL)
+    {
+        cache->unlock();
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      cache example get the counters
+ * @param[in]  *cache pointer to a cache structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       none
+ */
+uint8_t stcc4_cache_get_stats(stcc4_cache_t *cache, stcc4_cache_stats_t *stats)
+{
+    if ((cache == NULL) || (stats == NULL))
+    {
+        return 1;
+    }
+    
+    if (cache->lock != NULL)
+    {
+        cache->lock();
+    }
+    *stats = cache->stats;
+    if (cache->unlock != NULL)
+    {
+        cache->unlock();
+    }
+    
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_cache.h
+ * @brief     driver stcc4 cache header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_CACHE_H
+#define DRIVER_STCC4_CACHE_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 cache stats structure definition
+ */
+typedef struct stcc4_cache_stats_s
+{
+    uint32_t hits;             /**< reads served from a fresh frame */
+    uint32_t misses;           /**< reads that went to the bus */
+    uint32_t coalesced;        /**< reads served by a transaction another caller had in flight */
+} stcc4_cache_stats_t;
+
+/**
+ * @brief stcc4 cache structure definition
+ */
+typedef struct stcc4_cache_s
+{
+    stcc4_handle_t *handle;               /**< pointer to a stcc4 handle in continuous mode */
+    uint32_t (*timestamp_us)(void);       /**< point to a monotonic timestamp_us function address */
+    void (*lock)(void);                   /**< point to a lock function address, NULL for one caller */
+    void (*unlock)(void);                 /**< point to an unlock function address, NULL for one caller */
+    uint32_t ttl_us;                      /**< frame time to live in us */
+    uint32_t stamp_us;                    /**< frame decode timestamp in us */
+    uint32_t generation;                  /**< finished bus transactions */
+    uint8_t valid;                        /**< frame valid flag */
+    uint8_t result;                       /**< status code of the last transaction, 0 once invalidated */
+    int16_t co2_raw;                      /**< co2 raw */
+    int16_t co2_ppm;                      /**< co2 ppm */
+    uint16_t temperature_raw;             /**< temperature raw */
+    float temperature;                    /**< temperature */
+    uint16_t humidity_raw;                /**< humidity raw */
+    float humidity;                       /**< humidity */
+    uint16_t sensor_status;               /**< sensor status */
+    stcc4_cache_stats_t stats;            /**< hit and miss counters */
+} stcc4_cache_t;
+
+/**
+ * @brief     cache example init
+ * @param[in] *cache pointer to a cache structure
+ * @param[in] *handle pointer to a stcc4 handle in continuous mode
+ * @param[in] ttl_ms frame time to live in ms
+ * @param[in] *timestamp_us pointer to a monotonic timestamp_us function address
+ * @param[in] *lock pointer to a lock function address, NULL for one caller
+ * @param[in] *unlock pointer to an unlock function address, NULL for one caller
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the sensor updates once a second in continuous mode, so a ttl up to 1000ms never hides a new sample for long
+ */
+uint8_t stcc4_cache_init(stcc4_cache_t *cache, stcc4_handle_t *handle, uint32_t ttl_ms,
+                         uint32_t (*timestamp_us)(void), void (*lock)(void), void (*unlock)(void));
+
+/**
+ * @brief      cache example read
+ * @param[in]  *cache pointer to a cache structure
+ * @param[out] *co2_ppm pointer to a converted co2 buffer
+ * @param[out] *temperature pointer to a converted temperature buffer
+ * @param[out] *humidity pointer to a converted humidity buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a frame younger than the ttl is served without bus traffic,
+ *             callers blocked behind an in flight transaction take its result
+ *             unless the frame was dropped by stcc4_cache_invalidate or has expired meanwhile
+ */
+uint8_t stcc4_cache_read(stcc4_cache_t *cache, int16_t *co2_ppm, float *temperature, float *humidity);
+
+/**
+ * @brief     cache example drop the cached frame
+ * @param[in] *cache pointer to a cache structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 invalidate failed
+ * @note      call it after a command that restarts the measurement,
+ *            callers already waiting for the lock go to the bus instead of taking the dropped frame
+ */
+uint8_t stcc4_cache_invalidate(stcc4_cache_t *cache);
+
+/**
+ * @brief      cache example get the counters
+ * @param[in]  *cache pointer to a cache structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       none
+ */
+uint8_t stcc4_cache_get_stats(stcc4_cache_t *cache, stcc4_cache_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,429 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_codec.c
+ * @brief     driver stcc4 codec source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_codec.h"
+
+/**
+ * @brief     zig-zag encode
+ * @param[in] v signed value
+ * @return    unsigned value
+ * @note      none
+ */
+static inline uint32_t a_stcc4_codec_zigzag(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(0 - ((uint32_t)v >> 31));
+}
+
+/**
+ * @brief     zig-zag decode
+ * @param[in] v unsigned value
+ * @return    signed value
+ * @note      none
+ */
+static inline int32_t a_stcc4_codec_unzigzag(uint32_t v)
+{
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+/**
+ * @brief     put a varint
+ * @param[in] *buf pointer to an output buffer
+ * @param[in] v value
+ * @return    written bytes
+ * @note      7 bits per byte, low bits first
+ */
+static inline uint32_t a_stcc4_codec_put(uint8_t *buf, uint32_t v)
+{
+    uint32_t i;
+    
+    i = 0;
+    while (v >= 0x80)
+    {
+        buf[i++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    buf[i++] = (uint8_t)v;
+    
+    return i;
+}
+
+/**
+ * @brief      get a varint
+ * @param[in]  *buf pointer to an input buffer
+ * @param[in]  *pos pointer to a read position
+ * @param[in]  end end of the input
+ * @param[out] *v pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 truncated or too long
+ * @note       none
+ */
+static inline uint8_t a_stcc4_codec_get(const uint8_t *buf, uint32_t *pos, uint32_t end, uint32_t *v)
+{
+    uint32_t shift;
+    uint32_t value;
+    uint8_t b;
+    
+    value = 0;
+    for (shift = 0; shift < 35; shift += 7)
+    {
+        if (*pos >= end)
+        {
+            return 1;
+        }
+        b = buf[(*pos)++];
+        value |= (uint32_t)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0)
+        {
+            *v = value;
+            
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     put a little endian 16 bits value
+ * @param[in] *buf pointer to an output buffer
+ * @param[in] v value
+ * @note      none
+ */
+static inline void a_stcc4_codec_put16(uint8_t *buf, uint16_t v)
+{
+    buf[0] = (uint8_t)(v & 0xFF);
+    buf[1] = (uint8_t)(v >> 8);
+}
+
+/**
+ * @brief     get a little endian 16 bits value
+ * @param[in] *buf pointer to an input buffer
+ * @return    value
+ * @note      none
+ */
+static inline uint16_t a_stcc4_codec_get16(const uint8_t *buf)
+{
+    return (uint16_t)(buf[0] | ((uint16_t)buf[1] << 8));
+}
+
+/**
+ * @brief      encode one block
+ * @param[in]  *record pointer to a record array of one sensor
+ * @param[in]  num record number
+ * @param[out] *buf pointer to a STCC4_CODEC_BLOCK_MAX_SIZE bytes buffer
+ * @return     block size
+ * @note       none
+ */
+static uint32_t a_stcc4_codec_encode_block(const stcc4_log_record_t *record, uint16_t num, uint8_t *buf)
+{
+    uint32_t pos;
+    uint32_t run;
+    uint32_t delta;
+    uint32_t last_delta;
+    uint16_t i;
+    
+    /* the first record as is */
+    pos = STCC4_CODEC_BLOCK_HEADER;
+    a_stcc4_codec_put16(&buf[pos + 0], (uint16_t)(record[0].timestamp & 0xFFFF));
+    a_stcc4_codec_put16(&buf[pos + 2], (uint16_t)(record[0].timestamp >> 16));
+    a_stcc4_codec_put16(&buf[pos + 4], (uint16_t)record[0].co2_raw);
+    a_stcc4_codec_put16(&buf[pos + 6], record[0].temperature_raw);
+    a_stcc4_codec_put16(&buf[pos + 8], record[0].humidity_raw);
+    buf[pos + 10] = record[0].sensor_id;
+    buf[pos + 11] = 0;
+    pos += 12;
+    
+    /* delta of delta timestamps and channel deltas */
+    last_delta = 0;
+    for (i = 1; i < num; i++)
+    {
+        delta = record[i].timestamp - record[i - 1].timestamp;
+        pos += a_stcc4_codec_put(&buf[pos], a_stcc4_codec_zigzag((int32_t)(delta - last_delta)));
+        last_delta = delta;
+        pos += a_stcc4_codec_put(&buf[pos], a_stcc4_codec_zigzag((int16_t)(uint16_t)(record[i].co2_raw - record[i - 1].co2_raw)));
+        pos += a_stcc4_codec_put(&buf[pos], a_stcc4_codec_zigzag((int16_t)(uint16_t)(record[i].temperature_raw - record[i - 1].temperature_raw)));
+        pos += a_stcc4_codec_put(&buf[pos], a_stcc4_codec_zigzag((int16_t)(uint16_t)(record[i].humidity_raw - record[i - 1].humidity_raw)));
+    }
+    
+    /* status runs */
+    run = 1;
+    for (i = 1; i <= num; i++)
+    {
+        if ((i < num) && (record[i].sensor_status == record[i - 1].sensor_status))
+        {
+            run++;
+            
+            continue;
+        }
+        pos += a_stcc4_codec_put(&buf[pos], run);
+        buf[pos++] = record[i - 1].sensor_status;
+        run = 1;
+    }
+    
+    /* block header */
+    a_stcc4_codec_put16(&buf[0], (uint16_t)(pos - STCC4_CODEC_BLOCK_HEADER));
+    a_stcc4_codec_put16(&buf[2], num);
+    
+    return pos;
+}
+
+/**
+ * @brief     codec example encoder init
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *write pointer to a block output function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t stcc4_codec_encoder_init(stcc4_codec_encoder_t *encoder, uint8_t (*write)(const uint8_t *buf, uint32_t len))
+{
+    if ((encoder == NULL) || (write == NULL))
+    {
+        return 1;
+    }
+    
+    /* set the encoder */
+    encoder->write = write;
+    encoder->num = 0;
+    encoder->blocks = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     codec example encode a record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *record pointer to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 encode failed
+ * @note      a block is written when it is full or the sensor id changes
+ */
+uint8_t stcc4_codec_encode(stcc4_codec_encoder_t *encoder, const stcc4_log_record_t *record)
+{
+    if ((encoder == NULL) || (record == NULL))
+    {
+        return 1;
+    }
+    
+    /* a block holds one sensor */
+    if ((encoder->num != 0) && (encoder->record[0].sensor_id != record->sensor_id))
+    {
+        if (stcc4_codec_flush(encoder) != 0)
+        {
+            return 1;
+        }
+    }
+    encoder->record[encoder->num++] = *record;
+    if (encoder->num == STCC4_CODEC_BLOCK)
+    {
+        return stcc4_codec_flush(encoder);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     codec example write the pending records as a short block
+ * @param[in] *encoder pointer to an encoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      none
+ */
+uint8_t stcc4_codec_flush(stcc4_codec_encoder_t *encoder)
+{
+    uint32_t len;
+    
+    if (encoder == NULL)
+    {
+        return 1;
+    }
+    if (encoder->num == 0)
+    {
+        return 0;
+    }
+    
+    /* encode and write */
+    len = a_stcc4_codec_encode_block(encoder->record, encoder->num, encoder->buf);
+    encoder->num = 0;
+    if (encoder->write(encoder->buf, len) != 0)
+    {
+        return 1;
+    }
+    encoder->blocks++;
+    
+    return 0;
+}
+
+/**
+ * @brief      codec example index the blocks of a stream
+ * @param[in]  *buf pointer to a stream buffer
+ * @param[in]  len stream length
+ * @param[out] *offset pointer to a block offset array
+ * @param[in]  max offset array length
+ * @param[out] *num pointer to a block number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index failed
+ * @note       only the block headers are read
+ */
+uint8_t stcc4_codec_index(const uint8_t *buf, uint32_t len, uint32_t *offset, uint32_t max, uint32_t *num)
+{
+    uint32_t pos;
+    uint32_t n;
+    
+    if ((buf == NULL) || (offset == NULL) || (num == NULL))
+    {
+        return 1;
+    }
+    
+    /* hop over the block headers */
+    pos = 0;
+    n = 0;
+    while (pos < len)
+    {
+        if ((n >= max) || (len - pos < STCC4_CODEC_BLOCK_HEADER))
+        {
+            return 1;
+        }
+        offset[n++] = pos;
+        pos += STCC4_CODEC_BLOCK_HEADER + a_stcc4_codec_get16(&buf[pos]);
+    }
+    if (pos != len)
+    {
+        return 1;
+    }
+    *num = n;
+    
+    return 0;
+}
+
+/**
+ * @brief      codec example decode one block
+ * @param[in]  *buf pointer to a block
+ * @param[in]  len bytes left in the stream from the block start
+ * @param[out] *record pointer to a STCC4_CODEC_BLOCK records buffer
+ * @param[out] *num pointer to a record number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 decode failed
+ * @note       blocks decode alone, so a block index from stcc4_codec_index gives random access
+ */
+uint8_t stcc4_codec_decode_block(const uint8_t *buf, uint32_t len, stcc4_log_record_t *record, uint16_t *num)
+{
+    uint32_t end;
+    uint32_t pos;
+    uint32_t v;
+    uint32_t run;
+    uint32_t delta;
+    uint16_t n;
+    uint16_t i;
+    
+    if ((buf == NULL) || (record == NULL) || (num == NULL) || (len < STCC4_CODEC_BLOCK_HEADER + 12))
+    {
+        return 1;
+    }
+    
+    /* block header */
+    end = STCC4_CODEC_BLOCK_HEADER + a_stcc4_codec_get16(&buf[0]);
+    n = a_stcc4_codec_get16(&buf[2]);
+    if ((end > len) || (n == 0) || (n > STCC4_CODEC_BLOCK))
+    {
+        return 1;
+    }
+    
+    /* the first record */
+    pos = STCC4_CODEC_BLOCK_HEADER;
+    record[0].timestamp = (uint32_t)a_stcc4_codec_get16(&buf[pos + 0]) | ((uint32_t)a_stcc4_codec_get16(&buf[pos + 2]) << 16);
+    record[0].co2_raw = (int16_t)a_stcc4_codec_get16(&buf[pos + 4]);
+    record[0].temperature_raw = a_stcc4_codec_get16(&buf[pos + 6]);
+    record[0].humidity_raw = a_stcc4_codec_get16(&buf[pos + 8]);
+    record[0].sensor_id = buf[pos + 10];
+    pos += 12;
+    
+    /* deltas */
+    delta = 0;
+    for (i = 1; i < n; i++)
+    {
+        if (a_stcc4_codec_get(buf, &pos, end, &v) != 0)
+        {
+            return 1;
+        }
+        delta += (uint32_t)a_stcc4_codec_unzigzag(v);
+        record[i].timestamp = record[i - 1].timestamp + delta;
+        if (a_stcc4_codec_get(buf, &pos, end, &v) != 0)
+        {
+            return 1;
+        }
+        record[i].co2_raw = (int16_t)(uint16_t)((uint16_t)record[i - 1].co2_raw + (uint16_t)a_stcc4_codec_unzigzag(v));
+        if (a_stcc4_codec_get(buf, &pos, end, &v) != 0)
+        {
+            return 1;
+        }
+        record[i].temperature_raw = (uint16_t)(record[i - 1].temperature_raw + (uint16_t)a_stcc4_codec_unzigzag(v));
+        if (a_stcc4_codec_get(buf, &pos, end, &v) != 0)
+        {
+            return 1;
+        }
+        record[i].humidity_raw = (uint16_t)(record[i - 1].humidity_raw + (uint16_t)a_stcc4_codec_unzigzag(v));
+        record[i].sensor_id = record[0].sensor_id;
+    }
+    
+    /* status runs */
+    i = 0;
+    while (i < n)
+    {
+        if ((a_stcc4_codec_get(buf, &pos, end, &run) != 0) || (pos >= end) || (run == 0) || (run > (uint32_t)(n - i)))
+        {
+            return 1;
+        }
+        while (run-- != 0)
+        {
+            record[i++].sensor_status = buf[pos];
+        }
+        pos++;
+    }
+    if (pos != end)
+    {
+        return 1;
+    }
+    *num = n;
+    
+    return 0;
+}
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_codec.h
+ * @brief     driver stcc4 codec header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_CODEC_H
+#define DRIVER_STCC4_CODEC_H
+
+#include "driver_stcc4_log.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 codec definition
+ * @note  a block is a 2 bytes payload length, a 2 bytes record number, the first record as is,
+ *        delta of delta timestamps and zig-zag varint deltas of the raw channels, then the runs of
+ *        the record status byte, which is the STCC4_LOG_STATUS mapped sensor status high byte
+ */
+#define STCC4_CODEC_BLOCK                256                                                 /**< max records per block */
+#define STCC4_CODEC_BLOCK_HEADER         4                                                   /**< block header size */
+#define STCC4_CODEC_BLOCK_MAX_SIZE       (STCC4_CODEC_BLOCK_HEADER + 12 +                    \
+                                          (STCC4_CODEC_BLOCK - 1) * 14 +                     \
+                                          STCC4_CODEC_BLOCK * 3)                             /**< worst case block size */
+
+/**
+ * @brief stcc4 codec encoder structure definition
+ */
+typedef struct stcc4_codec_encoder_s
+{
+    uint8_t (*write)(const uint8_t *buf, uint32_t len);          /**< point to a block output function address */
+    stcc4_log_record_t record[STCC4_CODEC_BLOCK];                /**< pending records */
+    uint16_t num;                                                /**< pending record number */
+    uint32_t blocks;                                             /**< written blocks */
+    uint8_t buf[STCC4_CODEC_BLOCK_MAX_SIZE];                     /**< block buffer */
+} stcc4_codec_encoder_t;
+
+/**
+ * @brief     codec example encoder init
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *write pointer to a block output function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t stcc4_codec_encoder_init(stcc4_codec_encoder_t *encoder, uint8_t (*write)(const uint8_t *buf, uint32_t len));
+
+/**
+ * @brief     codec example encode a record
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] *record pointer to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 encode failed
+ * @note      a block is written when it is full or the sensor id changes
+ */
+uint8_t stcc4_codec_encode(stcc4_codec_encoder_t *encoder, const stcc4_log_record_t *record);
+
+/**
+ * @brief     codec example write the pending records as a short block
+ * @param[in] *encoder pointer to an encoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      none
+ */
+uint8_t stcc4_codec_flush(stcc4_codec_encoder_t *encoder);
+
+/**
+ * @brief      codec example index the blocks of a stream
+ * @param[in]  *buf pointer to a stream buffer
+ * @param[in]  len stream length
+ * @param[out] *offset pointer to a block offset array
+ * @param[in]  max offset array length
+ * @param[out] *num pointer to a block number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index failed
+ * @note       only the block headers are read
+ */
+uint8_t stcc4_codec_index(const uint8_t *buf, uint32_t len, uint32_t *offset, uint32_t max, uint32_t *num);
+
+/**
+ * @brief      codec example decode one block
+ * @param[in]  *buf pointer to a block
+ * @param[in]  len bytes left in the stream from the block start
+ * @param[out] *record pointer to a STCC4_CODEC_BLOCK records buffer
+ * @param[out] *num pointer to a record number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 decode failed
+ * @note       blocks decode alone, so a block index from stcc4_codec_index gives random access
+ */
+uint8_t stcc4_codec_decode_block(const uint8_t *buf, uint32_t len, stcc4_log_record_t *record, uint16_t *num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
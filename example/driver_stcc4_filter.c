@@ -0,0 +1,395 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_filter.c
+ * @brief     driver stcc4 filter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_filter.h"
+
+/**
+ * @brief filter skip list definition
+ */
+#define FILTER_NIL         0xFF                               /**< end of a level */
+#define FILTER_HEAD        STCC4_FILTER_WINDOW_MAX            /**< head node index */
+
+/**
+ * @brief     filter example ema init
+ * @param[in] *ema pointer to an ema structure
+ * @param[in] alpha_milli weight of a new sample in 0.001, 1 - 1000
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t stcc4_filter_ema_init(stcc4_filter_ema_t *ema, uint16_t alpha_milli)
+{
+    if ((ema == NULL) || (alpha_milli == 0) || (alpha_milli > 1000))
+    {
+        return 1;
+    }
+    
+    ema->acc = 0;
+    ema->alpha = ((uint32_t)alpha_milli * 65536U + 500U) / 1000U;
+    ema->init = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     filter example ema update
+ * @param[in] *ema pointer to an ema structure
+ * @param[in] x new sample
+ * @return    filtered value
+ * @note      the first sample seeds the state
+ */
+int32_t stcc4_filter_ema_update(stcc4_filter_ema_t *ema, int32_t x)
+{
+    int64_t target;
+    
+    target = (int64_t)x * 65536;
+    if (ema->init == 0)
+    {
+        ema->acc = target;
+        ema->init = 1;
+    }
+    else
+    {
+        ema->acc += (target - ema->acc) * (int64_t)ema->alpha / 65536;
+    }
+    
+    return (int32_t)((ema->acc + (ema->acc >= 0 ? 32768 : -32768)) / 65536);
+}
+
+/**
+ * @brief     get a skip list level
+ * @param[in] *median pointer to a median structure
+ * @return    level 1 - STCC4_FILTER_SKIP_LEVELS
+ * @note      each level is kept with a probability of 1/2
+ */
+static inline uint8_t a_stcc4_filter_level(stcc4_filter_median_t *median)
+{
+    uint8_t level;
+    
+    median->seed ^= median->seed << 13;
+    median->seed ^= median->seed >> 17;
+    median->seed ^= median->seed << 5;
+    level = 1;
+    while ((level < STCC4_FILTER_SKIP_LEVELS) && ((median->seed >> (level + 7)) & 1) != 0)
+    {
+        level++;
+    }
+    
+    return level;
+}
+
+/**
+ * @brief     insert a value into the skip list
+ * @param[in] *median pointer to a median structure
+ * @param[in] x value
+ * @note      the window must not be full
+ */
+static void a_stcc4_filter_insert(stcc4_filter_median_t *median, int32_t x)
+{
+    stcc4_filter_node_t *node = median->node;
+    uint8_t chain[STCC4_FILTER_SKIP_LEVELS];
+    uint8_t steps[STCC4_FILTER_SKIP_LEVELS];
+    uint8_t cur;
+    uint8_t n;
+    uint8_t step;
+    int8_t l;
+    
+    /* find the last node <= x on each level */
+    cur = FILTER_HEAD;
+    for (l = STCC4_FILTER_SKIP_LEVELS - 1; l >= 0; l--)
+    {
+        steps[l] = 0;
+        while ((node[cur].next[l] != FILTER_NIL) && (node[node[cur].next[l]].value <= x))
+        {
+            steps[l] += node[cur].width[l];
+            cur = node[cur].next[l];
+        }
+        chain[l] = cur;
+    }
+    
+    /* link a free node */
+    n = median->free;
+    median->free = node[n].next[0];
+    node[n].value = x;
+    node[n].level = a_stcc4_filter_level(median);
+    step = 0;
+    for (l = 0; l < STCC4_FILTER_SKIP_LEVELS; l++)
+    {
+        if (l < node[n].level)
+        {
+            node[n].next[l] = node[chain[l]].next[l];
+            node[chain[l]].next[l] = n;
+            node[n].width[l] = (uint8_t)(node[chain[l]].width[l] - step);
+            node[chain[l]].width[l] = (uint8_t)(step + 1);
+            step = (uint8_t)(step + steps[l]);
+        }
+        else
+        {
+            node[chain[l]].width[l]++;
+        }
+    }
+}
+
+/**
+ * @brief     remove a value from the skip list
+ * @param[in] *median pointer to a median structure
+ * @param[in] x value in the list
+ * @note      any node holding x is removed, they are equal for a median
+ */
+static void a_stcc4_filter_remove(stcc4_filter_median_t *median, int32_t x)
+{
+    stcc4_filter_node_t *node = median->node;
+    uint8_t chain[STCC4_FILTER_SKIP_LEVELS];
+    uint8_t cur;
+    uint8_t n;
+    int8_t l;
+    
+    /* find the last node < x on each level */
+    cur = FILTER_HEAD;
+    for (l = STCC4_FILTER_SKIP_LEVELS - 1; l >= 0; l--)
+    {
+        while ((node[cur].next[l] != FILTER_NIL) && (node[node[cur].next[l]].value < x))
+        {
+            cur = node[cur].next[l];
+        }
+        chain[l] = cur;
+    }
+    
+    /* unlink the first node holding x */
+    n = node[chain[0]].next[0];
+    for (l = 0; l < STCC4_FILTER_SKIP_LEVELS; l++)
+    {
+        if (l < node[n].level)
+        {
+            node[chain[l]].width[l] = (uint8_t)(node[chain[l]].width[l] + node[n].width[l] - 1);
+            node[chain[l]].next[l] = node[n].next[l];
+        }
+        else
+        {
+            node[chain[l]].width[l]--;
+        }
+    }
+    node[n].next[0] = median->free;
+    median->free = n;
+}
+
+/**
+ * @brief     get the value of a rank
+ * @param[in] *median pointer to a median structure
+ * @param[in] rank 0 based rank
+ * @return    value
+ * @note      none
+ */
+static int32_t a_stcc4_filter_rank(const stcc4_filter_median_t *median, uint8_t rank)
+{
+    const stcc4_filter_node_t *node = median->node;
+    uint8_t cur;
+    uint8_t i;
+    int8_t l;
+    
+    cur = FILTER_HEAD;
+    i = (uint8_t)(rank + 1);
+    for (l = STCC4_FILTER_SKIP_LEVELS - 1; l >= 0; l--)
+    {
+        while ((node[cur].next[l] != FILTER_NIL) && (node[cur].width[l] <= i))
+        {
+            i = (uint8_t)(i - node[cur].width[l]);
+            cur = node[cur].next[l];
+        }
+    }
+    
+    return node[cur].value;
+}
+
+/**
+ * @brief     filter example median init
+ * @param[in] *median pointer to a median structure
+ * @param[in] window odd window length, 1 - STCC4_FILTER_WINDOW_MAX
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t stcc4_filter_median_init(stcc4_filter_median_t *median, uint8_t window)
+{
+    uint8_t i;
+    uint8_t l;
+    
+    if ((median == NULL) || (window == 0) || (window > STCC4_FILTER_WINDOW_MAX) || ((window & 1) == 0))
+    {
+        return 1;
+    }
+    
+    /* empty list, every node is free */
+    memset(median, 0, sizeof(stcc4_filter_median_t));
+    for (l = 0; l < STCC4_FILTER_SKIP_LEVELS; l++)
+    {
+        median->node[FILTER_HEAD].next[l] = FILTER_NIL;
+        median->node[FILTER_HEAD].width[l] = 1;
+    }
+    median->node[FILTER_HEAD].level = STCC4_FILTER_SKIP_LEVELS;
+    for (i = 0; i < STCC4_FILTER_WINDOW_MAX; i++)
+    {
+        median->node[i].next[0] = (uint8_t)((i + 1 < STCC4_FILTER_WINDOW_MAX) ? i + 1 : FILTER_NIL);
+    }
+    median->free = 0;
+    median->window = window;
+    median->seed = 0x9E3779B9U;
+    
+    return 0;
+}
+
+/**
+ * @brief     filter example median update
+ * @param[in] *median pointer to a median structure
+ * @param[in] x new sample
+ * @return    median of the window
+ * @note      while the window fills, the upper median of the samples so far is returned
+ */
+int32_t stcc4_filter_median_update(stcc4_filter_median_t *median, int32_t x)
+{
+    uint8_t slot;
+    
+    if (median->num == median->window)
+    {
+        /* drop the oldest sample and reuse its slot */
+        a_stcc4_filter_remove(median, median->ring[median->oldest]);
+        slot = median->oldest;
+        median->oldest = (uint8_t)((median->oldest + 1 == median->window) ? 0 : median->oldest + 1);
+    }
+    else
+    {
+        slot = median->num++;
+    }
+    median->ring[slot] = x;
+    a_stcc4_filter_insert(median, x);
+    
+    return a_stcc4_filter_rank(median, (uint8_t)(median->num / 2));
+}
+
+/**
+ * @brief     filter example hampel init
+ * @param[in] *hampel pointer to a hampel structure
+ * @param[in] window odd window length, 1 - STCC4_FILTER_WINDOW_MAX
+ * @param[in] nsigma_milli threshold in 0.001 sigma, 3000 is the usual choice
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t stcc4_filter_hampel_init(stcc4_filter_hampel_t *hampel, uint8_t window, uint32_t nsigma_milli)
+{
+    if (hampel == NULL)
+    {
+        return 1;
+    }
+    if (stcc4_filter_median_init(&hampel->median, window) != 0)
+    {
+        return 1;
+    }
+    hampel->nsigma_milli = nsigma_milli;
+    hampel->rejected = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     filter example hampel update
+ * @param[in] *hampel pointer to a hampel structure
+ * @param[in] x new sample
+ * @return    x, or the window median when x is further than nsigma * 1.4826 * mad from it
+ * @note      causal, the window holds x and the samples before it, the mad walk is O(window)
+ */
+int32_t stcc4_filter_hampel_update(stcc4_filter_hampel_t *hampel, int32_t x)
+{
+    stcc4_filter_median_t *median = &hampel->median;
+    int32_t sorted[STCC4_FILTER_WINDOW_MAX];
+    int64_t deviation;
+    int64_t mad;
+    int64_t dl;
+    int64_t dr;
+    int32_t m;
+    uint8_t cur;
+    uint8_t n;
+    uint8_t c;
+    uint8_t k;
+    int16_t lo;
+    uint8_t hi;
+    
+    m = stcc4_filter_median_update(median, x);
+    
+    /* the sorted window from level 0 */
+    n = 0;
+    cur = median->node[FILTER_HEAD].next[0];
+    while (cur != FILTER_NIL)
+    {
+        sorted[n++] = median->node[cur].value;
+        cur = median->node[cur].next[0];
+    }
+    
+    /* the deviations grow away from the median, merge both sides up to the median rank */
+    c = (uint8_t)(n / 2);
+    lo = (int16_t)(c - 1);
+    hi = (uint8_t)(c + 1);
+    mad = 0;
+    for (k = 0; k < n / 2; k++)
+    {
+        dl = (lo >= 0) ? (int64_t)m - sorted[lo] : INT64_MAX;
+        dr = (hi < n) ? (int64_t)sorted[hi] - m : INT64_MAX;
+        if (dl <= dr)
+        {
+            mad = dl;
+            lo--;
+        }
+        else
+        {
+            mad = dr;
+            hi++;
+        }
+    }
+    
+    /* |x - m| > nsigma * 1.4826 * mad */
+    deviation = (x > m) ? (int64_t)x - m : (int64_t)m - x;
+    if (deviation * 10000000 > (int64_t)hampel->nsigma_milli * 14826 * mad)
+    {
+        hampel->rejected++;
+        
+        return m;
+    }
+    
+    return x;
+}
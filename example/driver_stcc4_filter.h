@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_filter.h
+ * @brief     driver stcc4 filter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_FILTER_H
+#define DRIVER_STCC4_FILTER_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 filter size definition
+ * @note  override them in the compiler flags, the window must stay below 255
+ */
+#ifndef STCC4_FILTER_WINDOW_MAX
+    #define STCC4_FILTER_WINDOW_MAX        15        /**< max median window */
+#endif
+#ifndef STCC4_FILTER_SKIP_LEVELS
+    #define STCC4_FILTER_SKIP_LEVELS       4         /**< skip list levels */
+#endif
+
+/**
+ * @brief stcc4 filter ema structure definition
+ */
+typedef struct stcc4_filter_ema_s
+{
+    int64_t acc;              /**< state in q16 */
+    uint32_t alpha;           /**< weight of a new sample in q16 */
+    uint8_t init;             /**< first sample flag */
+} stcc4_filter_ema_t;
+
+/**
+ * @brief stcc4 filter skip list node structure definition
+ */
+typedef struct stcc4_filter_node_s
+{
+    int32_t value;                                       /**< sample value */
+    uint8_t level;                                       /**< link number */
+    uint8_t next[STCC4_FILTER_SKIP_LEVELS];              /**< next node of each level */
+    uint8_t width[STCC4_FILTER_SKIP_LEVELS];             /**< samples skipped by each link */
+} stcc4_filter_node_t;
+
+/**
+ * @brief stcc4 filter median structure definition
+ * @note  an indexable skip list keeps the window sorted, insert, remove and rank are O(log n)
+ */
+typedef struct stcc4_filter_median_s
+{
+    stcc4_filter_node_t node[STCC4_FILTER_WINDOW_MAX + 1];        /**< node pool, the last one is the head */
+    int32_t ring[STCC4_FILTER_WINDOW_MAX];                         /**< samples in arrival order */
+    uint8_t window;                                                /**< window length */
+    uint8_t num;                                                   /**< samples in the window */
+    uint8_t oldest;                                                /**< ring index of the oldest sample */
+    uint8_t free;                                                  /**< free node list */
+    uint32_t seed;                                                 /**< level generator state */
+} stcc4_filter_median_t;
+
+/**
+ * @brief stcc4 filter hampel structure definition
+ */
+typedef struct stcc4_filter_hampel_s
+{
+    stcc4_filter_median_t median;         /**< sorted window */
+    uint32_t nsigma_milli;                /**< threshold in 0.001 sigma */
+    uint32_t rejected;                    /**< replaced samples */
+} stcc4_filter_hampel_t;
+
+/**
+ * @brief     filter example ema init
+ * @param[in] *ema pointer to an ema structure
+ * @param[in] alpha_milli weight of a new sample in 0.001, 1 - 1000
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t stcc4_filter_ema_init(stcc4_filter_ema_t *ema, uint16_t alpha_milli);
+
+/**
+ * @brief     filter example ema update
+ * @param[in] *ema pointer to an ema structure
+ * @param[in] x new sample
+ * @return    filtered value
+ * @note      the first sample seeds the state
+ */
+int32_t stcc4_filter_ema_update(stcc4_filter_ema_t *ema, int32_t x);
+
+/**
+ * @brief     filter example median init
+ * @param[in] *median pointer to a median structure
+ * @param[in] window odd window length, 1 - STCC4_FILTER_WINDOW_MAX
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t stcc4_filter_median_init(stcc4_filter_median_t *median, uint8_t window);
+
+/**
+ * @brief     filter example median update
+ * @param[in] *median pointer to a median structure
+ * @param[in] x new sample
+ * @return    median of the window
+ * @note      while the window fills, the upper median of the samples so far is returned
+ */
+int32_t stcc4_filter_median_update(stcc4_filter_median_t *median, int32_t x);
+
+/**
+ * @brief     filter example hampel init
+ * @param[in] *hampel pointer to a hampel structure
+ * @param[in] window odd window length, 1 - STCC4_FILTER_WINDOW_MAX
+ * @param[in] nsigma_milli threshold in 0.001 sigma, 3000 is the usual choice
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t stcc4_filter_hampel_init(stcc4_filter_hampel_t *hampel, uint8_t window, uint32_t nsigma_milli);
+
+/**
+ * @brief     filter example hampel update
+ * @param[in] *hampel pointer to a hampel structure
+ * @param[in] x new sample
+ * @return    x, or the window median when x is further than nsigma * 1.4826 * mad from it
+ * @note      causal, the window holds x and the samples before it, the mad walk is O(window)
+ */
+int32_t stcc4_filter_hampel_update(stcc4_filter_hampel_t *hampel, int32_t x);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
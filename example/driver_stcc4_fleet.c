@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_fleet.c
+ * @brief     driver stcc4 fleet source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_fleet.h"
+
+/**
+ * @brief     fleet example init
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] *sensor pointer to a sensor array with linked handles
+ * @param[in] num sensor number
+ * @param[in] *delay_ms pointer to a delay_ms function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every sensor[i].handle must be initialized by stcc4_init before
+ */
+uint8_t stcc4_fleet_init(stcc4_fleet_t *fleet, stcc4_fleet_sensor_t *sensor, uint16_t num, void (*delay_ms)(uint32_t ms))
+{
+    uint16_t i;
+    
+    /* check the params */
+    if ((fleet == NULL) || (sensor == NULL) || (num == 0) || (delay_ms == NULL))
+    {
+        return 1;
+    }
+    
+    /* clear the sensor state */
+    for (i = 0; i < num; i++)
+    {
+        if (sensor[i].handle == NULL)
+        {
+            return 1;
+        }
+        sensor[i].ready_ms = 0;
+        sensor[i].pending = 0;
+        sensor[i].result = 0;
+    }
+    
+    /* set the fleet */
+    fleet->sensor = sensor;
+    fleet->num = num;
+    fleet->pending = 0;
+    fleet->delay_ms = delay_ms;
+    
+    return 0;
+}
+
+/**
+ * @brief     fleet example start the single shot conversion of every sensor
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] timestamp_ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      sensors failing to start are marked in sensor[i].result and not polled
+ */
+uint8_t stcc4_fleet_start(stcc4_fleet_t *fleet, uint32_t timestamp_ms)
+{
+    uint16_t i;
+    
+    /* check the pending conversions */
+    if (fleet->pending != 0)
+    {
+        return 1;
+    }
+    
+    /* trigger every sensor back to back */
+    for (i = 0; i < fleet->num; i++)
+    {
+        stcc4_fleet_sensor_t *s = &fleet->sensor[i];
+        
+        s->result = stcc4_measure_single_shot_begin(s->handle, timestamp_ms, &s->ready_ms);
+        if (s->result == 0)
+        {
+            s->pending = 1;
+            fleet->pending++;
+        }
+        else
+        {
+            s->pending = 0;
+        }
+    }
+    
+    /* check the started conversions */
+    if (fleet->pending == 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      fleet example collect the finished conversions
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *next_ready_ms pointer to the earliest pending deadline buffer
+ * @return     status code
+ *             - 0 all conversions are collected
+ *             - 6 conversions are pending
+ * @note       none
+ */
+uint8_t stcc4_fleet_poll(stcc4_fleet_t *fleet, uint32_t timestamp_ms, uint32_t *next_ready_ms)
+{
+    uint16_t i;
+    uint8_t first;
+    
+    /* collect every expired deadline */
+    first = 1;
+    for (i = 0; i < fleet->num; i++)
+    {
+        stcc4_fleet_sensor_t *s = &fleet->sensor[i];
+        int16_t co2_raw;
+        uint16_t temperature_raw;
+        uint16_t humidity_raw;
+        uint8_t res;
+        
+        /* skip the idle sensors */
+        if (s->pending == 0)
+        {
+            continue;
+        }
+        
+        /* poll the sensor */
+        res = stcc4_measure_poll(s->handle, timestamp_ms, &s->ready_ms,
+                                 &co2_raw, &s->co2_ppm,
+                                 &temperature_raw, &s->temperature,
+                                 &humidity_raw, &s->humidity, &s->sensor_status);
+        if (res == 6)
+        {
+            /* track the earliest deadline */
+            if ((first != 0) || ((int32_t)(s->ready_ms - *next_ready_ms) < 0))
+            {
+                *next_ready_ms = s->ready_ms;
+                first = 0;
+            }
+            
+            continue;
+        }
+        
+        /* conversion finished */
+        s->result = res;
+        s->pending = 0;
+        fleet->pending--;
+    }
+    
+    /* check the pending conversions */
+    if (fleet->pending != 0)
+    {
+        return 6;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fleet example run one full measurement cycle
+ * @param[in] *fleet pointer to a fleet structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      returns 1 when any sensor failed, check sensor[i].result for details
+ */
+uint8_t stcc4_fleet_read(stcc4_fleet_t *fleet)
+{
+    uint8_t res;
+    uint16_t i;
+    uint32_t timestamp;
+    uint32_t next_ready;
+    
+    /* 
+     * the timeline only advances by the time spent in delay_ms, the real
+     * elapsed time is always longer because of the bus traffic, so every
+     * deadline seen here is reached late and never early
+     */
+    timestamp = 0;
+    
+    /* start all conversions */
+    res = stcc4_fleet_start(fleet, timestamp);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* collect the results as the deadlines expire */
+    next_ready = 0;
+    while (1)
+    {
+        res = stcc4_fleet_poll(fleet, timestamp, &next_ready);
+        if (res != 6)
+        {
+            break;
+        }
+        
+        /* sleep until the earliest deadline */
+        fleet->delay_ms(next_ready - timestamp);
+        timestamp = next_ready;
+    }
+    
+    /* check every sensor */
+    for (i = 0; i < fleet->num; i++)
+    {
+        if (fleet->sensor[i].result != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_fleet.h
+ * @brief     driver stcc4 fleet header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_FLEET_H
+#define DRIVER_STCC4_FLEET_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 fleet sensor structure definition
+ */
+typedef struct stcc4_fleet_sensor_s
+{
+    stcc4_handle_t *handle;        /**< pointer to an initialized stcc4 handle */
+    uint32_t ready_ms;             /**< conversion ready deadline */
+    uint8_t pending;               /**< conversion pending flag */
+    uint8_t result;                /**< last status code of the sensor */
+    int16_t co2_ppm;               /**< last co2 ppm */
+    float temperature;             /**< last temperature */
+    float humidity;                /**< last humidity */
+    uint16_t sensor_status;        /**< last sensor status */
+} stcc4_fleet_sensor_t;
+
+/**
+ * @brief stcc4 fleet structure definition
+ */
+typedef struct stcc4_fleet_s
+{
+    stcc4_fleet_sensor_t *sensor;         /**< pointer to a sensor array */
+    uint16_t num;                         /**< sensor number */
+    uint16_t pending;                     /**< pending conversion number */
+    void (*delay_ms)(uint32_t ms);        /**< point to a delay_ms function address */
+} stcc4_fleet_t;
+
+/**
+ * @brief     fleet example init
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] *sensor pointer to a sensor array with linked handles
+ * @param[in] num sensor number
+ * @param[in] *delay_ms pointer to a delay_ms function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every sensor[i].handle must be initialized by stcc4_init before
+ */
+uint8_t stcc4_fleet_init(stcc4_fleet_t *fleet, stcc4_fleet_sensor_t *sensor, uint16_t num, void (*delay_ms)(uint32_t ms));
+
+/**
+ * @brief     fleet example start the single shot conversion of every sensor
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] timestamp_ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      sensors failing to start are marked in sensor[i].result and not polled
+ */
+uint8_t stcc4_fleet_start(stcc4_fleet_t *fleet, uint32_t timestamp_ms);
+
+/**
+ * @brief      fleet example collect the finished conversions
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *next_ready_ms pointer to the earliest pending deadline buffer
+ * @return     status code
+ *             - 0 all conversions are collected
+ *             - 6 conversions are pending
+ * @note       none
+ */
+uint8_t stcc4_fleet_poll(stcc4_fleet_t *fleet, uint32_t timestamp_ms, uint32_t *next_ready_ms);
+
+/**
+ * @brief     fleet example run one full measurement cycle
+ * @param[in] *fleet pointer to a fleet structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      returns 1 when any sensor failed, check sensor[i].result for details
+ */
+uint8_t stcc4_fleet_read(stcc4_fleet_t *fleet);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,341 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_log.c
+ * @brief     driver stcc4 log source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_log.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief log file definition
+ */
+#define LOG_MAGIC               0x34435453U                                                    /**< "STC4" */
+#define LOG_RECORD_SIZE         12                                                             /**< record size */
+#define LOG_BATCH_SIZE          ((uint64_t)STCC4_LOG_BATCH * LOG_RECORD_SIZE)                 /**< batch size */
+
+/**
+ * @brief log header structure definition
+ */
+typedef struct log_header_s
+{
+    uint32_t magic;                /**< file magic */
+    uint16_t version;              /**< file format version */
+    uint16_t record_size;          /**< record size */
+} log_header_t;
+
+/**
+ * @brief log record size check definition
+ */
+typedef char log_record_size_check_t[(sizeof(stcc4_log_record_t) == LOG_RECORD_SIZE) ? 1 : -1];
+
+/**
+ * @brief log batch alignment check definition
+ */
+typedef char log_batch_align_check_t[((LOG_BATCH_SIZE % STCC4_LOG_PAGE_SIZE) == 0) ? 1 : -1];
+
+/**
+ * @brief     check a log header
+ * @param[in] *header pointer to a header structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_stcc4_log_check_header(const log_header_t *header)
+{
+    if ((header->magic != LOG_MAGIC) || (header->version != STCC4_LOG_VERSION) || 
+        (header->record_size != LOG_RECORD_SIZE))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     log example open a file for append
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      a new file gets a header page, a trailing part batch is reloaded so writes stay page aligned
+ */
+uint8_t stcc4_log_open(stcc4_log_writer_t *writer, const char *path)
+{
+    uint8_t page[STCC4_LOG_PAGE_SIZE];
+    log_header_t header;
+    struct stat st;
+    uint64_t data;
+    uint64_t tail;
+    
+    if ((writer == NULL) || (path == NULL))
+    {
+        return 1;
+    }
+    
+    /* open */
+    writer->fd = open(path, O_CREAT | O_RDWR, 0644);
+    if (writer->fd < 0)
+    {
+        return 1;
+    }
+    if (fstat(writer->fd, &st) != 0)
+    {
+        (void)close(writer->fd);
+        
+        return 1;
+    }
+    
+    if (st.st_size == 0)
+    {
+        /* write the header page */
+        memset(page, 0, STCC4_LOG_PAGE_SIZE);
+        header.magic = LOG_MAGIC;
+        header.version = STCC4_LOG_VERSION;
+        header.record_size = LOG_RECORD_SIZE;
+        memcpy(page, &header, sizeof(log_header_t));
+        if (pwrite(writer->fd, page, STCC4_LOG_PAGE_SIZE, 0) != STCC4_LOG_PAGE_SIZE)
+        {
+            (void)close(writer->fd);
+            
+            return 1;
+        }
+        data = 0;
+    }
+    else
+    {
+        /* check the header */
+        if ((st.st_size < STCC4_LOG_PAGE_SIZE) ||
+            (pread(writer->fd, &header, sizeof(log_header_t), 0) != (ssize_t)sizeof(log_header_t)) ||
+            (a_stcc4_log_check_header(&header) != 0))
+        {
+            (void)close(writer->fd);
+            
+            return 1;
+        }
+        data = ((uint64_t)st.st_size - STCC4_LOG_PAGE_SIZE) / LOG_RECORD_SIZE * LOG_RECORD_SIZE;
+    }
+    
+    /* reload the part batch at the end */
+    writer->offset = STCC4_LOG_PAGE_SIZE + data / LOG_BATCH_SIZE * LOG_BATCH_SIZE;
+    tail = data % LOG_BATCH_SIZE;
+    writer->num = (uint32_t)(tail / LOG_RECORD_SIZE);
+    if ((tail != 0) && (pread(writer->fd, writer->batch, (size_t)tail, (off_t)writer->offset) != (ssize_t)tail))
+    {
+        (void)close(writer->fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     log example append a record
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] *record pointer to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 append failed
+ * @note      the file is written once per STCC4_LOG_BATCH records, when that write failed
+ *            the record is not stored until a retried flush succeeds
+ */
+uint8_t stcc4_log_append(stcc4_log_writer_t *writer, const stcc4_log_record_t *record)
+{
+    if ((writer == NULL) || (record == NULL))
+    {
+        return 1;
+    }
+    
+    /* a full batch left by a failed flush is retried first */
+    if ((writer->num >= STCC4_LOG_BATCH) && (stcc4_log_flush(writer) != 0))
+    {
+        return 1;
+    }
+    writer->batch[writer->num++] = *record;
+    if (writer->num == STCC4_LOG_BATCH)
+    {
+        return stcc4_log_flush(writer);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     log example write the buffered records
+ * @param[in] *writer pointer to a writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      a part batch is rewritten in place by the next flush
+ */
+uint8_t stcc4_log_flush(stcc4_log_writer_t *writer)
+{
+    size_t len;
+    
+    if (writer == NULL)
+    {
+        return 1;
+    }
+    if (writer->num == 0)
+    {
+        return 0;
+    }
+    
+    /* write the batch from its page aligned start */
+    len = (size_t)writer->num * LOG_RECORD_SIZE;
+    if (pwrite(writer->fd, writer->batch, len, (off_t)writer->offset) != (ssize_t)len)
+    {
+        return 1;
+    }
+    
+    /* a full batch moves on */
+    if (writer->num == STCC4_LOG_BATCH)
+    {
+        writer->offset += LOG_BATCH_SIZE;
+        writer->num = 0;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     log example flush and close the file
+ * @param[in] *writer pointer to a writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t stcc4_log_close(stcc4_log_writer_t *writer)
+{
+    uint8_t res;
+    
+    if (writer == NULL)
+    {
+        return 1;
+    }
+    
+    res = stcc4_log_flush(writer);
+    if (close(writer->fd) != 0)
+    {
+        res = 1;
+    }
+    writer->fd = -1;
+    
+    return res;
+}
+
+/**
+ * @brief     log example map a file for reading
+ * @param[in] *reader pointer to a reader structure
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 map failed
+ * @note      the records are read in place from reader->record, a torn last record is ignored
+ */
+uint8_t stcc4_log_map(stcc4_log_reader_t *reader, const char *path)
+{
+    struct stat st;
+    int fd;
+    
+    if ((reader == NULL) || (path == NULL))
+    {
+        return 1;
+    }
+    
+    /* map the whole file */
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    if ((fstat(fd, &st) != 0) || (st.st_size < STCC4_LOG_PAGE_SIZE))
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    reader->size = (uint64_t)st.st_size;
+    reader->map = mmap(NULL, (size_t)reader->size, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (reader->map == MAP_FAILED)
+    {
+        return 1;
+    }
+    if (a_stcc4_log_check_header((const log_header_t *)reader->map) != 0)
+    {
+        (void)munmap(reader->map, (size_t)reader->size);
+        
+        return 1;
+    }
+    
+    /* records follow the header page */
+    (void)madvise(reader->map, (size_t)reader->size, MADV_SEQUENTIAL);
+    reader->record = (const stcc4_log_record_t *)((const uint8_t *)reader->map + STCC4_LOG_PAGE_SIZE);
+    reader->num = (uint32_t)((reader->size - STCC4_LOG_PAGE_SIZE) / LOG_RECORD_SIZE);
+    
+    return 0;
+}
+
+/**
+ * @brief     log example unmap a file
+ * @param[in] *reader pointer to a reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 unmap failed
+ * @note      none
+ */
+uint8_t stcc4_log_unmap(stcc4_log_reader_t *reader)
+{
+    if ((reader == NULL) || (reader->map == NULL))
+    {
+        return 1;
+    }
+    
+    if (munmap(reader->map, (size_t)reader->size) != 0)
+    {
+        return 1;
+    }
+    reader->map = NULL;
+    reader->record = NULL;
+    reader->num = 0;
+    
+    return 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_log.h
+ * @brief     driver stcc4 log header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_LOG_H
+#define DRIVER_STCC4_LOG_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 log definition
+ * @note  one batch is 1024 records of 12 bytes, exactly 3 pages, so every write starts on a page
+ */
+#define STCC4_LOG_PAGE_SIZE        4096        /**< file header and write alignment */
+#define STCC4_LOG_BATCH            1024        /**< records per write */
+#define STCC4_LOG_VERSION          1           /**< file format version */
+
+/**
+ * @brief     map a sensor status word to the record status byte
+ * @param[in] STATUS sensor status word read by stcc4_read
+ * @note      the flags are in the high byte, the testing mode bit 0x4000 is kept as 0x40
+ */
+#define STCC4_LOG_STATUS(STATUS)    ((uint8_t)(((STATUS) >> 8) & 0xFF))
+
+/**
+ * @brief stcc4 log record structure definition
+ * @note  12 bytes little endian, the high byte of the sensor status is kept, see STCC4_LOG_STATUS
+ */
+typedef struct stcc4_log_record_s
+{
+    uint32_t timestamp;               /**< unix time in s */
+    int16_t co2_raw;                  /**< co2 raw */
+    uint16_t temperature_raw;         /**< temperature raw */
+    uint16_t humidity_raw;            /**< humidity raw */
+    uint8_t sensor_id;                /**< sensor id */
+    uint8_t sensor_status;            /**< sensor status high byte */
+} stcc4_log_record_t;
+
+/**
+ * @brief stcc4 log writer structure definition
+ */
+typedef struct stcc4_log_writer_s
+{
+    int fd;                                                /**< file descriptor */
+    uint64_t offset;                                       /**< file offset of the batch */
+    uint32_t num;                                          /**< records in the batch */
+    stcc4_log_record_t batch[STCC4_LOG_BATCH];             /**< batch buffer */
+} stcc4_log_writer_t;
+
+/**
+ * @brief stcc4 log reader structure definition
+ */
+typedef struct stcc4_log_reader_s
+{
+    void *map;                                  /**< mapped file */
+    uint64_t size;                              /**< mapped size */
+    const stcc4_log_record_t *record;           /**< pointer to the first record */
+    uint32_t num;                               /**< record number */
+} stcc4_log_reader_t;
+
+/**
+ * @brief     log example open a file for append
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      a new file gets a header page, a trailing part batch is reloaded so writes stay page aligned
+ */
+uint8_t stcc4_log_open(stcc4_log_writer_t *writer, const char *path);
+
+/**
+ * @brief     log example append a record
+ * @param[in] *writer pointer to a writer structure
+ * @param[in] *record pointer to a record structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 append failed
+ * @note      the file is written once per STCC4_LOG_BATCH records, when that write failed
+ *            the record is not stored until a retried flush succeeds
+ */
+uint8_t stcc4_log_append(stcc4_log_writer_t *writer, const stcc4_log_record_t *record);
+
+/**
+ * @brief     log example write the buffered records
+ * @param[in] *writer pointer to a writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      a part batch is rewritten in place by the next flush
+ */
+uint8_t stcc4_log_flush(stcc4_log_writer_t *writer);
+
+/**
+ * @brief     log example flush and close the file
+ * @param[in] *writer pointer to a writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t stcc4_log_close(stcc4_log_writer_t *writer);
+
+/**
+ * @brief     log example map a file for reading
+ * @param[in] *reader pointer to a reader structure
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 map failed
+ * @note      the records are read in place from reader->record, a torn last record is ignored
+ */
+uint8_t stcc4_log_map(stcc4_log_reader_t *reader, const char *path);
+
+/**
+ * @brief     log example unmap a file
+ * @param[in] *reader pointer to a reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 unmap failed
+ * @note      none
+ */
+uint8_t stcc4_log_unmap(stcc4_log_reader_t *reader);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_periodic.c
+ * @brief     driver stcc4 periodic source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_periodic.h"
+
+/**
+ * @brief     periodic example init
+ * @param[in] *periodic pointer to a periodic structure
+ * @param[in] period_ms sample period in ms
+ * @param[in] *timestamp_us pointer to a monotonic timestamp_us function address
+ * @param[in] *sleep_until_us pointer to an absolute sleep_until_us function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the first deadline is one period after the init
+ */
+uint8_t stcc4_periodic_init(stcc4_periodic_t *periodic, uint32_t period_ms,
+                            uint32_t (*timestamp_us)(void), void (*sleep_until_us)(uint32_t deadline_us))
+{
+    if ((periodic == NULL) || (timestamp_us == NULL) || (sleep_until_us == NULL))
+    {
+        return 1;
+    }
+    if ((period_ms == 0) || (period_ms > 0x7FFFFFFFU / 1000U))
+    {
+        return 1;
+    }
+    
+    /* set the period */
+    memset(periodic, 0, sizeof(stcc4_periodic_t));
+    periodic->timestamp_us = timestamp_us;
+    periodic->sleep_until_us = sleep_until_us;
+    periodic->period_us = period_ms * 1000U;
+    
+    /* the first deadline */
+    periodic->deadline_us = timestamp_us() + periodic->period_us;
+    
+    return 0;
+}
+
+/**
+ * @brief     periodic example wait for the next deadline
+ * @param[in] *periodic pointer to a periodic structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ * @note      deadlines are absolute, the work between two waits does not shift the phase,
+ *            deadlines already passed are counted as missed and skipped
+ */
+uint8_t stcc4_periodic_wait(stcc4_periodic_t *periodic)
+{
+    int32_t late;
+    uint32_t skip;
+    
+    if ((periodic == NULL) || (periodic->period_us == 0))
+    {
+        return 1;
+    }
+    
+    /* skip the passed deadlines and keep the phase */
+    late = (int32_t)(periodic->timestamp_us() - periodic->deadline_us);
+    if (late > 0)
+    {
+        skip = (uint32_t)late / periodic->period_us + 1;
+        periodic->missed += skip;
+        periodic->deadline_us += skip * periodic->period_us;
+    }
+    
+    /* sleep to the absolute deadline */
+    periodic->sleep_until_us(periodic->deadline_us);
+    
+    /* wake up lateness */
+    late = (int32_t)(periodic->timestamp_us() - periodic->deadline_us);
+    if ((periodic->samples == 0) || (late < periodic->jitter_min_us))
+    {
+        periodic->jitter_min_us = late;
+    }
+    if ((periodic->samples == 0) || (late > periodic->jitter_max_us))
+    {
+        periodic->jitter_max_us = late;
+    }
+    periodic->jitter_sum_us += late;
+    periodic->samples++;
+    
+    /* the next deadline */
+    periodic->deadline_us += periodic->period_us;
+    
+    return 0;
+}
+
+/**
+ * @brief      periodic example get the jitter and missed deadline stats
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *stats pointer to a periodic stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       none
+ */
+uint8_t stcc4_periodic_get_stats(stcc4_periodic_t *periodic, stcc4_periodic_stats_t *stats)
+{
+    if ((periodic == NULL) || (stats == NULL))
+    {
+        return 1;
+    }
+    
+    stats->samples = periodic->samples;
+    stats->missed = periodic->missed;
+    stats->jitter_min_us = periodic->jitter_min_us;
+    stats->jitter_max_us = periodic->jitter_max_us;
+    stats->jitter_mean_us = (periodic->samples != 0) ? (int32_t)(periodic->jitter_sum_us / (int64_t)periodic->samples) : 0;
+    
+    return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_periodic.h
+ * @brief     driver stcc4 periodic header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_PERIODIC_H
+#define DRIVER_STCC4_PERIODIC_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 periodic structure definition
+ */
+typedef struct stcc4_periodic_s
+{
+    uint32_t (*timestamp_us)(void);                   /**< point to a monotonic timestamp_us function address */
+    void (*sleep_until_us)(uint32_t deadline_us);     /**< point to an absolute sleep_until_us function address */
+    uint32_t period_us;                               /**< sample period in us */
+    uint32_t deadline_us;                             /**< next absolute deadline in us */
+    uint32_t samples;                                 /**< released samples */
+    uint32_t missed;                                  /**< skipped deadlines */
+    int32_t jitter_min_us;                            /**< min wake up lateness in us */
+    int32_t jitter_max_us;                            /**< max wake up lateness in us */
+    int64_t jitter_sum_us;                            /**< sum of the wake up lateness in us */
+} stcc4_periodic_t;
+
+/**
+ * @brief stcc4 periodic stats structure definition
+ */
+typedef struct stcc4_periodic_stats_s
+{
+    uint32_t samples;              /**< released samples */
+    uint32_t missed;               /**< skipped deadlines */
+    int32_t jitter_min_us;         /**< min wake up lateness in us */
+    int32_t jitter_max_us;         /**< max wake up lateness in us */
+    int32_t jitter_mean_us;        /**< mean wake up lateness in us */
+} stcc4_periodic_stats_t;
+
+/**
+ * @brief     periodic example init
+ * @param[in] *periodic pointer to a periodic structure
+ * @param[in] period_ms sample period in ms
+ * @param[in] *timestamp_us pointer to a monotonic timestamp_us function address
+ * @param[in] *sleep_until_us pointer to an absolute sleep_until_us function address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the first deadline is one period after the init
+ */
+uint8_t stcc4_periodic_init(stcc4_periodic_t *periodic, uint32_t period_ms,
+                            uint32_t (*timestamp_us)(void), void (*sleep_until_us)(uint32_t deadline_us));
+
+/**
+ * @brief     periodic example wait for the next deadline
+ * @param[in] *periodic pointer to a periodic structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ * @note      deadlines are absolute, the work between two waits does not shift the phase,
+ *            deadlines already passed are counted as missed and skipped
+ */
+uint8_t stcc4_periodic_wait(stcc4_periodic_t *periodic);
+
+/**
+ * @brief      periodic example get the jitter and missed deadline stats
+ * @param[in]  *periodic pointer to a periodic structure
+ * @param[out] *stats pointer to a periodic stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       none
+ */
+uint8_t stcc4_periodic_get_stats(stcc4_periodic_t *periodic, stcc4_periodic_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
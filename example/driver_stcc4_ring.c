@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_ring.c
+ * @brief     driver stcc4 ring source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_ring.h"
+
+/**
+ * @brief ring index load and store definition
+ * @note  the producer publishes head with release and the consumer publishes tail with release,
+ *        the peer side loads them with acquire, the fallback is only safe on a single core
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define RING_LOAD_ACQUIRE(p)            __atomic_load_n((p), __ATOMIC_ACQUIRE)        /**< acquire load */
+    #define RING_LOAD_RELAXED(p)            __atomic_load_n((p), __ATOMIC_RELAXED)        /**< relaxed load */
+    #define RING_STORE_RELEASE(p, v)        __atomic_store_n((p), (v), __ATOMIC_RELEASE)  /**< release store */
+    #define RING_STORE_RELAXED(p, v)        __atomic_store_n((p), (v), __ATOMIC_RELAXED)  /**< relaxed store */
+#else
+    #define RING_LOAD_ACQUIRE(p)            (*(volatile uint32_t *)(p))                   /**< acquire load */
+    #define RING_LOAD_RELAXED(p)            (*(volatile uint32_t *)(p))                   /**< relaxed load */
+    #define RING_STORE_RELEASE(p, v)        (*(volatile uint32_t *)(p) = (v))             /**< release store */
+    #define RING_STORE_RELAXED(p, v)        (*(volatile uint32_t *)(p) = (v))             /**< relaxed store */
+#endif
+
+/**
+ * @brief ring index mask definition
+ */
+#define RING_MASK        (STCC4_RING_SIZE - 1U)        /**< index mask */
+
+/**
+ * @brief     ring example init
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      call it before the producer and the consumer start
+ */
+uint8_t stcc4_ring_init(stcc4_ring_t *ring)
+{
+    if (ring == NULL)
+    {
+        return 1;
+    }
+    
+    /* clear all */
+    memset(ring, 0, sizeof(stcc4_ring_t));
+    
+    return 0;
+}
+
+/**
+ * @brief     ring example push one sample
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full or push failed, a full ring drops the sample and counts an overrun
+ * @note      producer thread only
+ */
+uint8_t stcc4_ring_push(stcc4_ring_t *ring, const stcc4_ring_sample_t *sample)
+{
+    uint32_t head;
+    
+    if ((ring == NULL) || (sample == NULL))                                      /* check the param */
+    {
+        return 1;                                                                /* return error */
+    }
+    head = ring->head;                                                           /* only the producer writes head */
+    if ((head - ring->tail_cache) >= STCC4_RING_SIZE)                            /* full by the cached tail */
+    {
+        ring->tail_cache = RING_LOAD_ACQUIRE(&ring->tail);                       /* refresh the tail */
+        if ((head - ring->tail_cache) >= STCC4_RING_SIZE)                        /* still full */
+        {
+            RING_STORE_RELAXED(&ring->overrun, ring->overrun + 1);               /* drop the newest sample */
+            
+            return 1;
+        }
+    }
+    ring->sample[head & RING_MASK] = *sample;                                    /* fill the slot */
+    RING_STORE_RELEASE(&ring->head, head + 1);                                   /* publish the slot */
+    
+    return 0;
+}
+
+/**
+ * @brief      ring example pop up to len samples
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *sample pointer to a sample array
+ * @param[in]  len max sample number
+ * @param[out] *num pointer to a popped sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty or pop failed
+ * @note       consumer thread only, one acquire load and one release store per batch
+ */
+uint8_t stcc4_ring_pop(stcc4_ring_t *ring, stcc4_ring_sample_t *sample, uint32_t len, uint32_t *num)
+{
+    uint32_t tail;
+    uint32_t count;
+    uint32_t i;
+    
+    if ((ring == NULL) || (sample == NULL) || (num == NULL))                     /* check the param */
+    {
+        return 1;                                                                /* return error */
+    }
+    *num = 0;                                                                    /* init 0 */
+    tail = ring->tail;                                                           /* only the consumer writes tail */
+    if ((ring->head_cache - tail) < len)                                         /* short by the cached head */
+    {
+        ring->head_cache = RING_LOAD_ACQUIRE(&ring->head);                       /* refresh the head */
+        if (ring->head_cache == tail)                                            /* still empty */
+        {
+            return 1;
+        }
+    }
+    count = ring->head_cache - tail;                                             /* available samples */
+    if (count > len)                                                             /* limit to the buffer */
+    {
+        count = len;                                                             /* set len */
+    }
+    for (i = 0; i < count; i++)                                                  /* copy the batch */
+    {
+        sample[i] = ring->sample[(tail + i) & RING_MASK];                        /* copy one */
+    }
+    RING_STORE_RELEASE(&ring->tail, tail + count);                               /* release the slots */
+    *num = count;                                                                /* set the number */
+    
+    return 0;
+}
+
+/**
+ * @brief      ring example get the dropped sample number
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *overrun pointer to an overrun buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get overrun failed
+ * @note       any thread, the value may lag the producer
+ */
+uint8_t stcc4_ring_get_overrun(stcc4_ring_t *ring, uint32_t *overrun)
+{
+    if ((ring == NULL) || (overrun == NULL))
+    {
+        return 1;
+    }
+    
+    *overrun = RING_LOAD_RELAXED(&ring->overrun);                                /* get the overrun */
+    
+    return 0;
+}
@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_ring.h
+ * @brief     driver stcc4 ring header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_RING_H
+#define DRIVER_STCC4_RING_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 ring size definition
+ * @note  must be a power of 2, override it in the compiler flags
+ */
+#ifndef STCC4_RING_SIZE
+    #define STCC4_RING_SIZE        64        /**< 64 samples */
+#endif
+
+/**
+ * @brief stcc4 ring cache line size definition
+ */
+#ifndef STCC4_RING_CACHE_LINE
+    #define STCC4_RING_CACHE_LINE        64        /**< 64 bytes */
+#endif
+
+#if ((STCC4_RING_SIZE < 2) || ((STCC4_RING_SIZE & (STCC4_RING_SIZE - 1)) != 0))
+    #error "STCC4_RING_SIZE must be a power of 2"
+#endif
+
+/**
+ * @brief stcc4 ring sample structure definition
+ */
+typedef struct stcc4_ring_sample_s
+{
+    uint32_t timestamp_us;            /**< acquisition timestamp in us */
+    int16_t co2_raw;                  /**< co2 raw */
+    int16_t co2_ppm;                  /**< co2 ppm */
+    uint16_t temperature_raw;         /**< temperature raw */
+    uint16_t humidity_raw;            /**< humidity raw */
+    uint16_t sensor_status;           /**< sensor status */
+    uint16_t reserved;                /**< pad to 16 bytes */
+} stcc4_ring_sample_t;
+
+/**
+ * @brief stcc4 ring structure definition
+ * @note  the producer and the consumer fields live on their own cache lines
+ */
+typedef struct stcc4_ring_s
+{
+    uint32_t head;                                                  /**< producer write index */
+    uint32_t tail_cache;                                            /**< producer copy of the tail */
+    uint32_t overrun;                                               /**< samples dropped on a full ring */
+    uint8_t pad0[STCC4_RING_CACHE_LINE - 3 * sizeof(uint32_t)];     /**< producer line padding */
+    uint32_t tail;                                                  /**< consumer read index */
+    uint32_t head_cache;                                            /**< consumer copy of the head */
+    uint8_t pad1[STCC4_RING_CACHE_LINE - 2 * sizeof(uint32_t)];     /**< consumer line padding */
+    stcc4_ring_sample_t sample[STCC4_RING_SIZE];                    /**< sample slots */
+}
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((aligned(STCC4_RING_CACHE_LINE)))
+#endif
+stcc4_ring_t;
+
+/**
+ * @brief     ring example init
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      call it before the producer and the consumer start
+ */
+uint8_t stcc4_ring_init(stcc4_ring_t *ring);
+
+/**
+ * @brief     ring example push one sample
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full or push failed, a full ring drops the sample and counts an overrun
+ * @note      producer thread only
+ */
+uint8_t stcc4_ring_push(stcc4_ring_t *ring, const stcc4_ring_sample_t *sample);
+
+/**
+ * @brief      ring example pop up to len samples
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *sample pointer to a sample array
+ * @param[in]  len max sample number
+ * @param[out] *num pointer to a popped sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty or pop failed
+ * @note       consumer thread only, one acquire load and one release store per batch
+ */
+uint8_t stcc4_ring_pop(stcc4_ring_t *ring, stcc4_ring_sample_t *sample, uint32_t len, uint32_t *num);
+
+/**
+ * @brief      ring example get the dropped sample number
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *overrun pointer to an overrun buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get overrun failed
+ * @note       any thread, the value may lag the producer
+ */
+uint8_t stcc4_ring_get_overrun(stcc4_ring_t *ring, uint32_t *overrun);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
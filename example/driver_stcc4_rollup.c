@@ -0,0 +1,338 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_rollup.c
+ * @brief     driver stcc4 rollup source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_rollup.h"
+
+/**
+ * @brief      load the open bucket of a level
+ * @param[in]  *level pointer to a level structure
+ * @param[in]  sensor sensor index
+ * @param[out] *bucket pointer to a bucket structure
+ * @note       none
+ */
+static void a_stcc4_rollup_load(const stcc4_rollup_level_t *level, uint16_t sensor, stcc4_rollup_bucket_t *bucket)
+{
+    uint8_t c;
+    
+    bucket->start = level->start[sensor];
+    bucket->width = level->width;
+    bucket->count = level->count[sensor];
+    for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+    {
+        bucket->min[c] = level->min[c][sensor];
+        bucket->max[c] = level->max[c][sensor];
+        bucket->last[c] = level->last[c][sensor];
+        bucket->sum[c] = level->sum[c][sensor];
+        bucket->mean[c] = (int32_t)(bucket->sum[c] / (int64_t)bucket->count);
+    }
+}
+
+/**
+ * @brief         fold a newer bucket into a bucket
+ * @param[in,out] *dst pointer to a bucket structure
+ * @param[in]     *src pointer to a newer bucket structure
+ * @note          the mean is not updated
+ */
+static void a_stcc4_rollup_fold(stcc4_rollup_bucket_t *dst, const stcc4_rollup_bucket_t *src)
+{
+    uint8_t c;
+    
+    for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+    {
+        if ((dst->count == 0) || (src->min[c] < dst->min[c]))
+        {
+            dst->min[c] = src->min[c];
+        }
+        if ((dst->count == 0) || (src->max[c] > dst->max[c]))
+        {
+            dst->max[c] = src->max[c];
+        }
+        dst->last[c] = src->last[c];
+        dst->sum[c] += src->sum[c];
+    }
+    dst->count += src->count;
+}
+
+static void a_stcc4_rollup_merge(stcc4_rollup_t *rollup, uint8_t l, uint16_t sensor, const stcc4_rollup_bucket_t *bucket);
+
+/**
+ * @brief     close the open bucket of a level
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] l level index
+ * @param[in] sensor sensor index
+ * @note      the bucket is emitted and merged into the next coarser level
+ */
+static void a_stcc4_rollup_close(stcc4_rollup_t *rollup, uint8_t l, uint16_t sensor)
+{
+    stcc4_rollup_bucket_t bucket;
+    
+    a_stcc4_rollup_load(&rollup->level[l], sensor, &bucket);
+    rollup->level[l].count[sensor] = 0;
+    if (rollup->emit != NULL)
+    {
+        rollup->emit(l, sensor, &bucket);
+    }
+    if (l + 1 < rollup->levels)
+    {
+        a_stcc4_rollup_merge(rollup, (uint8_t)(l + 1), sensor, &bucket);
+    }
+}
+
+/**
+ * @brief     merge a closed finer bucket into a level
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] l level index
+ * @param[in] sensor sensor index
+ * @param[in] *bucket pointer to a closed bucket structure
+ * @note      none
+ */
+static void a_stcc4_rollup_merge(stcc4_rollup_t *rollup, uint8_t l, uint16_t sensor, const stcc4_rollup_bucket_t *bucket)
+{
+    stcc4_rollup_level_t *level = &rollup->level[l];
+    uint32_t start;
+    uint8_t c;
+    
+    start = bucket->start - bucket->start % level->width;
+    if ((level->count[sensor] != 0) && (level->start[sensor] != start))
+    {
+        a_stcc4_rollup_close(rollup, l, sensor);
+    }
+    if (level->count[sensor] == 0)
+    {
+        level->start[sensor] = start;
+        for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+        {
+            level->min[c][sensor] = bucket->min[c];
+            level->max[c][sensor] = bucket->max[c];
+            level->sum[c][sensor] = 0;
+        }
+    }
+    for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+    {
+        if (bucket->min[c] < level->min[c][sensor])
+        {
+            level->min[c][sensor] = bucket->min[c];
+        }
+        if (bucket->max[c] > level->max[c][sensor])
+        {
+            level->max[c][sensor] = bucket->max[c];
+        }
+        level->last[c][sensor] = bucket->last[c];
+        level->sum[c][sensor] += bucket->sum[c];
+    }
+    level->count[sensor] += bucket->count;
+}
+
+/**
+ * @brief     rollup example init
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] sensors sensor number
+ * @param[in] *width pointer to a bucket width array in s, finest first
+ * @param[in] levels level number
+ * @param[in] *emit pointer to a closed bucket function address, it can be NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every width must be a multiple of the finer one, e.g. 60 and 3600
+ */
+uint8_t stcc4_rollup_init(stcc4_rollup_t *rollup, uint16_t sensors, const uint32_t *width, uint8_t levels,
+                          void (*emit)(uint8_t level, uint16_t sensor, const stcc4_rollup_bucket_t *bucket))
+{
+    uint8_t l;
+    
+    if ((rollup == NULL) || (width == NULL))
+    {
+        return 1;
+    }
+    if ((sensors == 0) || (sensors > STCC4_ROLLUP_SENSORS) || (levels == 0) || (levels > STCC4_ROLLUP_LEVELS))
+    {
+        return 1;
+    }
+    for (l = 0; l < levels; l++)
+    {
+        if ((width[l] == 0) || ((l != 0) && ((width[l] <= width[l - 1]) || ((width[l] % width[l - 1]) != 0))))
+        {
+            return 1;
+        }
+    }
+    
+    /* set the levels */
+    memset(rollup, 0, sizeof(stcc4_rollup_t));
+    rollup->sensors = sensors;
+    rollup->levels = levels;
+    rollup->emit = emit;
+    for (l = 0; l < levels; l++)
+    {
+        rollup->level[l].width = width[l];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     rollup example add a sample
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] sensor sensor index
+ * @param[in] timestamp sample time in s
+ * @param[in] co2_ppm co2 in ppm
+ * @param[in] temperature_mdeg temperature in 0.001 degrees
+ * @param[in] humidity_mpercentage humidity in 0.001 %
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed or the sample is older than the open bucket
+ * @note      only the finest level is touched per sample, a coarser level is merged when a finer bucket closes,
+ *            feed it from stcc4_read_fixed
+ */
+uint8_t stcc4_rollup_update(stcc4_rollup_t *rollup, uint16_t sensor, uint32_t timestamp,
+                            int32_t co2_ppm, int32_t temperature_mdeg, int32_t humidity_mpercentage)
+{
+    stcc4_rollup_level_t *level;
+    int32_t value[STCC4_ROLLUP_CHANNEL_MAX];
+    uint32_t start;
+    uint8_t c;
+    
+    if ((rollup == NULL) || (sensor >= rollup->sensors))
+    {
+        return 1;
+    }
+    
+    /* close the finest bucket when the sample leaves it */
+    level = &rollup->level[0];
+    start = timestamp - timestamp % level->width;
+    if (level->count[sensor] != 0)
+    {
+        if (start < level->start[sensor])
+        {
+            return 1;
+        }
+        if (start != level->start[sensor])
+        {
+            a_stcc4_rollup_close(rollup, 0, sensor);
+        }
+    }
+    
+    /* accumulate */
+    value[STCC4_ROLLUP_CHANNEL_CO2] = co2_ppm;
+    value[STCC4_ROLLUP_CHANNEL_TEMPERATURE] = temperature_mdeg;
+    value[STCC4_ROLLUP_CHANNEL_HUMIDITY] = humidity_mpercentage;
+    if (level->count[sensor] == 0)
+    {
+        level->start[sensor] = start;
+        for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+        {
+            level->min[c][sensor] = value[c];
+            level->max[c][sensor] = value[c];
+            level->sum[c][sensor] = 0;
+        }
+    }
+    for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+    {
+        if (value[c] < level->min[c][sensor])
+        {
+            level->min[c][sensor] = value[c];
+        }
+        if (value[c] > level->max[c][sensor])
+        {
+            level->max[c][sensor] = value[c];
+        }
+        level->last[c][sensor] = value[c];
+        level->sum[c][sensor] += value[c];
+    }
+    level->count[sensor]++;
+    
+    return 0;
+}
+
+/**
+ * @brief      rollup example get the open bucket of a level
+ * @param[in]  *rollup pointer to a rollup structure
+ * @param[in]  level level index
+ * @param[in]  sensor sensor index
+ * @param[out] *bucket pointer to a bucket structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 query failed
+ * @note       the open finer buckets are folded in, no history is scanned, count is 0 before the first sample
+ */
+uint8_t stcc4_rollup_query(stcc4_rollup_t *rollup, uint8_t level, uint16_t sensor, stcc4_rollup_bucket_t *bucket)
+{
+    stcc4_rollup_bucket_t open;
+    uint32_t width;
+    uint32_t target;
+    uint8_t l;
+    uint8_t c;
+    
+    if ((rollup == NULL) || (bucket == NULL) || (level >= rollup->levels) || (sensor >= rollup->sensors))
+    {
+        return 1;
+    }
+    
+    /* the newest sample decides which bucket is open */
+    memset(bucket, 0, sizeof(stcc4_rollup_bucket_t));
+    width = rollup->level[level].width;
+    bucket->width = width;
+    for (l = 0; l <= level; l++)
+    {
+        if (rollup->level[l].count[sensor] != 0)
+        {
+            break;
+        }
+    }
+    if (l > level)
+    {
+        return 0;
+    }
+    target = rollup->level[l].start[sensor] - rollup->level[l].start[sensor] % width;
+    bucket->start = target;
+    
+    /* fold the open buckets of that period, coarse to fine */
+    l = level;
+    do
+    {
+        if ((rollup->level[l].count[sensor] != 0) && 
+            (rollup->level[l].start[sensor] - rollup->level[l].start[sensor] % width == target))
+        {
+            a_stcc4_rollup_load(&rollup->level[l], sensor, &open);
+            a_stcc4_rollup_fold(bucket, &open);
+        }
+    } while (l-- != 0);
+    for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+    {
+        bucket->mean[c] = (int32_t)(bucket->sum[c] / (int64_t)bucket->count);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_rollup.h
+ * @brief     driver stcc4 rollup header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_ROLLUP_H
+#define DRIVER_STCC4_ROLLUP_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 rollup size definition
+ * @note  override them in the compiler flags
+ */
+#ifndef STCC4_ROLLUP_SENSORS
+    #define STCC4_ROLLUP_SENSORS        256        /**< max sensors */
+#endif
+#ifndef STCC4_ROLLUP_LEVELS
+    #define STCC4_ROLLUP_LEVELS         3          /**< max resolutions */
+#endif
+
+/**
+ * @brief stcc4 rollup channel enumeration definition
+ */
+typedef enum
+{
+    STCC4_ROLLUP_CHANNEL_CO2         = 0x00,        /**< co2 in ppm */
+    STCC4_ROLLUP_CHANNEL_TEMPERATURE = 0x01,        /**< temperature in 0.001 degrees */
+    STCC4_ROLLUP_CHANNEL_HUMIDITY    = 0x02,        /**< humidity in 0.001 % */
+    STCC4_ROLLUP_CHANNEL_MAX         = 0x03,        /**< channel number */
+} stcc4_rollup_channel_t;
+
+/**
+ * @brief stcc4 rollup bucket structure definition
+ */
+typedef struct stcc4_rollup_bucket_s
+{
+    uint32_t start;                                 /**< bucket start in s */
+    uint32_t width;                                 /**< bucket width in s */
+    uint32_t count;                                 /**< sample number */
+    int32_t min[STCC4_ROLLUP_CHANNEL_MAX];          /**< min of each channel */
+    int32_t max[STCC4_ROLLUP_CHANNEL_MAX];          /**< max of each channel */
+    int32_t mean[STCC4_ROLLUP_CHANNEL_MAX];         /**< mean of each channel */
+    int32_t last[STCC4_ROLLUP_CHANNEL_MAX];         /**< last of each channel */
+    int64_t sum[STCC4_ROLLUP_CHANNEL_MAX];          /**< sum of each channel */
+} stcc4_rollup_bucket_t;
+
+/**
+ * @brief stcc4 rollup level structure definition
+ * @note  one array per field, indexed by sensor, so a fleet wide scan of one field is contiguous
+ */
+typedef struct stcc4_rollup_level_s
+{
+    uint32_t width;                                                         /**< bucket width in s */
+    uint32_t start[STCC4_ROLLUP_SENSORS];                                   /**< open bucket start */
+    uint32_t count[STCC4_ROLLUP_SENSORS];                                   /**< open bucket samples */
+    int32_t min[STCC4_ROLLUP_CHANNEL_MAX][STCC4_ROLLUP_SENSORS];            /**< open bucket min */
+    int32_t max[STCC4_ROLLUP_CHANNEL_MAX][STCC4_ROLLUP_SENSORS];            /**< open bucket max */
+    int32_t last[STCC4_ROLLUP_CHANNEL_MAX][STCC4_ROLLUP_SENSORS];           /**< open bucket last */
+    int64_t sum[STCC4_ROLLUP_CHANNEL_MAX][STCC4_ROLLUP_SENSORS];            /**< open bucket sum */
+} stcc4_rollup_level_t;
+
+/**
+ * @brief stcc4 rollup structure definition
+ */
+typedef struct stcc4_rollup_s
+{
+    uint16_t sensors;                                                                        /**< sensor number */
+    uint8_t levels;                                                                          /**< level number */
+    void (*emit)(uint8_t level, uint16_t sensor, const stcc4_rollup_bucket_t *bucket);       /**< point to a closed bucket function address */
+    stcc4_rollup_level_t level[STCC4_ROLLUP_LEVELS];                                         /**< levels, finest first */
+} stcc4_rollup_t;
+
+/**
+ * @brief     rollup example init
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] sensors sensor number
+ * @param[in] *width pointer to a bucket width array in s, finest first
+ * @param[in] levels level number
+ * @param[in] *emit pointer to a closed bucket function address, it can be NULL
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every width must be a multiple of the finer one, e.g. 60 and 3600
+ */
+uint8_t stcc4_rollup_init(stcc4_rollup_t *rollup, uint16_t sensors, const uint32_t *width, uint8_t levels,
+                          void (*emit)(uint8_t level, uint16_t sensor, const stcc4_rollup_bucket_t *bucket));
+
+/**
+ * @brief     rollup example add a sample
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] sensor sensor index
+ * @param[in] timestamp sample time in s
+ * @param[in] co2_ppm co2 in ppm
+ * @param[in] temperature_mdeg temperature in 0.001 degrees
+ * @param[in] humidity_mpercentage humidity in 0.001 %
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed or the sample is older than the open bucket
+ * @note      only the finest level is touched per sample, a coarser level is merged when a finer bucket closes,
+ *            feed it from stcc4_read_fixed
+ */
+uint8_t stcc4_rollup_update(stcc4_rollup_t *rollup, uint16_t sensor, uint32_t timestamp,
+                            int32_t co2_ppm, int32_t temperature_mdeg, int32_t humidity_mpercentage);
+
+/**
+ * @brief      rollup example get the open bucket of a level
+ * @param[in]  *rollup pointer to a rollup structure
+ * @param[in]  level level index
+ * @param[in]  sensor sensor index
+ * @param[out] *bucket pointer to a bucket structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 query failed
+ * @note       the open finer buckets are folded in, no history is scanned, count is 0 before the first sample
+ */
+uint8_t stcc4_rollup_query(stcc4_rollup_t *rollup, uint8_t level, uint16_t sensor, stcc4_rollup_bucket_t *bucket);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_shm.c
+ * @brief     driver stcc4 shm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_shm.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief shm magic definition
+ */
+#define SHM_MAGIC        0x34434353U        /**< "SCC4" */
+
+/**
+ * @brief     shm example create the segment as the only publisher
+ * @param[in] *shm pointer to a shm structure
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      an existing segment is reused so readers keep their mapping across publisher restarts
+ */
+uint8_t stcc4_shm_create(stcc4_shm_t *shm, const char *name)
+{
+    int fd;
+    void *addr;
+    
+    if ((shm == NULL) || (name == NULL))
+    {
+        return 1;
+    }
+    
+    /* create and size the segment */
+    fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    if (ftruncate(fd, sizeof(stcc4_shm_segment_t)) != 0)
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    addr = mmap(NULL, sizeof(stcc4_shm_segment_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED)
+    {
+        return 1;
+    }
+    shm->segment = (stcc4_shm_segment_t *)addr;
+    shm->writer = 1;
+    
+    /* a new segment starts with nothing published */
+    if (__atomic_load_n(&shm->segment->magic, __ATOMIC_ACQUIRE) != SHM_MAGIC)
+    {
+        __atomic_store_n(&shm->segment->sequence, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&shm->segment->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+    }
+    
+    /* an odd sequence is left by a publisher killed in the middle of a write */
+    if ((__atomic_load_n(&shm->segment->sequence, __ATOMIC_RELAXED) & 1) != 0)
+    {
+        __atomic_add_fetch(&shm->segment->sequence, 1, __ATOMIC_RELEASE);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     shm example open the segment as a reader
+ * @param[in] *shm pointer to a shm structure
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the segment is mapped read only
+ */
+uint8_t stcc4_shm_open(stcc4_shm_t *shm, const char *name)
+{
+    int fd;
+    void *addr;
+    struct stat st;
+    
+    if ((shm == NULL) || (name == NULL))
+    {
+        return 1;
+    }
+    
+    /* map the segment read only */
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    if ((fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(stcc4_shm_segment_t)))
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    addr = mmap(NULL, sizeof(stcc4_shm_segment_t), PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED)
+    {
+        return 1;
+    }
+    
+    /* check the magic */
+    if (__atomic_load_n(&((stcc4_shm_segment_t *)addr)->magic, __ATOMIC_ACQUIRE) != SHM_MAGIC)
+    {
+        (void)munmap(addr, sizeof(stcc4_shm_segment_t));
+        
+        return 1;
+    }
+    shm->segment = (stcc4_shm_segment_t *)addr;
+    shm->writer = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     shm example publish a sample
+ * @param[in] *shm pointer to a shm structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      publisher process only, no syscall
+ */
+uint8_t stcc4_shm_publish(stcc4_shm_t *shm, const stcc4_shm_sample_t *sample)
+{
+    uint32_t word[STCC4_SHM_WORDS];
+    uint32_t sequence;
+    uint32_t i;
+    
+    if ((shm == NULL) || (sample == NULL) || (shm->segment == NULL) || (shm->writer == 0))
+    {
+        return 1;
+    }
+    
+    word[STCC4_SHM_WORDS - 1] = 0;                                                   /* clear the tail */
+    memcpy(word, sample, sizeof(stcc4_shm_sample_t));                                /* copy to words */
+    sequence = shm->segment->sequence;                                               /* only the publisher writes it */
+    __atomic_store_n(&shm->segment->sequence, sequence + 1, __ATOMIC_RELAXED);       /* odd, write begins */
+    __atomic_thread_fence(__ATOMIC_RELEASE);                                         /* order before the words */
+    for (i = 0; i < STCC4_SHM_WORDS; i++)                                            /* store the words */
+    {
+        __atomic_store_n(&shm->segment->word[i], word[i], __ATOMIC_RELAXED);         /* store one word */
+    }
+    __atomic_store_n(&shm->segment->sequence, sequence + 2, __ATOMIC_RELEASE);       /* even, write ends */
+    
+    return 0;
+}
+
+/**
+ * @brief      shm example read the latest sample
+ * @param[in]  *shm pointer to a shm structure
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed or nothing is published
+ * @note       any process, no syscall and no store to the segment,
+ *             it only retries while a publish is in progress
+ */
+uint8_t stcc4_shm_read(stcc4_shm_t *shm, stcc4_shm_sample_t *sample)
+{
+    uint32_t word[STCC4_SHM_WORDS];
+    uint32_t begin;
+    uint32_t end;
+    uint32_t i;
+    
+    if ((shm == NULL) || (sample == NULL) || (shm->segment == NULL))
+    {
+        return 1;
+    }
+    
+    do
+    {
+        begin = __atomic_load_n(&shm->segment->sequence, __ATOMIC_ACQUIRE);         /* sequence before */
+        if ((begin & 1) != 0)                                                        /* write in progress */
+        {
+            continue;                                                                /* retry */
+        }
+        for (i = 0; i < STCC4_SHM_WORDS; i++)                                        /* load the words */
+        {
+            word[i] = __atomic_load_n(&shm->segment->word[i], __ATOMIC_RELAXED);     /* load one word */
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);                                     /* order after the words */
+        end = __atomic_load_n(&shm->segment->sequence, __ATOMIC_RELAXED);           /* sequence after */
+        if (begin == end)                                                            /* not torn */
+        {
+            break;                                                                   /* done */
+        }
+    } while (1);
+    if (begin == 0)                                                                  /* nothing is published */
+    {
+        return 1;                                                                    /* return error */
+    }
+    memcpy(sample, word, sizeof(stcc4_shm_sample_t));                                /* copy from words */
+    
+    return 0;
+}
+
+/**
+ * @brief     shm example close the segment
+ * @param[in] *shm pointer to a shm structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the segment name stays until stcc4_shm_unlink
+ */
+uint8_t stcc4_shm_close(stcc4_shm_t *shm)
+{
+    if ((shm == NULL) || (shm->segment == NULL))
+    {
+        return 1;
+    }
+    
+    /* unmap */
+    if (munmap(shm->segment, sizeof(stcc4_shm_segment_t)) != 0)
+    {
+        return 1;
+    }
+    shm->segment = NULL;
+    
+    return 0;
+}
+
+/**
+ * @brief     shm example remove the segment name
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlink failed
+ * @note      mapped readers keep the old segment
+ */
+uint8_t stcc4_shm_unlink(const char *name)
+{
+    if (name == NULL)
+    {
+        return 1;
+    }
+    
+    /* remove the name */
+    if (shm_unlink(name) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
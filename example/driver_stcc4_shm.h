@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      example/driver_stcc4_shm.h
+ * @brief     driver stcc4 shm header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_SHM_H
+#define DRIVER_STCC4_SHM_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_example_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 shm default name definition
+ */
+#ifndef STCC4_SHM_NAME
+    #define STCC4_SHM_NAME        "/stcc4"        /**< posix shared memory name */
+#endif
+
+/**
+ * @brief stcc4 shm sample structure definition
+ */
+typedef struct stcc4_shm_sample_s
+{
+    uint32_t timestamp_us;        /**< publish timestamp in us */
+    uint32_t count;               /**< published sample number */
+    int16_t co2_ppm;              /**< co2 ppm */
+    uint16_t sensor_status;       /**< sensor status */
+    float temperature;            /**< temperature */
+    float humidity;               /**< humidity */
+} stcc4_shm_sample_t;
+
+/**
+ * @brief stcc4 shm word number definition
+ */
+#define STCC4_SHM_WORDS        ((sizeof(stcc4_shm_sample_t) + 3) / 4)        /**< sample size in 32 bits words */
+
+/**
+ * @brief stcc4 shm segment structure definition
+ * @note  the sequence is odd while the publisher writes the words
+ */
+typedef struct stcc4_shm_segment_s
+{
+    uint32_t magic;                         /**< segment magic */
+    uint32_t sequence;                      /**< seqlock sequence */
+    uint32_t word[STCC4_SHM_WORDS];         /**< sample words */
+} stcc4_shm_segment_t;
+
+/**
+ * @brief stcc4 shm structure definition
+ */
+typedef struct stcc4_shm_s
+{
+    stcc4_shm_segment_t *segment;        /**< pointer to the mapped segment */
+    uint8_t writer;                      /**< writer flag */
+} stcc4_shm_t;
+
+/**
+ * @brief     shm example create the segment as the only publisher
+ * @param[in] *shm pointer to a shm structure
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      an existing segment is reused so readers keep their mapping across publisher restarts
+ */
+uint8_t stcc4_shm_create(stcc4_shm_t *shm, const char *name);
+
+/**
+ * @brief     shm example open the segment as a reader
+ * @param[in] *shm pointer to a shm structure
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the segment is mapped read only
+ */
+uint8_t stcc4_shm_open(stcc4_shm_t *shm, const char *name);
+
+/**
+ * @brief     shm example publish a sample
+ * @param[in] *shm pointer to a shm structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      publisher process only, no syscall
+ */
+uint8_t stcc4_shm_publish(stcc4_shm_t *shm, const stcc4_shm_sample_t *sample);
+
+/**
+ * @brief      shm example read the latest sample
+ * @param[in]  *shm pointer to a shm structure
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed or nothing is published
+ * @note       any process, no syscall and no store to the segment,
+ *             it only retries while a publish is in progress
+ */
+uint8_t stcc4_shm_read(stcc4_shm_t *shm, stcc4_shm_sample_t *sample);
+
+/**
+ * @brief     shm example close the segment
+ * @param[in] *shm pointer to a shm structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the segment name stays until stcc4_shm_unlink
+ */
+uint8_t stcc4_shm_close(stcc4_shm_t *shm);
+
+/**
+ * @brief     shm example remove the segment name
+ * @param[in] *name pointer to a posix shared memory name
+ * @return    status code
+ *            - 0 success
+ *            - 1 unlink failed
+ * @note      mapped readers keep the old segment
+ */
+uint8_t stcc4_shm_unlink(const char *name);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -50,6 +50,16 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief stcc4 interface bus structure definition
+ * @note  the user context of the *_ctx functions, one per linked handle
+ */
+typedef struct stcc4_interface_bus_s
+{
+    uint8_t index;        /**< iic bus index */
+    int32_t fd;           /**< iic bus handle */
+} stcc4_interface_bus_t;
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -92,6 +102,103 @@ uint8_t stcc4_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
  */
 uint8_t stcc4_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      interface iic bus write and read command in one transfer
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the read follows the write with a repeated start
+ */
+uint8_t stcc4_interface_iic_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      opens the bus user->index and keeps the handle in user->fd
+ */
+uint8_t stcc4_interface_iic_init_ctx(void *user);
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_deinit_ctx(void *user);
+
+/**
+ * @brief     interface iic bus write command with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_write_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus read command with a user context
+ * @param[in]  *user pointer to a stcc4_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t stcc4_interface_iic_read_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus write and read command in one transfer with a user context
+ * @param[in]  *user pointer to a stcc4_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the read follows the write with a repeated start
+ */
+uint8_t stcc4_interface_iic_write_read_cmd_ctx(void *user, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
+/**
+ * @brief     interface delay ms with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @param[in] ms time
+ * @note      none
+ */
+void stcc4_interface_delay_ms_ctx(void *user, uint32_t ms);
+
+/**
+ * @brief  interface timestamp us
+ * @return free running timestamp in us
+ * @note   optional, used by the instrumentation to measure the bus and delay time
+ */
+uint32_t stcc4_interface_timestamp_us(void);
+
+/**
+ * @brief     interface sleep until an absolute time
+ * @param[in] deadline_us deadline on the stcc4_interface_timestamp_us clock
+ * @note      returns at once when the deadline has passed
+ */
+void stcc4_interface_sleep_until_us(uint32_t deadline_us);
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
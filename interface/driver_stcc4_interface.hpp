@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_interface.hpp
+ * @brief     driver stcc4 interface c++ header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_INTERFACE_HPP
+#define DRIVER_STCC4_INTERFACE_HPP
+
+#include "driver_stcc4.hpp"
+#include "driver_stcc4_interface.h"
+
+/**
+ * @addtogroup stcc4_cpp_driver
+ * @{
+ */
+
+namespace stcc4
+{
+
+/**
+ * @brief stcc4 interface bus policy structure definition
+ * @note  binds the stcc4_interface_iic_* functions of the linked board or simulator at compile time
+ */
+struct interface_bus
+{
+    /**
+     * @brief  interface iic bus init
+     * @return status code
+     *         - 0 success
+     *         - 1 iic init failed
+     * @note   none
+     */
+    uint8_t init() noexcept
+    {
+        return stcc4_interface_iic_init();
+    }
+    
+    /**
+     * @brief  interface iic bus deinit
+     * @return status code
+     *         - 0 success
+     *         - 1 iic deinit failed
+     * @note   none
+     */
+    uint8_t deinit() noexcept
+    {
+        return stcc4_interface_iic_deinit();
+    }
+    
+    /**
+     * @brief     interface iic bus write command
+     * @param[in] addr iic device write address
+     * @param[in] *buf pointer to a data buffer
+     * @param[in] len length of the data buffer
+     * @return    status code
+     *            - 0 success
+     *            - 1 write failed
+     * @note      none
+     */
+    uint8_t write(uint8_t addr, uint8_t *buf, uint16_t len) noexcept
+    {
+        return stcc4_interface_iic_write_cmd(addr, buf, len);
+    }
+    
+    /**
+     * @brief      interface iic bus read command
+     * @param[in]  addr iic device write address
+     * @param[out] *buf pointer to a data buffer
+     * @param[in]  len length of the data buffer
+     * @return     status code
+     *             - 0 success
+     *             - 1 read failed
+     * @note       none
+     */
+    uint8_t read(uint8_t addr, uint8_t *buf, uint16_t len) noexcept
+    {
+        return stcc4_interface_iic_read_cmd(addr, buf, len);
+    }
+    
+    /**
+     * @brief      interface iic bus write and read command in one transfer
+     * @param[in]  addr iic device write address
+     * @param[in]  *wbuf pointer to a write buffer
+     * @param[in]  wlen length of the write buffer
+     * @param[out] *rbuf pointer to a read buffer
+     * @param[in]  rlen length of the read buffer
+     * @return     status code
+     *             - 0 success
+     *             - 1 transfer failed
+     * @note       none
+     */
+    uint8_t write_read(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen) noexcept
+    {
+        return stcc4_interface_iic_write_read_cmd(addr, wbuf, wlen, rbuf, rlen);
+    }
+};
+
+/**
+ * @brief stcc4 interface delay policy structure definition
+ * @note  binds stcc4_interface_delay_ms, so the simulator virtual clock is used
+ */
+struct interface_delay
+{
+    /**
+     * @brief     interface delay ms
+     * @param[in] ms time
+     * @note      none
+     */
+    void delay_ms(uint32_t ms) const noexcept
+    {
+        stcc4_interface_delay_ms(ms);
+    }
+};
+
+/**
+ * @brief stcc4 interface timer policy structure definition
+ * @note  binds stcc4_interface_timestamp_us and stcc4_interface_delay_ms for the coroutine executor,
+ *        so the simulator virtual clock is used
+ */
+struct interface_timer
+{
+    /**
+     * @brief  get the time
+     * @return time in ms
+     * @note   accumulates the us timestamp, which wraps every 71 minutes
+     */
+    uint32_t now_ms() noexcept
+    {
+        uint32_t us = stcc4_interface_timestamp_us();
+        
+        m_us += static_cast<uint32_t>(us - m_last);
+        m_last = us;
+        
+        return static_cast<uint32_t>(m_us / 1000);
+    }
+    
+    /**
+     * @brief     block the thread
+     * @param[in] ms time
+     * @note      none
+     */
+    void sleep_for_ms(uint32_t ms) const noexcept
+    {
+        stcc4_interface_delay_ms(ms);
+    }
+    
+    uint64_t m_us = 0;          /**< accumulated time in us */
+    uint32_t m_last = 0;        /**< last timestamp in us */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,1215 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_interface_simulator.c
+ * @brief     driver stcc4 interface simulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "driver_stcc4_interface_simulator.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief simulated chip command definition
+ */
+#define SIMULATOR_COMMAND_START_CONTINUOUS_MEASUREMENT     0x218BU        /**< start continuous measurement command */
+#define SIMULATOR_COMMAND_STOP_CONTINUOUS_MEASUREMENT      0x3F86U        /**< stop continuous measurement command */
+#define SIMULATOR_COMMAND_READ_MEASUREMENT                 0xEC05U        /**< read measurement command */
+#define SIMULATOR_COMMAND_SET_RHT_COMPENSATION             0xE000U        /**< set rht compensation command */
+#define SIMULATOR_COMMAND_SET_PRESSURE_COMPENSATION        0xE016U        /**< set pressure compensation command */
+#define SIMULATOR_COMMAND_MEASURE_SINGLE_SHOT              0x219DU        /**< measure single shot command */
+#define SIMULATOR_COMMAND_ENTER_SLEEP_MODE                 0x3650U        /**< enter sleep mode command */
+#define SIMULATOR_COMMAND_EXIT_SLEEP_MODE                  0x00U          /**< exit sleep mode command */
+#define SIMULATOR_COMMAND_PERFORM_CONDITIONING             0x29BCU        /**< perform conditioning command */
+#define SIMULATOR_COMMAND_PERFORM_SOFT_RESET               0x06U          /**< perform soft reset command */
+#define SIMULATOR_COMMAND_PERFORM_FACTORY_RESET            0x3632U        /**< perform factory reset command */
+#define SIMULATOR_COMMAND_PERFORM_SELF_TEST                0x278CU        /**< perform self test command */
+#define SIMULATOR_COMMAND_ENABLE_TESTING_MODE              0x3FBCU        /**< enable testing mode command */
+#define SIMULATOR_COMMAND_DISABLE_TESTING_MODE             0x3F3DU        /**< disable testing mode command */
+#define SIMULATOR_COMMAND_PERFORM_FORCED_RECALIBRATION     0x362FU        /**< perform forced recalibration command */
+#define SIMULATOR_COMMAND_GET_PRODUCT_ID                   0x365BU        /**< get product id command */
+
+/**
+ * @brief simulated chip timing definition
+ */
+#define SIMULATOR_PRODUCT_ID                   0x0901018AU        /**< product id */
+#define SIMULATOR_GENERAL_CALL_ADDRESS         0x00               /**< iic general call address */
+#define SIMULATOR_SAMPLE_PERIOD_MS             1000               /**< continuous sample period */
+#define SIMULATOR_SINGLE_SHOT_TIME_MS          500                /**< single shot conversion time */
+#define SIMULATOR_STOP_TIME_MS                 1200               /**< stop continuous measurement time */
+#define SIMULATOR_CONDITIONING_TIME_MS         22000              /**< conditioning time */
+#define SIMULATOR_SELF_TEST_TIME_MS            360                /**< self test time */
+#define SIMULATOR_RECALIBRATION_TIME_MS        90                 /**< forced recalibration and factory reset time */
+#define SIMULATOR_SOFT_RESET_TIME_MS           10                 /**< soft reset time */
+#define SIMULATOR_EXIT_SLEEP_TIME_MS           5                  /**< exit sleep time */
+#define SIMULATOR_ENTER_SLEEP_TIME_MS          1                  /**< enter sleep time */
+#define SIMULATOR_READ_TIME_MS                 1                  /**< read measurement and get product id time */
+#define SIMULATOR_PI                           3.14159265358979f  /**< pi */
+
+/**
+ * @brief simulated device mode enumeration definition
+ */
+typedef enum
+{
+    SIMULATOR_MODE_IDLE       = 0x00,        /**< idle mode */
+    SIMULATOR_MODE_CONTINUOUS = 0x01,        /**< continuous measurement mode */
+    SIMULATOR_MODE_SLEEP      = 0x02,        /**< sleep mode */
+} simulator_mode_t;
+
+/**
+ * @brief simulated device structure definition
+ */
+typedef struct simulator_device_s
+{
+    uint8_t addr;                                      /**< iic address */
+    uint8_t mode;                                      /**< device mode */
+    uint8_t testing;                                   /**< testing mode flag */
+    uint8_t crc_error_mask;                            /**< corrupted measurement words */
+    uint8_t shot_pending;                              /**< single shot data is pending */
+    uint8_t response_valid;                            /**< response is valid */
+    uint16_t response_len;                             /**< response length */
+    uint8_t response[18];                              /**< response buffer */
+    uint16_t self_test_result;                         /**< self test result word */
+    uint16_t temperature_compensation;                 /**< rht compensation temperature raw */
+    uint16_t humidity_compensation;                    /**< rht compensation humidity raw */
+    uint16_t pressure_compensation;                    /**< pressure compensation raw */
+    uint32_t nack_count;                               /**< injected nack count */
+    uint8_t clock_stretch;                             /**< a repeated start read stretches the clock */
+    uint32_t busy_until;                               /**< busy deadline in ms */
+    uint32_t continuous_start;                         /**< continuous start time in ms */
+    uint32_t last_sample;                              /**< index of the last read continuous sample */
+    uint32_t shot_time;                                /**< single shot sample time in ms */
+    uint32_t shot_duration;                            /**< single shot conversion time in ms */
+    int32_t frc_offset;                                /**< forced recalibration co2 offset */
+    stcc4_simulator_waveform_t waveform[3];            /**< channel waveforms */
+} simulator_device_t;
+
+static simulator_device_t gs_device[STCC4_SIMULATOR_MAX_DEVICE];        /**< simulated devices */
+static stcc4_simulator_stats_t gs_stats;                                /**< bus statistics */
+static uint8_t gs_inited = 0;                                           /**< devices are created */
+static struct timespec gs_epoch;                                        /**< simulation epoch */
+static uint8_t gs_virtual = STCC4_SIMULATOR_VIRTUAL_TIME;               /**< virtual clock flag */
+static uint32_t gs_virtual_ms = 0;                                      /**< virtual clock in ms */
+static uint32_t gs_real_offset_ms = 0;                                  /**< wall clock offset in ms */
+
+/**
+ * @brief  get the wall clock time
+ * @return time in ms since the epoch
+ * @note   none
+ */
+static uint32_t a_simulator_real_ms(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)(((int64_t)(ts.tv_sec - gs_epoch.tv_sec) * 1000000000LL + 
+                       (int64_t)(ts.tv_nsec - gs_epoch.tv_nsec)) / 1000000LL);
+}
+
+/**
+ * @brief  get the wall clock time in us
+ * @return time in us since the epoch
+ * @note   wraps every 71 minutes
+ */
+static uint32_t a_simulator_real_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)(((int64_t)(ts.tv_sec - gs_epoch.tv_sec) * 1000000000LL + 
+                       (int64_t)(ts.tv_nsec - gs_epoch.tv_nsec)) / 1000LL);
+}
+
+/**
+ * @brief  get the simulation time
+ * @return time in ms since the first use
+ * @note   none
+ */
+static uint32_t a_simulator_now_ms(void)
+{
+    if (gs_virtual != 0)
+    {
+        return gs_virtual_ms;
+    }
+    
+    return a_simulator_real_ms() + gs_real_offset_ms;
+}
+
+/**
+ * @brief  get the simulation time in us
+ * @return time in us since the first use
+ * @note   the us resolution variant of a_simulator_now_ms, a time mode switch does not jump
+ */
+static uint32_t a_simulator_now_us(void)
+{
+    if (gs_virtual != 0)
+    {
+        return gs_virtual_ms * 1000U;
+    }
+    
+    return a_simulator_real_us() + gs_real_offset_ms * 1000U;
+}
+
+/**
+ * @brief     generate the sensirion crc
+ * @param[in] *data pointer to a data buffer
+ * @param[in] count data length
+ * @return    crc
+ * @note      none
+ */
+static uint8_t a_simulator_crc(uint8_t *data, uint16_t count)
+{
+    uint16_t i;
+    uint8_t bit;
+    uint8_t crc = 0xFF;
+    
+    for (i = 0; i < count; i++)
+    {
+        crc ^= data[i];
+        for (bit = 8; bit > 0; --bit)
+        {
+            if ((crc & 0x80) != 0)
+            {
+                crc = (uint8_t)((crc << 1) ^ 0x31);
+            }
+            else
+            {
+                crc = (uint8_t)(crc << 1);
+            }
+        }
+    }
+    
+    return crc;
+}
+
+/**
+ * @brief      put a word with crc
+ * @param[out] *buf pointer to a 3 bytes buffer
+ * @param[in]  word data word
+ * @note       none
+ */
+static void a_simulator_put_word(uint8_t *buf, uint16_t word)
+{
+    buf[0] = (uint8_t)(word >> 8);
+    buf[1] = (uint8_t)(word >> 0);
+    buf[2] = a_simulator_crc(buf, 2);
+}
+
+/**
+ * @brief     check the time is before a deadline
+ * @param[in] now current time in ms
+ * @param[in] deadline deadline in ms
+ * @return    1 if now is before the deadline
+ * @note      wrap safe
+ */
+static uint8_t a_simulator_before(uint32_t now, uint32_t deadline)
+{
+    return ((int32_t)(now - deadline) < 0) ? 1 : 0;
+}
+
+/**
+ * @brief     evaluate a waveform
+ * @param[in] *waveform pointer to a waveform structure
+ * @param[in] t time in ms
+ * @return    value
+ * @note      none
+ */
+static float a_simulator_waveform(const stcc4_simulator_waveform_t *waveform, uint32_t t)
+{
+    float phase;
+    
+    if ((waveform->type == STCC4_SIMULATOR_WAVEFORM_CONSTANT) || (waveform->period_ms == 0))
+    {
+        return waveform->offset;
+    }
+    phase = (float)(t % waveform->period_ms) / (float)waveform->period_ms;
+    if (waveform->type == STCC4_SIMULATOR_WAVEFORM_SINE)
+    {
+        return waveform->offset + waveform->amplitude * sinf(2.0f * SIMULATOR_PI * phase);
+    }
+    else if (waveform->type == STCC4_SIMULATOR_WAVEFORM_RAMP)
+    {
+        return waveform->offset + waveform->amplitude * phase;
+    }
+    else
+    {
+        return (phase < 0.5f) ? waveform->offset : (waveform->offset + waveform->amplitude);
+    }
+}
+
+/**
+ * @brief     clamp a value to a raw range
+ * @param[in] v value
+ * @param[in] min min value
+ * @param[in] max max value
+ * @return    rounded and clamped value
+ * @note      none
+ */
+static int32_t a_simulator_clamp(float v, int32_t min, int32_t max)
+{
+    v = floorf(v + 0.5f);
+    if (v < (float)min)
+    {
+        return min;
+    }
+    if (v > (float)max)
+    {
+        return max;
+    }
+    
+    return (int32_t)v;
+}
+
+/**
+ * @brief     get the co2 of a device
+ * @param[in] *device pointer to a device structure
+ * @param[in] t time in ms
+ * @return    co2 in ppm with the recalibration offset
+ * @note      none
+ */
+static int32_t a_simulator_co2(simulator_device_t *device, uint32_t t)
+{
+    return a_simulator_clamp(a_simulator_waveform(&device->waveform[STCC4_SIMULATOR_CHANNEL_CO2], t) + 
+                             (float)device->frc_offset, -32768, 32767);
+}
+
+/**
+ * @brief     fill the measurement response
+ * @param[in] *device pointer to a device structure
+ * @param[in] t sample time in ms
+ * @note      none
+ */
+static void a_simulator_sample(simulator_device_t *device, uint32_t t)
+{
+    uint8_t i;
+    int32_t co2;
+    int32_t temperature;
+    int32_t humidity;
+    
+    co2 = a_simulator_co2(device, t);
+    temperature = a_simulator_clamp((a_simulator_waveform(&device->waveform[STCC4_SIMULATOR_CHANNEL_TEMPERATURE], t) + 45.0f) *
+                                    65535.0f / 175.0f, 0, 65535);
+    humidity = a_simulator_clamp((a_simulator_waveform(&device->waveform[STCC4_SIMULATOR_CHANNEL_HUMIDITY], t) + 6.0f) *
+                                 65535.0f / 125.0f, 0, 65535);
+    a_simulator_put_word(&device->response[0], (uint16_t)co2);
+    a_simulator_put_word(&device->response[3], (uint16_t)temperature);
+    a_simulator_put_word(&device->response[6], (uint16_t)humidity);
+    a_simulator_put_word(&device->response[9], (uint16_t)((device->testing != 0) ? 0x4000U : 0x0000U));
+    for (i = 0; i < 4; i++)
+    {
+        if ((device->crc_error_mask & (1 << i)) != 0)
+        {
+            device->response[i * 3 + 2] ^= 0xFF;
+        }
+    }
+    device->response_len = 12;
+    device->response_valid = 1;
+    gs_stats.samples++;
+}
+
+/**
+ * @brief     reset a device
+ * @param[in] *device pointer to a device structure
+ * @param[in] now current time in ms
+ * @note      none
+ */
+static void a_simulator_reset(simulator_device_t *device, uint32_t now)
+{
+    device->mode = SIMULATOR_MODE_IDLE;
+    device->testing = 0;
+    device->shot_pending = 0;
+    device->response_valid = 0;
+    device->response_len = 0;
+    device->temperature_compensation = 0x6667U;
+    device->humidity_compensation = 0x5EB9U;
+    device->pressure_compensation = 50650U;
+    device->busy_until = now;
+}
+
+/**
+ * @brief  create the simulated devices once
+ * @note   none
+ */
+static void a_simulator_create(void)
+{
+    uint8_t i;
+    
+    if (gs_inited != 0)
+    {
+        return;
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &gs_epoch);
+    memset(gs_device, 0, sizeof(gs_device));
+    memset(&gs_stats, 0, sizeof(gs_stats));
+    for (i = 0; i < STCC4_SIMULATOR_MAX_DEVICE; i++)
+    {
+        gs_device[i].addr = (i == 0) ? STCC4_ADDRESS_0 : STCC4_ADDRESS_1;
+        gs_device[i].waveform[STCC4_SIMULATOR_CHANNEL_CO2].type = STCC4_SIMULATOR_WAVEFORM_SINE;
+        gs_device[i].waveform[STCC4_SIMULATOR_CHANNEL_CO2].offset = 800.0f;
+        gs_device[i].waveform[STCC4_SIMULATOR_CHANNEL_CO2].amplitude = 200.0f;
+        gs_device[i].waveform[STCC4_SIMULATOR_CHANNEL_CO2].period_ms = 600000;
+        gs_device[i].waveform[STCC4_SIMULATOR_CHANNEL_TEMPERATURE].type = STCC4_SIMULATOR_WAVEFORM_CONSTANT;
+        gs_device[i].waveform[STCC4_SIMULATOR_CHANNEL_TEMPERATURE].offset = 25.0f;
+        gs_device[i].waveform[STCC4_SIMULATOR_CHANNEL_HUMIDITY].type = STCC4_SIMULATOR_WAVEFORM_CONSTANT;
+        gs_device[i].waveform[STCC4_SIMULATOR_CHANNEL_HUMIDITY].offset = 50.0f;
+        gs_device[i].shot_duration = SIMULATOR_SINGLE_SHOT_TIME_MS;
+        a_simulator_reset(&gs_device[i], 0);
+    }
+    gs_inited = 1;
+}
+
+/**
+ * @brief     find a device by address
+ * @param[in] addr iic address
+ * @return    pointer to a device structure or NULL
+ * @note      none
+ */
+static simulator_device_t *a_simulator_find(uint8_t addr)
+{
+    uint8_t i;
+    
+    a_simulator_create();
+    for (i = 0; i < STCC4_SIMULATOR_MAX_DEVICE; i++)
+    {
+        if (gs_device[i].addr == addr)
+        {
+            return &gs_device[i];
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     check the payload words
+ * @param[in] *buf pointer to a payload buffer
+ * @param[in] len payload length
+ * @param[in] words expected words
+ * @return    1 if the payload is valid
+ * @note      none
+ */
+static uint8_t a_simulator_payload_ok(uint8_t *buf, uint16_t len, uint8_t words)
+{
+    uint8_t i;
+    
+    if (len != (uint16_t)(words * 3))
+    {
+        return 0;
+    }
+    for (i = 0; i < words; i++)
+    {
+        if (a_simulator_crc(&buf[i * 3], 2) != buf[i * 3 + 2])
+        {
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     decode a command
+ * @param[in] *device pointer to a device structure
+ * @param[in] now current time in ms
+ * @param[in] command command word
+ * @param[in] *payload pointer to a payload buffer
+ * @param[in] len payload length
+ * @return    status code
+ *            - 0 acknowledged
+ *            - 1 not acknowledged
+ * @note      none
+ */
+static uint8_t a_simulator_command(simulator_device_t *device, uint32_t now, uint16_t command, uint8_t *payload, uint16_t len)
+{
+    uint32_t index;
+    int32_t correction;
+    uint16_t target;
+    
+    if (device->mode == SIMULATOR_MODE_SLEEP)                                              /* sleep ignores all commands */
+    {
+        return 1;
+    }
+    if (device->mode == SIMULATOR_MODE_CONTINUOUS)                                         /* continuous mode subset */
+    {
+        if ((command != SIMULATOR_COMMAND_READ_MEASUREMENT) &&
+            (command != SIMULATOR_COMMAND_STOP_CONTINUOUS_MEASUREMENT) &&
+            (command != SIMULATOR_COMMAND_SET_RHT_COMPENSATION) &&
+            (command != SIMULATOR_COMMAND_SET_PRESSURE_COMPENSATION))
+        {
+            return 1;
+        }
+    }
+    device->response_valid = 0;
+    
+    switch (command)
+    {
+        case SIMULATOR_COMMAND_START_CONTINUOUS_MEASUREMENT :
+        {
+            device->mode = SIMULATOR_MODE_CONTINUOUS;
+            device->continuous_start = now;
+            device->last_sample = 0;
+            device->shot_pending = 0;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_STOP_CONTINUOUS_MEASUREMENT :
+        {
+            device->mode = SIMULATOR_MODE_IDLE;
+            device->busy_until = now + SIMULATOR_STOP_TIME_MS;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_READ_MEASUREMENT :
+        {
+            if (device->mode == SIMULATOR_MODE_CONTINUOUS)
+            {
+                index = (now - device->continuous_start) / SIMULATOR_SAMPLE_PERIOD_MS;
+                if ((index == 0) || (index == device->last_sample))
+                {
+                    return 0;                                                              /* no new data, the read is not acknowledged */
+                }
+                device->last_sample = index;
+                a_simulator_sample(device, device->continuous_start + index * SIMULATOR_SAMPLE_PERIOD_MS);
+            }
+            else if (device->shot_pending != 0)
+            {
+                device->shot_pending = 0;
+                a_simulator_sample(device, device->shot_time);
+            }
+            else
+            {
+                /* no data */
+            }
+            device->busy_until = now + SIMULATOR_READ_TIME_MS;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_SET_RHT_COMPENSATION :
+        {
+            if (a_simulator_payload_ok(payload, len, 2) == 0)
+            {
+                return 1;
+            }
+            device->temperature_compensation = (uint16_t)(((uint16_t)payload[0] << 8) | payload[1]);
+            device->humidity_compensation = (uint16_t)(((uint16_t)payload[3] << 8) | payload[4]);
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_SET_PRESSURE_COMPENSATION :
+        {
+            if (a_simulator_payload_ok(payload, len, 1) == 0)
+            {
+                return 1;
+            }
+            device->pressure_compensation = (uint16_t)(((uint16_t)payload[0] << 8) | payload[1]);
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_MEASURE_SINGLE_SHOT :
+        {
+            device->shot_pending = 1;
+            device->shot_time = now + device->shot_duration;
+            device->busy_until = device->shot_time;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_ENTER_SLEEP_MODE :
+        {
+            device->mode = SIMULATOR_MODE_SLEEP;
+            device->shot_pending = 0;
+            device->busy_until = now + SIMULATOR_ENTER_SLEEP_TIME_MS;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_PERFORM_CONDITIONING :
+        {
+            device->busy_until = now + SIMULATOR_CONDITIONING_TIME_MS;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_PERFORM_FACTORY_RESET :
+        {
+            device->frc_offset = 0;
+            a_simulator_put_word(&device->response[0], 0x0000U);
+            device->response_len = 3;
+            device->response_valid = 1;
+            device->busy_until = now + SIMULATOR_RECALIBRATION_TIME_MS;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_PERFORM_SELF_TEST :
+        {
+            a_simulator_put_word(&device->response[0], device->self_test_result);
+            device->response_len = 3;
+            device->response_valid = 1;
+            device->busy_until = now + SIMULATOR_SELF_TEST_TIME_MS;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_ENABLE_TESTING_MODE :
+        {
+            device->testing = 1;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_DISABLE_TESTING_MODE :
+        {
+            device->testing = 0;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_PERFORM_FORCED_RECALIBRATION :
+        {
+            if (a_simulator_payload_ok(payload, len, 1) == 0)
+            {
+                return 1;
+            }
+            target = (uint16_t)(((uint16_t)payload[0] << 8) | payload[1]);
+            correction = (int32_t)target - a_simulator_co2(device, now);
+            device->frc_offset += correction;
+            a_simulator_put_word(&device->response[0], (uint16_t)(correction + 32768));
+            device->response_len = 3;
+            device->response_valid = 1;
+            device->busy_until = now + SIMULATOR_RECALIBRATION_TIME_MS;
+            
+            return 0;
+        }
+        case SIMULATOR_COMMAND_GET_PRODUCT_ID :
+        {
+            a_simulator_put_word(&device->response[0], (uint16_t)(SIMULATOR_PRODUCT_ID >> 16));
+            a_simulator_put_word(&device->response[3], (uint16_t)(SIMULATOR_PRODUCT_ID >> 0));
+            a_simulator_put_word(&device->response[6], 0x5354U);
+            a_simulator_put_word(&device->response[9], 0x4343U);
+            a_simulator_put_word(&device->response[12], 0x3400U);
+            a_simulator_put_word(&device->response[15], (uint16_t)device->addr);
+            device->response_len = 18;
+            device->response_valid = 1;
+            device->busy_until = now + SIMULATOR_READ_TIME_MS;
+            
+            return 0;
+        }
+        default :
+        {
+            return 1;
+        }
+    }
+}
+
+/**
+ * @brief     reset all simulated devices to the power on state
+ * @note      the waveforms and the statistics are kept
+ */
+void stcc4_simulator_power_on(void)
+{
+    uint8_t i;
+    uint32_t now;
+    
+    a_simulator_create();
+    now = a_simulator_now_ms();
+    for (i = 0; i < STCC4_SIMULATOR_MAX_DEVICE; i++)
+    {
+        a_simulator_reset(&gs_device[i], now);
+        gs_device[i].frc_offset = 0;
+        gs_device[i].nack_count = 0;
+        gs_device[i].crc_error_mask = 0;
+        gs_device[i].shot_duration = SIMULATOR_SINGLE_SHOT_TIME_MS;
+    }
+}
+
+/**
+ * @brief     enable or disable the virtual clock
+ * @param[in] enable bool value
+ * @note      the simulation time carries over when the clock is switched
+ */
+void stcc4_simulator_set_virtual_time(stcc4_bool_t enable)
+{
+    uint32_t now;
+    
+    a_simulator_create();
+    now = a_simulator_now_ms();
+    gs_virtual = (enable == STCC4_BOOL_TRUE) ? 1 : 0;
+    gs_virtual_ms = now;
+    gs_real_offset_ms = now - a_simulator_real_ms();
+}
+
+/**
+ * @brief      get the simulation time
+ * @param[out] *ms pointer to a time buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 get time failed
+ * @note       with the virtual clock the time only moves in stcc4_interface_delay_ms
+ */
+uint8_t stcc4_simulator_get_time_ms(uint32_t *ms)
+{
+    if (ms == NULL)
+    {
+        return 1;
+    }
+    a_simulator_create();
+    *ms = a_simulator_now_ms();
+    
+    return 0;
+}
+
+/**
+ * @brief     set the waveform of a channel
+ * @param[in] address address pin of the simulated device
+ * @param[in] channel measurement channel
+ * @param[in] *waveform pointer to a waveform structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set waveform failed
+ * @note      none
+ */
+uint8_t stcc4_simulator_set_waveform(stcc4_address_t address, stcc4_simulator_channel_t channel,
+                                     const stcc4_simulator_waveform_t *waveform)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_find((uint8_t)address);
+    if ((device == NULL) || (waveform == NULL) || ((uint32_t)channel > STCC4_SIMULATOR_CHANNEL_HUMIDITY))
+    {
+        return 1;
+    }
+    device->waveform[channel] = *waveform;
+    
+    return 0;
+}
+
+/**
+ * @brief     set the self test result word
+ * @param[in] address address pin of the simulated device
+ * @param[in] result self test result word
+ * @return    status code
+ *            - 0 success
+ *            - 1 set self test result failed
+ * @note      0x0000 means passed
+ */
+uint8_t stcc4_simulator_set_self_test_result(stcc4_address_t address, uint16_t result)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_find((uint8_t)address);
+    if (device == NULL)
+    {
+        return 1;
+    }
+    device->self_test_result = result;
+    
+    return 0;
+}
+
+/**
+ * @brief     set the single shot conversion time
+ * @param[in] address address pin of the simulated device
+ * @param[in] ms conversion time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 set single shot time failed
+ * @note      1 <= ms <= 500, the real parts finish before the 500ms worst case
+ */
+uint8_t stcc4_simulator_set_single_shot_time(stcc4_address_t address, uint32_t ms)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_find((uint8_t)address);
+    if ((device == NULL) || (ms == 0) || (ms > SIMULATOR_SINGLE_SHOT_TIME_MS))
+    {
+        return 1;
+    }
+    device->shot_duration = ms;
+    
+    return 0;
+}
+
+/**
+ * @brief     corrupt the crc of the measurement words
+ * @param[in] address address pin of the simulated device
+ * @param[in] mask STCC4_CRC_ERROR_* bits of the words to corrupt
+ * @return    status code
+ *            - 0 success
+ *            - 1 inject crc error failed
+ * @note      stays active until it is set to 0
+ */
+uint8_t stcc4_simulator_inject_crc_error(stcc4_address_t address, uint8_t mask)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_find((uint8_t)address);
+    if (device == NULL)
+    {
+        return 1;
+    }
+    device->crc_error_mask = mask;
+    
+    return 0;
+}
+
+/**
+ * @brief     not acknowledge the next transfers
+ * @param[in] address address pin of the simulated device
+ * @param[in] count number of transfers to not acknowledge
+ * @return    status code
+ *            - 0 success
+ *            - 1 inject nack failed
+ * @note      none
+ */
+uint8_t stcc4_simulator_inject_nack(stcc4_address_t address, uint32_t count)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_find((uint8_t)address);
+    if (device == NULL)
+    {
+        return 1;
+    }
+    device->nack_count = count;
+    
+    return 0;
+}
+
+/**
+ * @brief     enable or disable the clock stretching of a combined write read
+ * @param[in] address address pin of the simulated device
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set clock stretch failed
+ * @note      kept over a power on
+ */
+uint8_t stcc4_simulator_set_clock_stretch(stcc4_address_t address, stcc4_bool_t enable)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_find((uint8_t)address);
+    if (device == NULL)
+    {
+        return 1;
+    }
+    device->clock_stretch = (enable == STCC4_BOOL_TRUE) ? 1 : 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      get the bus statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       none
+ */
+uint8_t stcc4_simulator_get_stats(stcc4_simulator_stats_t *stats)
+{
+    if (stats == NULL)
+    {
+        return 1;
+    }
+    a_simulator_create();
+    *stats = gs_stats;
+    
+    return 0;
+}
+
+/**
+ * @brief  clear the bus statistics
+ * @note   none
+ */
+void stcc4_simulator_clear_stats(void)
+{
+    a_simulator_create();
+    memset(&gs_stats, 0, sizeof(gs_stats));
+}
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   none
+ */
+uint8_t stcc4_interface_iic_init(void)
+{
+    a_simulator_create();
+    
+    return 0;
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 iic deinit failed
+ * @note   none
+ */
+uint8_t stcc4_interface_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t i;
+    uint32_t now;
+    simulator_device_t *device;
+    
+    a_simulator_create();
+    now = a_simulator_now_ms();
+    gs_stats.write++;
+    gs_stats.bytes += len;
+    
+    /* general call soft reset */
+    if ((addr == SIMULATOR_GENERAL_CALL_ADDRESS) && (len == 1) && (buf[0] == SIMULATOR_COMMAND_PERFORM_SOFT_RESET))
+    {
+        for (i = 0; i < STCC4_SIMULATOR_MAX_DEVICE; i++)
+        {
+            if (gs_device[i].mode != SIMULATOR_MODE_SLEEP)
+            {
+                a_simulator_reset(&gs_device[i], now);
+                gs_device[i].busy_until = now + SIMULATOR_SOFT_RESET_TIME_MS;
+            }
+        }
+        
+        return 0;
+    }
+    
+    device = a_simulator_find(addr);
+    if (device == NULL)
+    {
+        gs_stats.nack++;
+        
+        return 1;
+    }
+    
+    /* exit sleep is never acknowledged */
+    if ((len == 1) && (buf[0] == SIMULATOR_COMMAND_EXIT_SLEEP_MODE))
+    {
+        if (device->mode == SIMULATOR_MODE_SLEEP)
+        {
+            device->mode = SIMULATOR_MODE_IDLE;
+            device->busy_until = now + SIMULATOR_EXIT_SLEEP_TIME_MS;
+        }
+        gs_stats.nack++;
+        
+        return 1;
+    }
+    
+    if ((device->nack_count != 0) || (a_simulator_before(now, device->busy_until) != 0) || (len < 2))
+    {
+        if (device->nack_count != 0)
+        {
+            device->nack_count--;
+        }
+        gs_stats.nack++;
+        
+        return 1;
+    }
+    if (a_simulator_command(device, now, (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]), buf + 2, (uint16_t)(len - 2)) != 0)
+    {
+        gs_stats.nack++;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t stcc4_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint32_t now;
+    simulator_device_t *device;
+    
+    a_simulator_create();
+    now = a_simulator_now_ms();
+    gs_stats.read++;
+    
+    device = a_simulator_find(addr);
+    if ((device == NULL) || (device->mode == SIMULATOR_MODE_SLEEP) || 
+        (device->nack_count != 0) || (a_simulator_before(now, device->busy_until) != 0))
+    {
+        if ((device != NULL) && (device->nack_count != 0))
+        {
+            device->nack_count--;
+        }
+        gs_stats.nack++;
+        
+        return 1;
+    }
+    if ((device->response_valid == 0) || (len > device->response_len))
+    {
+        gs_stats.nack++;
+        
+        return 1;
+    }
+    memcpy(buf, device->response, len);
+    device->response_valid = 0;
+    gs_stats.bytes += len;
+    
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus write and read command in one transfer
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the read follows the write with a repeated start, a busy device nacks it unless
+ *             clock stretching is enabled, then the read waits until the command is executed
+ */
+uint8_t stcc4_interface_iic_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    simulator_device_t *device;
+    int32_t remain;
+    
+    if (stcc4_interface_iic_write_cmd(addr, wbuf, wlen) != 0)
+    {
+        return 1;
+    }
+    device = a_simulator_find(addr);
+    if ((device != NULL) && (device->clock_stretch != 0))
+    {
+        remain = (int32_t)(device->busy_until - a_simulator_now_ms());
+        if (remain > 0)
+        {
+            stcc4_interface_delay_ms((uint32_t)remain);
+        }
+    }
+    
+    return stcc4_interface_iic_read_cmd(addr, rbuf, rlen);
+}
+
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      every simulated device sits on one virtual bus, index is ignored
+ */
+uint8_t stcc4_interface_iic_init_ctx(void *user)
+{
+    ((stcc4_interface_bus_t *)user)->fd = 0;
+    
+    return stcc4_interface_iic_init();
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_deinit_ctx(void *user)
+{
+    (void)user;
+    
+    return stcc4_interface_iic_deinit();
+}
+
+/**
+ * @brief     interface iic bus write command with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_write_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)user;
+    
+    return stcc4_interface_iic_write_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with a user context
+ * @param[in]  *user pointer to a stcc4_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t stcc4_interface_iic_read_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)user;
+    
+    return stcc4_interface_iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus write and read command in one transfer with a user context
+ * @param[in]  *user pointer to a stcc4_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the read follows the write with a repeated start
+ */
+uint8_t stcc4_interface_iic_write_read_cmd_ctx(void *user, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    (void)user;
+    
+    return stcc4_interface_iic_write_read_cmd(addr, wbuf, wlen, rbuf, rlen);
+}
+
+/**
+ * @brief     interface delay ms with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @param[in] ms time
+ * @note      none
+ */
+void stcc4_interface_delay_ms_ctx(void *user, uint32_t ms)
+{
+    (void)user;
+    
+    stcc4_interface_delay_ms(ms);
+}
+
+/**
+ * @brief  interface timestamp us
+ * @return free running timestamp in us
+ * @note   the simulation clock, bus transfers take no virtual time
+ */
+uint32_t stcc4_interface_timestamp_us(void)
+{
+    a_simulator_create();
+    
+    return a_simulator_now_us();
+}
+
+/**
+ * @brief     interface sleep until an absolute time
+ * @param[in] deadline_us deadline on the stcc4_interface_timestamp_us clock
+ * @note      the virtual clock jumps to the deadline
+ */
+void stcc4_interface_sleep_until_us(uint32_t deadline_us)
+{
+    int32_t remain;
+    
+    remain = (int32_t)(deadline_us - stcc4_interface_timestamp_us());
+    if (remain <= 0)
+    {
+        return;
+    }
+    if (gs_virtual != 0)
+    {
+        gs_virtual_ms += ((uint32_t)remain + 999U) / 1000U;
+        
+        return;
+    }
+    stcc4_interface_delay_ms(((uint32_t)remain + 999U) / 1000U);
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+void stcc4_interface_delay_ms(uint32_t ms)
+{
+    struct timespec ts;
+    
+    if (gs_virtual != 0)
+    {
+        gs_virtual_ms += ms;
+        
+        return;
+    }
+    ts.tv_sec = (time_t)(ms / 1000);
+    ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+    (void)nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void stcc4_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
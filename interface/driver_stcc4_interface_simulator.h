@@ -0,0 +1,226 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_interface_simulator.h
+ * @brief     driver stcc4 interface simulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_INTERFACE_SIMULATOR_H
+#define DRIVER_STCC4_INTERFACE_SIMULATOR_H
+
+#include "driver_stcc4_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup stcc4_simulator_driver stcc4 simulator driver function
+ * @brief    stcc4 simulator driver modules
+ * @ingroup  stcc4_driver
+ * @{
+ */
+
+/**
+ * @brief stcc4 simulator max device definition
+ */
+#define STCC4_SIMULATOR_MAX_DEVICE        2        /**< one device behind each address pin */
+
+/**
+ * @brief stcc4 simulator clock definition
+ * @note  1 uses a virtual clock advanced only by delay_ms, 0 uses the wall clock
+ */
+#ifndef STCC4_SIMULATOR_VIRTUAL_TIME
+    #define STCC4_SIMULATOR_VIRTUAL_TIME        1        /**< virtual clock by default */
+#endif
+
+/**
+ * @brief stcc4 simulator channel enumeration definition
+ */
+typedef enum
+{
+    STCC4_SIMULATOR_CHANNEL_CO2         = 0x00,        /**< co2 in ppm */
+    STCC4_SIMULATOR_CHANNEL_TEMPERATURE = 0x01,        /**< temperature in degrees */
+    STCC4_SIMULATOR_CHANNEL_HUMIDITY    = 0x02,        /**< humidity in percentage */
+} stcc4_simulator_channel_t;
+
+/**
+ * @brief stcc4 simulator waveform enumeration definition
+ */
+typedef enum
+{
+    STCC4_SIMULATOR_WAVEFORM_CONSTANT = 0x00,        /**< offset */
+    STCC4_SIMULATOR_WAVEFORM_SINE     = 0x01,        /**< offset + amplitude * sin(2 * pi * t / period) */
+    STCC4_SIMULATOR_WAVEFORM_RAMP     = 0x02,        /**< offset + amplitude * (t % period) / period */
+    STCC4_SIMULATOR_WAVEFORM_SQUARE   = 0x03,        /**< offset in the first half period, offset + amplitude in the second */
+} stcc4_simulator_waveform_type_t;
+
+/**
+ * @brief stcc4 simulator waveform structure definition
+ */
+typedef struct stcc4_simulator_waveform_s
+{
+    stcc4_simulator_waveform_type_t type;        /**< waveform type */
+    float offset;                                /**< offset */
+    float amplitude;                             /**< amplitude */
+    uint32_t period_ms;                          /**< period in ms */
+} stcc4_simulator_waveform_t;
+
+/**
+ * @brief stcc4 simulator statistics structure definition
+ */
+typedef struct stcc4_simulator_stats_s
+{
+    uint32_t write;              /**< write transfers */
+    uint32_t read;               /**< read transfers */
+    uint32_t nack;               /**< not acknowledged transfers */
+    uint32_t bytes;              /**< bytes on the bus */
+    uint32_t samples;            /**< measurement samples produced */
+} stcc4_simulator_stats_t;
+
+/**
+ * @brief     reset all simulated devices to the power on state
+ * @note      the waveforms and the statistics are kept
+ */
+void stcc4_simulator_power_on(void);
+
+/**
+ * @brief     enable or disable the virtual clock
+ * @param[in] enable bool value
+ * @note      the simulation time carries over when the clock is switched
+ */
+void stcc4_simulator_set_virtual_time(stcc4_bool_t enable);
+
+/**
+ * @brief      get the simulation time
+ * @param[out] *ms pointer to a time buffer in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 get time failed
+ * @note       with the virtual clock the time only moves in stcc4_interface_delay_ms
+ */
+uint8_t stcc4_simulator_get_time_ms(uint32_t *ms);
+
+/**
+ * @brief     set the waveform of a channel
+ * @param[in] address address pin of the simulated device
+ * @param[in] channel measurement channel
+ * @param[in] *waveform pointer to a waveform structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set waveform failed
+ * @note      none
+ */
+uint8_t stcc4_simulator_set_waveform(stcc4_address_t address, stcc4_simulator_channel_t channel,
+                                     const stcc4_simulator_waveform_t *waveform);
+
+/**
+ * @brief     set the self test result word
+ * @param[in] address address pin of the simulated device
+ * @param[in] result self test result word
+ * @return    status code
+ *            - 0 success
+ *            - 1 set self test result failed
+ * @note      0x0000 means passed
+ */
+uint8_t stcc4_simulator_set_self_test_result(stcc4_address_t address, uint16_t result);
+
+/**
+ * @brief     set the single shot conversion time
+ * @param[in] address address pin of the simulated device
+ * @param[in] ms conversion time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 set single shot time failed
+ * @note      1 <= ms <= 500, the real parts finish before the 500ms worst case
+ */
+uint8_t stcc4_simulator_set_single_shot_time(stcc4_address_t address, uint32_t ms);
+
+/**
+ * @brief     corrupt the crc of the measurement words
+ * @param[in] address address pin of the simulated device
+ * @param[in] mask STCC4_CRC_ERROR_* bits of the words to corrupt
+ * @return    status code
+ *            - 0 success
+ *            - 1 inject crc error failed
+ * @note      stays active until it is set to 0
+ */
+uint8_t stcc4_simulator_inject_crc_error(stcc4_address_t address, uint8_t mask);
+
+/**
+ * @brief     not acknowledge the next transfers
+ * @param[in] address address pin of the simulated device
+ * @param[in] count number of transfers to not acknowledge
+ * @return    status code
+ *            - 0 success
+ *            - 1 inject nack failed
+ * @note      none
+ */
+uint8_t stcc4_simulator_inject_nack(stcc4_address_t address, uint32_t count);
+
+/**
+ * @brief     enable or disable the clock stretching of a combined write read
+ * @param[in] address address pin of the simulated device
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set clock stretch failed
+ * @note      a stretching part holds the repeated start read until the command is executed,
+ *            without it a read inside the command execution time is not acknowledged
+ */
+uint8_t stcc4_simulator_set_clock_stretch(stcc4_address_t address, stcc4_bool_t enable);
+
+/**
+ * @brief      get the bus statistics
+ * @param[out] *stats pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       none
+ */
+uint8_t stcc4_simulator_get_stats(stcc4_simulator_stats_t *stats);
+
+/**
+ * @brief  clear the bus statistics
+ * @note   none
+ */
+void stcc4_simulator_clear_stats(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
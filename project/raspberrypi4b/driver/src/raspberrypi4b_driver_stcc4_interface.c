@@ -37,6 +37,8 @@
 #include "driver_stcc4_interface.h"
 #include "iic.h"
 #include <stdarg.h>
+#include <time.h>
+#include <errno.h>
 
 /**
  * @brief iic device name definition
@@ -102,6 +104,166 @@ uint8_t stcc4_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
     return iic_read_cmd(gs_fd, addr, buf, len);
 }
 
+/**
+ * @brief      interface iic bus write and read command in one transfer
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the read follows the write with a repeated start
+ */
+uint8_t stcc4_interface_iic_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    return iic_write_read_cmd(gs_fd, addr, wbuf, wlen, rbuf, rlen);
+}
+
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      opens /dev/i2c-<index>
+ */
+uint8_t stcc4_interface_iic_init_ctx(void *user)
+{
+    stcc4_interface_bus_t *bus = (stcc4_interface_bus_t *)user;
+    char name[16];
+    int fd;
+    
+    (void)snprintf(name, sizeof(name), "/dev/i2c-%d", bus->index);
+    if (iic_init(name, &fd) != 0)
+    {
+        return 1;
+    }
+    bus->fd = fd;
+    
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_deinit_ctx(void *user)
+{
+    return iic_deinit(((stcc4_interface_bus_t *)user)->fd);
+}
+
+/**
+ * @brief     interface iic bus write command with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_write_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_write_cmd(((stcc4_interface_bus_t *)user)->fd, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with a user context
+ * @param[in]  *user pointer to a stcc4_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t stcc4_interface_iic_read_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_read_cmd(((stcc4_interface_bus_t *)user)->fd, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus write and read command in one transfer with a user context
+ * @param[in]  *user pointer to a stcc4_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the read follows the write with a repeated start
+ */
+uint8_t stcc4_interface_iic_write_read_cmd_ctx(void *user, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    return iic_write_read_cmd(((stcc4_interface_bus_t *)user)->fd, addr, wbuf, wlen, rbuf, rlen);
+}
+
+/**
+ * @brief     interface delay ms with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @param[in] ms time
+ * @note      none
+ */
+void stcc4_interface_delay_ms_ctx(void *user, uint32_t ms)
+{
+    (void)user;
+    
+    usleep(1000 * ms);
+}
+
+/**
+ * @brief  interface timestamp us
+ * @return free running timestamp in us
+ * @note   optional, used by the instrumentation to measure the bus and delay time
+ */
+uint32_t stcc4_interface_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL);
+}
+
+/**
+ * @brief     interface sleep until an absolute time
+ * @param[in] deadline_us deadline on the stcc4_interface_timestamp_us clock
+ * @note      returns at once when the deadline has passed
+ */
+void stcc4_interface_sleep_until_us(uint32_t deadline_us)
+{
+    struct timespec ts;
+    int32_t remain;
+    int64_t ns;
+    
+    /* map the 32 bits deadline back to the monotonic clock */
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    remain = (int32_t)(deadline_us - (uint32_t)((uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL));
+    if (remain <= 0)
+    {
+        return;
+    }
+    ns = (int64_t)ts.tv_sec * 1000000000LL + (int64_t)ts.tv_nsec + (int64_t)remain * 1000LL;
+    ts.tv_sec = (time_t)(ns / 1000000000LL);
+    ts.tv_nsec = (long)(ns % 1000000000LL);
+    
+    /* sleep to the absolute time, a signal does not shift it */
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+        
+    }
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -115,6 +115,21 @@ uint8_t iic_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
  */
 uint8_t iic_read_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      iic bus write and read command in one transfer
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t iic_write_read_cmd(int fd, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+
 /**
  * @brief     iic bus write command
  * @param[in] fd iic handle
@@ -226,6 +226,53 @@ uint8_t iic_read_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uin
     return 0;
 }
 
+/**
+ * @brief      iic bus write and read command in one transfer
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       addr = device_address_7bits << 1
+ */
+uint8_t iic_write_read_cmd(int fd, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[2];
+    
+    /* clear ioctl data */
+    memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+    
+    /* clear msgs data */
+    memset(msgs, 0, sizeof(struct i2c_msg) * 2);
+    
+    /* set the param */
+    msgs[0].addr = addr >> 1;
+    msgs[0].flags = 0;
+    msgs[0].buf = wbuf;
+    msgs[0].len = wlen;
+    msgs[1].addr = addr >> 1;
+    msgs[1].flags = I2C_M_RD;
+    msgs[1].buf = rbuf;
+    msgs[1].len = rlen;
+    i2c_rdwr_data.msgs = msgs;
+    i2c_rdwr_data.nmsgs = 2;
+    
+    /* transmit */
+    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    {
+        perror("iic: write read failed.\n");
+        
+        return 1;
+    }
+     
+    return 0;
+}
+
 /**
  * @brief     iic bus write command
  * @param[in] fd iic handle
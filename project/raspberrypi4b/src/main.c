@@ -36,8 +36,34 @@
 
 #include "driver_stcc4_read_test.h"
 #include "driver_stcc4_register_test.h"
+#include "driver_stcc4_crc_test.h"
+#include "driver_stcc4_convert_test.h"
+#include "driver_stcc4_bus_test.h"
+#ifdef STCC4_SIMULATOR
+#include "driver_stcc4_simulator_test.h"
+#include "driver_stcc4_fleet_test.h"
+#endif
+#if (STCC4_INSTRUMENTATION != 0)
+#include "driver_stcc4_stats_test.h"
+#endif
+#ifdef STCC4_CPP
+#include "driver_stcc4_cpp_test.h"
+#endif
+#ifdef STCC4_CORO
+#include "driver_stcc4_coro_test.h"
+#endif
+#include "driver_stcc4_ring_test.h"
+#include "driver_stcc4_shm_test.h"
+#include "driver_stcc4_cache_test.h"
+#include "driver_stcc4_log_test.h"
+#include "driver_stcc4_codec_test.h"
+#include "driver_stcc4_rollup_test.h"
+#include "driver_stcc4_filter_test.h"
+#include "driver_stcc4_multi_test.h"
 #include "driver_stcc4_basic.h"
 #include "driver_stcc4_shot.h"
+#include "driver_stcc4_periodic.h"
+#include "driver_stcc4_shm.h"
 #include <getopt.h>
 #include <stdlib.h>
 
@@ -203,6 +229,174 @@ uint8_t stcc4(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_crc", type) == 0)
+    {
+        /* run crc test */
+        if (stcc4_crc_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_convert", type) == 0)
+    {
+        /* run convert test */
+        if (stcc4_convert_test(address, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_bus", type) == 0)
+    {
+        /* run bus test */
+        if (stcc4_bus_test(address, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+#ifdef STCC4_SIMULATOR
+    else if (strcmp("t_sim", type) == 0)
+    {
+        /* run simulator test */
+        if (stcc4_simulator_test(address) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_fleet", type) == 0)
+    {
+        /* run fleet test */
+        if (stcc4_fleet_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+#endif
+#if (STCC4_INSTRUMENTATION != 0)
+    else if (strcmp("t_stats", type) == 0)
+    {
+        /* run stats test */
+        if (stcc4_stats_test(address, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+#endif
+#ifdef STCC4_CPP
+    else if (strcmp("t_cpp", type) == 0)
+    {
+        /* run cpp test */
+        if (stcc4_cpp_test(address, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+#endif
+#ifdef STCC4_CORO
+    else if (strcmp("t_coro", type) == 0)
+    {
+        /* run coro test */
+        if (stcc4_coro_test(address, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+#endif
+    else if (strcmp("t_ring", type) == 0)
+    {
+        /* run ring test */
+        if (stcc4_ring_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_shm", type) == 0)
+    {
+        /* run shm test */
+        if (stcc4_shm_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_cache", type) == 0)
+    {
+        /* run cache test */
+        if (stcc4_cache_test(address) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_log", type) == 0)
+    {
+        /* run log test */
+        if (stcc4_log_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_codec", type) == 0)
+    {
+        /* run codec test */
+        if (stcc4_codec_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_rollup", type) == 0)
+    {
+        /* run rollup test */
+        if (stcc4_rollup_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_filter", type) == 0)
+    {
+        /* run filter test */
+        if (stcc4_filter_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_multi", type) == 0)
+    {
+        /* run multi test */
+        if (stcc4_multi_test(address, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
@@ -210,6 +404,8 @@ uint8_t stcc4(uint8_t argc, char **argv)
         int16_t co2_ppm;
         float temperature;
         float humidity;
+        stcc4_periodic_t periodic;
+        stcc4_periodic_stats_t stats;
         
         /* basic init */
         res = stcc4_basic_init(address);
@@ -218,11 +414,21 @@ uint8_t stcc4(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* sample half a period after the sensor update on absolute 1000ms deadlines */
+        stcc4_interface_delay_ms(500);
+        res = stcc4_periodic_init(&periodic, 1000, stcc4_interface_timestamp_us, stcc4_interface_sleep_until_us);
+        if (res != 0)
+        {
+            (void)stcc4_basic_deinit();
+            
+            return 1;
+        }
+        
         /* loop */
         for (i = 0; i < times; i++)
         {
-            /* delay 1000ms */
-            stcc4_interface_delay_ms(1000);
+            /* wait for the next deadline */
+            (void)stcc4_periodic_wait(&periodic);
             
             /* read data */
             res = stcc4_basic_read((int16_t *)&co2_ppm, (float *)&temperature, (float *)&humidity);
@@ -240,11 +446,118 @@ uint8_t stcc4(uint8_t argc, char **argv)
             stcc4_interface_debug_print("stcc4: humidity is %0.2f%%.\n", humidity);
         }
         
+        /* output the period stats */
+        (void)stcc4_periodic_get_stats(&periodic, &stats);
+        stcc4_interface_debug_print("stcc4: jitter min %dus, max %dus, mean %dus.\n", 
+                                    stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+        stcc4_interface_debug_print("stcc4: %d missed deadlines.\n", stats.missed);
+        
         /* basic deinit */
         (void)stcc4_basic_deinit();
         
         return 0;
     }
+    else if (strcmp("e_publish", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        stcc4_shm_t shm;
+        stcc4_shm_sample_t sample;
+        stcc4_periodic_t periodic;
+        
+        /* create the shared memory */
+        res = stcc4_shm_create(&shm, STCC4_SHM_NAME);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: create %s failed.\n", STCC4_SHM_NAME);
+            
+            return 1;
+        }
+        
+        /* basic init */
+        res = stcc4_basic_init(address);
+        if (res != 0)
+        {
+            (void)stcc4_shm_close(&shm);
+            
+            return 1;
+        }
+        
+        /* sample half a period after the sensor update on absolute 1000ms deadlines */
+        stcc4_interface_delay_ms(500);
+        res = stcc4_periodic_init(&periodic, 1000, stcc4_interface_timestamp_us, stcc4_interface_sleep_until_us);
+        if (res != 0)
+        {
+            (void)stcc4_basic_deinit();
+            (void)stcc4_shm_close(&shm);
+            
+            return 1;
+        }
+        
+        /* loop */
+        memset(&sample, 0, sizeof(stcc4_shm_sample_t));
+        for (i = 0; i < times; i++)
+        {
+            /* wait for the next deadline */
+            (void)stcc4_periodic_wait(&periodic);
+            
+            /* read data */
+            res = stcc4_basic_read(&sample.co2_ppm, &sample.temperature, &sample.humidity);
+            if (res != 0)
+            {
+                (void)stcc4_basic_deinit();
+                (void)stcc4_shm_close(&shm);
+                
+                return 1;
+            }
+            
+            /* publish */
+            sample.timestamp_us = stcc4_interface_timestamp_us();
+            sample.count++;
+            (void)stcc4_shm_publish(&shm, &sample);
+            
+            /* output */
+            stcc4_interface_debug_print("stcc4: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            stcc4_interface_debug_print("stcc4: published co2 %02dppm to %s.\n", sample.co2_ppm, STCC4_SHM_NAME);
+        }
+        
+        /* deinit, the last sample stays readable */
+        (void)stcc4_basic_deinit();
+        (void)stcc4_shm_close(&shm);
+        
+        return 0;
+    }
+    else if (strcmp("e_subscribe", type) == 0)
+    {
+        stcc4_shm_t shm;
+        stcc4_shm_sample_t sample;
+        
+        /* open the shared memory */
+        if (stcc4_shm_open(&shm, STCC4_SHM_NAME) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: open %s failed.\n", STCC4_SHM_NAME);
+            
+            return 1;
+        }
+        
+        /* read the latest sample */
+        if (stcc4_shm_read(&shm, &sample) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: no sample is published.\n");
+            (void)stcc4_shm_close(&shm);
+            
+            return 1;
+        }
+        
+        /* output */
+        stcc4_interface_debug_print("stcc4: sample %d at %dus.\n", sample.count, sample.timestamp_us);
+        stcc4_interface_debug_print("stcc4: co2 is %02dppm.\n", sample.co2_ppm);
+        stcc4_interface_debug_print("stcc4: temperature is %0.2fC.\n", sample.temperature);
+        stcc4_interface_debug_print("stcc4: humidity is %0.2f%%.\n", sample.humidity);
+        (void)stcc4_shm_close(&shm);
+        
+        return 0;
+    }
     else if (strcmp("e_shot", type) == 0)
     {
         uint8_t res;
@@ -394,20 +707,46 @@ uint8_t stcc4(uint8_t argc, char **argv)
         stcc4_interface_debug_print("  stcc4 (-p | --port)\n");
         stcc4_interface_debug_print("  stcc4 (-t reg | --test=reg) [--addr=<0 | 1>]\n");
         stcc4_interface_debug_print("  stcc4 (-t read | --test=read) [--addr=<0 | 1>] [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t crc | --test=crc) [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t convert | --test=convert) [--addr=<0 | 1>] [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t bus | --test=bus) [--addr=<0 | 1>] [--times=<num>]\n");
+#ifdef STCC4_SIMULATOR
+        stcc4_interface_debug_print("  stcc4 (-t sim | --test=sim) [--addr=<0 | 1>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t fleet | --test=fleet) [--times=<num>]\n");
+#endif
+#if (STCC4_INSTRUMENTATION != 0)
+        stcc4_interface_debug_print("  stcc4 (-t stats | --test=stats) [--addr=<0 | 1>] [--times=<num>]\n");
+#endif
+#ifdef STCC4_CPP
+        stcc4_interface_debug_print("  stcc4 (-t cpp | --test=cpp) [--addr=<0 | 1>] [--times=<num>]\n");
+#endif
+#ifdef STCC4_CORO
+        stcc4_interface_debug_print("  stcc4 (-t coro | --test=coro) [--addr=<0 | 1>] [--times=<num>]\n");
+#endif
+        stcc4_interface_debug_print("  stcc4 (-t ring | --test=ring) [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t shm | --test=shm) [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t cache | --test=cache) [--addr=<0 | 1>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t log | --test=log) [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t codec | --test=codec) [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t rollup | --test=rollup) [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t filter | --test=filter) [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t multi | --test=multi) [--addr=<0 | 1>] [--times=<num>]\n");
         stcc4_interface_debug_print("  stcc4 (-e read | --example=read) [--addr=<0 | 1>] [--times=<num>]\n");
         stcc4_interface_debug_print("  stcc4 (-e shot | --example=shot) [--addr=<0 | 1>] [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-e publish | --example=publish) [--addr=<0 | 1>] [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-e subscribe | --example=subscribe)\n");
         stcc4_interface_debug_print("  stcc4 (-e wake-up | --example=wake-up) [--addr=<0 | 1>]\n");
         stcc4_interface_debug_print("  stcc4 (-e power-down | --example=power-down) [--addr=<0 | 1>]\n");
         stcc4_interface_debug_print("  stcc4 (-e number | --example=number) [--addr=<0 | 1>]\n");
         stcc4_interface_debug_print("\n");
         stcc4_interface_debug_print("Options:\n");
         stcc4_interface_debug_print("      --addr=<0 | 1>    Set the chip address.([default: 0])\n");
-        stcc4_interface_debug_print("  -e <read | shot | wake-up | power-down | number>, --example=<read | shot | wake-up | power-down | number>\n");
+        stcc4_interface_debug_print("  -e <read | shot | publish | subscribe | wake-up | power-down | number>, --example=<read | shot | publish | subscribe | wake-up | power-down | number>\n");
         stcc4_interface_debug_print("                        Run the driver example.\n");
         stcc4_interface_debug_print("  -h, --help            Show the help.\n");
         stcc4_interface_debug_print("  -i, --information     Show the chip information.\n");
         stcc4_interface_debug_print("  -p, --port            Display the pin connections of the current board.\n");
-        stcc4_interface_debug_print("  -t <reg | read>, --test=<reg | read>\n");
+        stcc4_interface_debug_print("  -t <reg | read | crc | convert | bus | ring | shm | cache | log | codec | rollup | filter | multi>, --test=<reg | read | crc | convert | bus | ring | shm | cache | log | codec | rollup | filter | multi>\n");
         stcc4_interface_debug_print("                        Run the driver test.\n");
         stcc4_interface_debug_print("      --times=<num>     Set the running times.([default: 3])\n");
         
@@ -94,6 +94,170 @@ uint8_t stcc4_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
     return iic_read_cmd(addr, buf, len);
 }
 
+/**
+ * @brief      interface iic bus write and read command in one transfer
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the read follows the write with a repeated start
+ */
+uint8_t stcc4_interface_iic_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    if (wlen == 2)
+    {
+        return iic_read_address16(addr, (uint16_t)(((uint16_t)wbuf[0] << 8) | wbuf[1]), rbuf, rlen);
+    }
+    if (iic_write_cmd(addr, wbuf, wlen) != 0)
+    {
+        return 1;
+    }
+    
+    return iic_read_cmd(addr, rbuf, rlen);
+}
+
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      the board has one iic bus, index is ignored
+ */
+uint8_t stcc4_interface_iic_init_ctx(void *user)
+{
+    ((stcc4_interface_bus_t *)user)->fd = 0;
+    
+    return stcc4_interface_iic_init();
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_deinit_ctx(void *user)
+{
+    (void)user;
+    
+    return stcc4_interface_iic_deinit();
+}
+
+/**
+ * @brief     interface iic bus write command with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t stcc4_interface_iic_write_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)user;
+    
+    return stcc4_interface_iic_write_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with a user context
+ * @param[in]  *user pointer to a stcc4_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t stcc4_interface_iic_read_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)user;
+    
+    return stcc4_interface_iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus write and read command in one transfer with a user context
+ * @param[in]  *user pointer to a stcc4_interface_bus_t structure
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       the read follows the write with a repeated start
+ */
+uint8_t stcc4_interface_iic_write_read_cmd_ctx(void *user, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    (void)user;
+    
+    return stcc4_interface_iic_write_read_cmd(addr, wbuf, wlen, rbuf, rlen);
+}
+
+/**
+ * @brief     interface delay ms with a user context
+ * @param[in] *user pointer to a stcc4_interface_bus_t structure
+ * @param[in] ms time
+ * @note      none
+ */
+void stcc4_interface_delay_ms_ctx(void *user, uint32_t ms)
+{
+    (void)user;
+    
+    stcc4_interface_delay_ms(ms);
+}
+
+/**
+ * @brief  interface timestamp us
+ * @return free running timestamp in us
+ * @note   optional, used by the instrumentation to measure the bus and delay time
+ */
+uint32_t stcc4_interface_timestamp_us(void)
+{
+    uint32_t ms;
+    uint32_t val;
+    
+    do
+    {
+        ms = HAL_GetTick();
+        val = SysTick->VAL;
+    } while (ms != HAL_GetTick());
+    
+    return ms * 1000 + ((SysTick->LOAD + 1 - val) * 1000) / (SysTick->LOAD + 1);
+}
+
+/**
+ * @brief     interface sleep until an absolute time
+ * @param[in] deadline_us deadline on the stcc4_interface_timestamp_us clock
+ * @note      returns at once when the deadline has passed
+ */
+void stcc4_interface_sleep_until_us(uint32_t deadline_us)
+{
+    /* sleep tick by tick */
+    while ((int32_t)(deadline_us - stcc4_interface_timestamp_us()) > 1000)
+    {
+        __WFI();
+    }
+    
+    /* spin the last tick */
+    while ((int32_t)(deadline_us - stcc4_interface_timestamp_us()) > 0)
+    {
+        
+    }
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -36,8 +36,10 @@
 
 #include "driver_stcc4_read_test.h"
 #include "driver_stcc4_register_test.h"
+#include "driver_stcc4_crc_test.h"
 #include "driver_stcc4_basic.h"
 #include "driver_stcc4_shot.h"
+#include "driver_stcc4_periodic.h"
 #include "shell.h"
 #include "clock.h"
 #include "delay.h"
@@ -213,6 +215,16 @@ uint8_t stcc4(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_crc", type) == 0)
+    {
+        /* run crc test */
+        if (stcc4_crc_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
@@ -220,6 +232,8 @@ uint8_t stcc4(uint8_t argc, char **argv)
         int16_t co2_ppm;
         float temperature;
         float humidity;
+        stcc4_periodic_t periodic;
+        stcc4_periodic_stats_t stats;
         
         /* basic init */
         res = stcc4_basic_init(address);
@@ -228,11 +242,21 @@ uint8_t stcc4(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* sample half a period after the sensor update on absolute 1000ms deadlines */
+        stcc4_interface_delay_ms(500);
+        res = stcc4_periodic_init(&periodic, 1000, stcc4_interface_timestamp_us, stcc4_interface_sleep_until_us);
+        if (res != 0)
+        {
+            (void)stcc4_basic_deinit();
+            
+            return 1;
+        }
+        
         /* loop */
         for (i = 0; i < times; i++)
         {
-            /* delay 1000ms */
-            stcc4_interface_delay_ms(1000);
+            /* wait for the next deadline */
+            (void)stcc4_periodic_wait(&periodic);
             
             /* read data */
             res = stcc4_basic_read((int16_t *)&co2_ppm, (float *)&temperature, (float *)&humidity);
@@ -250,6 +274,12 @@ uint8_t stcc4(uint8_t argc, char **argv)
             stcc4_interface_debug_print("stcc4: humidity is %0.2f%%.\n", humidity);
         }
         
+        /* output the period stats */
+        (void)stcc4_periodic_get_stats(&periodic, &stats);
+        stcc4_interface_debug_print("stcc4: jitter min %dus, max %dus, mean %dus.\n", 
+                                    stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+        stcc4_interface_debug_print("stcc4: %d missed deadlines.\n", stats.missed);
+        
         /* basic deinit */
         (void)stcc4_basic_deinit();
         
@@ -404,6 +434,7 @@ uint8_t stcc4(uint8_t argc, char **argv)
         stcc4_interface_debug_print("  stcc4 (-p | --port)\n");
         stcc4_interface_debug_print("  stcc4 (-t reg | --test=reg) [--addr=<0 | 1>]\n");
         stcc4_interface_debug_print("  stcc4 (-t read | --test=read) [--addr=<0 | 1>] [--times=<num>]\n");
+        stcc4_interface_debug_print("  stcc4 (-t crc | --test=crc) [--times=<num>]\n");
         stcc4_interface_debug_print("  stcc4 (-e read | --example=read) [--addr=<0 | 1>] [--times=<num>]\n");
         stcc4_interface_debug_print("  stcc4 (-e shot | --example=shot) [--addr=<0 | 1>] [--times=<num>]\n");
         stcc4_interface_debug_print("  stcc4 (-e wake-up | --example=wake-up) [--addr=<0 | 1>]\n");
@@ -417,7 +448,7 @@ uint8_t stcc4(uint8_t argc, char **argv)
         stcc4_interface_debug_print("  -h, --help            Show the help.\n");
         stcc4_interface_debug_print("  -i, --information     Show the chip information.\n");
         stcc4_interface_debug_print("  -p, --port            Display the pin connections of the current board.\n");
-        stcc4_interface_debug_print("  -t <reg | read>, --test=<reg | read>\n");
+        stcc4_interface_debug_print("  -t <reg | read | crc>, --test=<reg | read | crc>\n");
         stcc4_interface_debug_print("                        Run the driver test.\n");
         stcc4_interface_debug_print("      --times=<num>     Set the running times.([default: 3])\n");
         
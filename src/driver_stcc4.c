@@ -36,6 +36,41 @@
 
 #include "driver_stcc4.h"
 
+/**
+ * @brief batch convert simd kernel selection
+ */
+#if (STCC4_CONVERT_SIMD != 0)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define STCC4_CONVERT_KERNEL_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define STCC4_CONVERT_KERNEL_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define STCC4_CONVERT_KERNEL_NEON
+#endif
+#endif
+
+/**
+ * @brief linked functions accessor definition
+ */
+#if (STCC4_OPS_TABLE != 0)
+    #define STCC4_OPS(handle)        ((handle)->ops)        /**< functions in the shared ops table */
+#else
+    #define STCC4_OPS(handle)        (handle)               /**< functions in the handle */
+#endif
+
+#if (STCC4_OPS_TABLE != 0)
+/**
+ * @brief shared ops table definition
+ */
+stcc4_ops_t stcc4_link_ops;                                /**< table filled by the link macros */
+static const stcc4_ops_t *gs_ops_checked = NULL;           /**< last checked const table */
+static stcc4_ops_t gs_link_snapshot;                       /**< link table of the inited handles */
+static uint32_t gs_link_users = 0;                         /**< inited handles on the link table */
+#endif
+
 /**
  * @brief chip information definition
  */
@@ -75,855 +110,1963 @@
 #define STCC4_CRC8_INIT              0xFF
 
 /**
- * @brief      read bytes with param
- * @param[in]  *handle pointer to a stcc4 handle structure
- * @param[in]  reg iic register address
- * @param[in]  *data pointer to a data buffer
- * @param[in]  len data length
- * @param[in]  delay_ms delay time in ms
- * @param[out] *output pointer to an output buffer
- * @param[in]  output_len output length
- * @return     status code
- *             - 0 success
- *             - 1 read failed
- * @note       none
+ * @brief measurement timing definition
+ */
+#define STCC4_SINGLE_SHOT_TIME_MS              500         /**< single shot conversion time */
+#define STCC4_CONTINUOUS_START_TIME_MS         1000        /**< first continuous sample time */
+#define STCC4_CONTINUOUS_PERIOD_MS             1000        /**< continuous sample period */
+#define STCC4_WRITE_READ_MAX_DELAY_MS          1           /**< max command delay served by one write read transfer */
+
+/**
+ * @brief command flag definition
  */
-static uint8_t a_stcc4_iic_read_with_param(stcc4_handle_t *handle, uint16_t reg, uint8_t *data, uint16_t len,
-                                           uint16_t delay_ms, uint8_t *output, uint16_t output_len)
+#define STCC4_COMMAND_FLAG_SHORT               (1 << 0)    /**< one byte opcode */
+#define STCC4_COMMAND_FLAG_GENERAL_CALL        (1 << 1)    /**< sent to the general call address */
+#define STCC4_COMMAND_FLAG_NACK                (1 << 2)    /**< the sensor nacks, the write result is ignored */
+#define STCC4_COMMAND_FLAG_CRC                 (1 << 3)    /**< check the crc of all response words */
+#define STCC4_COMMAND_FLAG_IDLE                (1 << 4)    /**< the command stops the running measurement */
+#define STCC4_COMMAND_MAX_PARAM                2           /**< max payload words */
+
+/**
+ * @brief stcc4 command descriptor structure definition
+ */
+typedef struct stcc4_command_s
 {
-    uint8_t buf[16];
-    uint16_t i;
-        
-    if ((len + 2) > 16)                                                            /* check length */
-    {
-        return 1;                                                                  /* return error */
-    }
-    memset(buf, 0, sizeof(uint8_t) * 16);                                          /* clear the buffer */
-    buf[0] = (uint8_t)((reg >> 8) & 0xFF);                                         /* set MSB of reg */
-    buf[1] = (uint8_t)(reg & 0xFF);                                                /* set LSB of reg */
-    for (i = 0; i < len; i++)
+    uint16_t opcode;          /**< command opcode */
+    uint16_t time_ms;         /**< execution time in ms */
+    uint8_t param;            /**< payload words */
+    uint8_t response;         /**< response words */
+    uint8_t flags;            /**< command flags */
+    const char *name;         /**< command name */
+} stcc4_command_t;
+
+/**
+ * @brief command descriptor table definition
+ * @note  indexed by stcc4_stats_command_t
+ */
+static const stcc4_command_t gs_command[STCC4_STATS_COMMAND_OTHER] =
+{
+    {STCC4_COMMAND_START_CONTINUOUS_MEASUREMENT, STCC4_CONTINUOUS_START_TIME_MS, 0, 0, 0,
+     "start continuous measurement"},
+    {STCC4_COMMAND_STOP_CONTINUOUS_MEASUREMENT, 1200, 0, 0, STCC4_COMMAND_FLAG_IDLE,
+     "stop continuous measurement"},
+    {STCC4_COMMAND_READ_MEASUREMENT, 1, 0, 4, 0,
+     "read measurement"},
+    {STCC4_COMMAND_SET_RHT_COMPENSATION, 1, 2, 0, 0,
+     "set rht compensation"},
+    {STCC4_COMMAND_SET_PRESSURE_COMPENSATION, 1, 1, 0, 0,
+     "set pressure compensation"},
+    {STCC4_COMMAND_MEASURE_SINGLE_SHOT, STCC4_SINGLE_SHOT_TIME_MS, 0, 0, 0,
+     "measure single shot"},
+    {STCC4_COMMAND_ENTER_SLEEP_MODE, 1, 0, 0, 0,
+     "enter sleep mode"},
+    {STCC4_COMMAND_EXIT_SLEEP_MODE, 5, 0, 0, STCC4_COMMAND_FLAG_SHORT | STCC4_COMMAND_FLAG_NACK,
+     "exit sleep mode"},
+    {STCC4_COMMAND_PERFORM_CONDITIONING, 22000, 0, 0, 0,
+     "perform conditioning"},
+    {STCC4_COMMAND_PERFORM_SOFT_RESET, 10, 0, 0, STCC4_COMMAND_FLAG_SHORT | STCC4_COMMAND_FLAG_GENERAL_CALL |
+     STCC4_COMMAND_FLAG_NACK | STCC4_COMMAND_FLAG_IDLE, "perform soft reset"},
+    {STCC4_COMMAND_PERFORM_FACTORY_RESET, 90, 0, 1, STCC4_COMMAND_FLAG_CRC,
+     "perform factory reset"},
+    {STCC4_COMMAND_PERFORM_SELF_TEST, 360, 0, 1, STCC4_COMMAND_FLAG_CRC,
+     "perform self test"},
+    {STCC4_COMMAND_ENABLE_TESTING_MODE, 0, 0, 0, 0,
+     "enable testing mode"},
+    {STCC4_COMMAND_DISABLE_TESTING_MODE, 0, 0, 0, 0,
+     "disable testing mode"},
+    {STCC4_COMMAND_PERFORM_FORCED_RECALIBRATION, 90, 1, 1, STCC4_COMMAND_FLAG_CRC,
+     "perform forced recalibration"},
+    {STCC4_COMMAND_GET_PRODUCT_ID, 1, 0, 6, STCC4_COMMAND_FLAG_CRC,
+     "get product id"},
+};
+
+#if (STCC4_INSTRUMENTATION != 0)
+/**
+ * @brief     get the stats timestamp
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @return    timestamp in us, 0 when timestamp_us is not linked
+ * @note      none
+ */
+static uint32_t a_stcc4_stats_timestamp(stcc4_handle_t *handle)
+{
+    if (STCC4_OPS(handle)->timestamp_us == NULL)        /* check timestamp_us */
     {
-        buf[2 + i] = data[i];                                                      /* copy write data */
+        return 0;                                       /* no timestamp */
     }
     
-    if (handle->iic_write_cmd(handle->iic_addr, (uint8_t *)buf, len + 2) != 0)     /* write iic command */
+    return STCC4_OPS(handle)->timestamp_us();           /* get the timestamp */
+}
+
+/**
+ * @brief     close the counted command latency
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @note      none
+ */
+static void a_stcc4_stats_close(stcc4_handle_t *handle)
+{
+    uint8_t bucket;
+    uint32_t latency;
+    
+    if (handle->stats_open == 0)                                                     /* check the open latency */
     {
-        return 1;                                                                  /* write command */
+        return;                                                                      /* nothing to close */
     }
-    handle->delay_ms(delay_ms);                                                    /* delay ms */
-    if (handle->iic_read_cmd(handle->iic_addr, output, output_len) != 0)           /* read data */
+    bucket = 0;                                                                      /* start from the first bucket */
+    latency = handle->stats_latency_us;                                              /* get the latency */
+    while ((latency > 1) && (bucket < (STCC4_STATS_HISTOGRAM_SIZE - 1)))             /* find the log2 bucket */
     {
-        return 1;                                                                  /* write command */
+        latency >>= 1;                                                               /* next power of 2 */
+        bucket++;                                                                    /* next bucket */
     }
-    else
+    handle->stats.command[handle->stats_command].histogram[bucket]++;                /* count the latency */
+    handle->stats_open = 0;                                                          /* close the latency */
+}
+#endif
+
+/**
+ * @brief     begin to count a command
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] index command index
+ * @note      the bus and delay time up to the next command are counted as the latency of this one
+ */
+static void a_stcc4_stats_begin(stcc4_handle_t *handle, uint8_t index)
+{
+#if (STCC4_INSTRUMENTATION != 0)
+    a_stcc4_stats_close(handle);                                                     /* close the last latency */
+    handle->stats.command[index].calls++;                                            /* count the call */
+    handle->stats_command = index;                                                   /* set the command */
+    handle->stats_latency_us = 0;                                                    /* clear the latency */
+    handle->stats_open = 1;                                                          /* open the latency */
+#else
+    (void)handle;
+    (void)index;
+#endif
+}
+
+/**
+ * @brief     count a crc error of the current command
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @note      none
+ */
+static void a_stcc4_stats_crc_error(stcc4_handle_t *handle)
+{
+#if (STCC4_INSTRUMENTATION != 0)
+    if (handle->stats_open != 0)                                                     /* check the open command */
     {
-        return 0;                                                                  /* success return 0 */
+        handle->stats.command[handle->stats_command].crc_errors++;                   /* count the crc error */
     }
+#else
+    (void)handle;
+#endif
 }
 
+#if (STCC4_INSTRUMENTATION != 0)
 /**
- * @brief      read bytes
- * @param[in]  *handle pointer to a stcc4 handle structure
- * @param[in]  reg iic register address
- * @param[out] *data pointer to a data buffer
- * @param[in]  len data length
- * @param[in]  delay_ms delay time in ms
- * @return     status code
- *             - 0 success
- *             - 1 read failed
- * @note       none
+ * @brief     count a bus transfer of the current command
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] start transfer start timestamp in us
+ * @param[in] bytes transferred bytes
+ * @param[in] res transfer result
+ * @note      none
  */
-static uint8_t a_stcc4_iic_read(stcc4_handle_t *handle, uint16_t reg, uint8_t *data, uint16_t len, uint16_t delay_ms)
+static void a_stcc4_stats_bus(stcc4_handle_t *handle, uint32_t start, uint16_t bytes, uint8_t res)
 {
-    uint8_t buf[2];
+    uint32_t elapsed;
+    stcc4_command_stats_t *stats;
     
-    memset(buf, 0, sizeof(uint8_t) * 2);                                     /* clear the buffer */
-    buf[0] = (uint8_t)((reg >> 8) & 0xFF);                                   /* set reg MSB */
-    buf[1] = (uint8_t)(reg & 0xFF);                                          /* set reg LSB */
-    if (handle->iic_write_cmd(handle->iic_addr, (uint8_t *)buf, 2) != 0)     /* write command */
-    {   
-        return 1;                                                            /* return error */
-    }
-    handle->delay_ms(delay_ms);                                              /* delay ms */
-    if (handle->iic_read_cmd(handle->iic_addr, data, len) != 0)              /* read data */
+    if (handle->stats_open == 0)                                                     /* check the open command */
     {
-        return 1;                                                            /* write command */
+        return;                                                                      /* not counted */
     }
-    else
+    stats = &handle->stats.command[handle->stats_command];                           /* get the command stats */
+    elapsed = a_stcc4_stats_timestamp(handle) - start;                               /* get the elapsed time */
+    stats->bus_bytes += bytes;                                                       /* count the bytes */
+    if (res != 0)                                                                    /* check the result */
     {
-        return 0;                                                            /* success return 0 */
+        stats->iic_errors++;                                                         /* count the error */
     }
+    stats->bus_us += elapsed;                                                        /* count the bus time */
+    handle->stats_latency_us += elapsed;                                             /* count the latency */
 }
+#endif
 
 /**
- * @brief     write bytes
+ * @brief     hook iic init
  * @param[in] *handle pointer to a stcc4 handle structure
- * @param[in] reg iic register address
- * @param[in] *data pointer to a data buffer
- * @param[in] len data length
  * @return    status code
  *            - 0 success
- *            - 1 write failed
- * @note      none
+ *            - 1 iic init failed
+ * @note      the *_ctx function gets the user context and wins over the plain one
  */
-static uint8_t a_stcc4_iic_write(stcc4_handle_t *handle, uint16_t reg, uint8_t *data, uint16_t len)
+static uint8_t a_stcc4_hook_init(stcc4_handle_t *handle)
 {
-    uint8_t buf[16];
-    uint16_t i;
-        
-    if ((len + 2) > 16)                                                            /* check length */
-    {
-        return 1;                                                                  /* return error */
-    }
-    memset(buf, 0, sizeof(uint8_t) * 16);                                          /* clear the buffer */
-    buf[0] = (uint8_t)((reg >> 8) & 0xFF);                                         /* set MSB of reg */
-    buf[1] = (uint8_t)(reg & 0xFF);                                                /* set LSB of reg */
-    for (i = 0; i < len; i++)
+    if (STCC4_OPS(handle)->iic_init_ctx != NULL)                                     /* check iic_init_ctx */
     {
-        buf[2 + i] = data[i];                                                      /* copy write data */
+        return STCC4_OPS(handle)->iic_init_ctx(handle->user);                        /* iic init with the context */
     }
     
-    if (handle->iic_write_cmd(handle->iic_addr, (uint8_t *)buf, len + 2) != 0)     /* write iic command */
-    {
-        return 1;                                                                  /* write command */
-    }
-    else
-    {
-        return 0;                                                                  /* success return 0 */
-    }
+    return STCC4_OPS(handle)->iic_init();                                            /* iic init */
 }
 
 /**
- * @brief     generate the crc
- * @param[in] *data pointer to a data buffer
- * @param[in] count data length
- * @return    crc
+ * @brief     hook iic deinit
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
  * @note      none
  */
-static uint8_t a_stcc4_generate_crc(uint8_t* data, uint8_t count)
+static uint8_t a_stcc4_hook_deinit(stcc4_handle_t *handle)
 {
-    uint8_t current_byte;
-    uint8_t crc = STCC4_CRC8_INIT;
-    uint8_t crc_bit;
-
-    for (current_byte = 0; current_byte < count; ++current_byte)        /* calculate crc */
+    if (STCC4_OPS(handle)->iic_deinit_ctx != NULL)                                   /* check iic_deinit_ctx */
     {
-        crc ^= (data[current_byte]);                                    /* xor data */
-        for (crc_bit = 8; crc_bit > 0; --crc_bit)                       /* 8 bit */
-        {
-            if ((crc & 0x80) != 0)                                      /* if 7th bit is 1 */
-            {
-                crc = (crc << 1) ^ STCC4_CRC8_POLYNOMIAL;               /* xor */
-            }
-            else
-            {
-                crc = crc << 1;                                         /* left shift 1 */
-            }
-        }
+        return STCC4_OPS(handle)->iic_deinit_ctx(handle->user);                      /* iic deinit with the context */
     }
     
-    return crc;                                                         /* return crc */
+    return STCC4_OPS(handle)->iic_deinit();                                          /* iic deinit */
 }
 
 /**
- * @brief     set address pin
+ * @brief     hook iic write command
  * @param[in] *handle pointer to a stcc4 handle structure
- * @param[in] address address pin
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
  * @return    status code
  *            - 0 success
- *            - 2 handle is NULL
+ *            - 1 write failed
  * @note      none
  */
-uint8_t stcc4_set_address_pin(stcc4_handle_t *handle, stcc4_address_t address)
+static uint8_t a_stcc4_hook_write(stcc4_handle_t *handle, uint8_t addr, uint8_t *buf, uint16_t len)
 {
-    if (handle == NULL)                         /* check handle */
+    if (STCC4_OPS(handle)->iic_write_cmd_ctx != NULL)                                /* check iic_write_cmd_ctx */
     {
-        return 2;                               /* return error */
+        return STCC4_OPS(handle)->iic_write_cmd_ctx(handle->user, addr, buf, len);   /* write command with the context */
     }
     
-    handle->iic_addr = (uint8_t)address;        /* set address */
-    
-    return 0;                                   /* success return 0 */
+    return STCC4_OPS(handle)->iic_write_cmd(addr, buf, len);                         /* write command */
 }
 
 /**
- * @brief      get address pin
+ * @brief      hook iic read command
  * @param[in]  *handle pointer to a stcc4 handle structure
- * @param[out] *address pointer to an address buffer
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
  * @return     status code
  *             - 0 success
- *             - 2 handle is NULL
+ *             - 1 read failed
  * @note       none
  */
-uint8_t stcc4_get_address_pin(stcc4_handle_t *handle, stcc4_address_t *address)
+static uint8_t a_stcc4_hook_read(stcc4_handle_t *handle, uint8_t *buf, uint16_t len)
 {
-    if (handle == NULL)                                    /* check handle */
+    if (STCC4_OPS(handle)->iic_read_cmd_ctx != NULL)                                 /* check iic_read_cmd_ctx */
     {
-        return 2;                                          /* return error */
+        return STCC4_OPS(handle)->iic_read_cmd_ctx(handle->user, handle->iic_addr, buf, len); /* read data with the context */
     }
     
-    *address = (stcc4_address_t)(handle->iic_addr);        /* get address */
-    
-    return 0;                                              /* success return 0 */
+    return STCC4_OPS(handle)->iic_read_cmd(handle->iic_addr, buf, len);              /* read data */
 }
 
 /**
- * @brief     start continuous measurement
- * @param[in] *handle pointer to an stcc4 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 start continuous measurement failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      hook iic write read command
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       none
  */
-uint8_t stcc4_start_continuous_measurement(stcc4_handle_t *handle)
+static uint8_t a_stcc4_hook_write_read(stcc4_handle_t *handle, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                                                          /* check handle */
-    {
-        return 2;                                                                                /* return error */
-    }
-    if (handle->inited != 1)                                                                     /* check handle initialization */
-    {
-        return 3;                                                                                /* return error */
-    }
-
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_START_CONTINUOUS_MEASUREMENT, NULL, 0);        /* write config */
-    if (res != 0)                                                                                /* check result */
+    if (STCC4_OPS(handle)->iic_write_read_cmd_ctx != NULL)                           /* check iic_write_read_cmd_ctx */
     {
-        handle->debug_print("stcc4: start continuous measurement failed.\n");                    /* start continuous measurement failed */
-       
-        return 1;                                                                                /* return error */
+        return STCC4_OPS(handle)->iic_write_read_cmd_ctx(handle->user, handle->iic_addr,
+                                              wbuf, wlen, rbuf, rlen);               /* write and read with the context */
     }
-    handle->delay_ms(1000);                                                                      /* wait 1000ms */
     
-    return 0;                                                                                    /* success return 0 */
+    return STCC4_OPS(handle)->iic_write_read_cmd(handle->iic_addr, wbuf, wlen, rbuf, rlen); /* write and read */
 }
 
 /**
- * @brief     stop continuous measurement
- * @param[in] *handle pointer to an stcc4 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 stop continuous measurement failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ * @brief     hook delay ms
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] ms time
  * @note      none
  */
-uint8_t stcc4_stop_continuous_measurement(stcc4_handle_t *handle)
+static void a_stcc4_hook_delay_ms(stcc4_handle_t *handle, uint32_t ms)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                                                         /* check handle */
-    {
-        return 2;                                                                               /* return error */
-    }
-    if (handle->inited != 1)                                                                    /* check handle initialization */
-    {
-        return 3;                                                                               /* return error */
-    }
-
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_STOP_CONTINUOUS_MEASUREMENT, NULL, 0);        /* write config */
-    if (res != 0)                                                                               /* check result */
+    if (STCC4_OPS(handle)->delay_ms_ctx != NULL)                                     /* check delay_ms_ctx */
     {
-        handle->debug_print("stcc4: stop continuous measurement failed.\n");                    /* stop continuous measurement failed */
-       
-        return 1;                                                                               /* return error */
+        STCC4_OPS(handle)->delay_ms_ctx(handle->user, ms);                           /* delay ms with the context */
+        
+        return;                                                                      /* return */
     }
-    handle->delay_ms(1200);                                                                     /* wait 1200ms */
     
-    return 0;                                                                                   /* success return 0 */
+    STCC4_OPS(handle)->delay_ms(ms);                                                 /* delay ms */
 }
 
 /**
- * @brief     set rht compensation
+ * @brief     bus write command
  * @param[in] *handle pointer to a stcc4 handle structure
- * @param[in] temperature_raw raw temperature
- * @param[in] humidity_raw raw humidity
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
  * @return    status code
  *            - 0 success
- *            - 1 set rht compensation failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 write failed
  * @note      none
  */
-uint8_t stcc4_set_rht_compensation(stcc4_handle_t *handle, uint16_t temperature_raw, uint16_t humidity_raw)
+static uint8_t a_stcc4_bus_write(stcc4_handle_t *handle, uint8_t addr, uint8_t *buf, uint16_t len)
 {
+#if (STCC4_INSTRUMENTATION != 0)
     uint8_t res;
-    uint8_t buf[6];
+    uint32_t start;
     
-    if (handle == NULL)                                                                 /* check handle */
-    {
-        return 2;                                                                       /* return error */
-    }
-    if (handle->inited != 1)                                                            /* check handle initialization */
-    {
-        return 3;                                                                       /* return error */
-    }
-
-    buf[0] = (temperature_raw >> 8) & 0xFF;                                             /* set temperature msb */
-    buf[1] = (temperature_raw >> 0) & 0xFF;                                             /* set temperature lsb */
-    buf[2] = a_stcc4_generate_crc(buf + 0, 2);                                          /* set temperature crc */
-    buf[3] = (humidity_raw >> 8) & 0xFF;                                                /* set humidity msb */
-    buf[4] = (humidity_raw >> 0) & 0xFF;                                                /* set humidity lsb */
-    buf[5] = a_stcc4_generate_crc(buf + 3, 2);                                          /* set humidity crc */
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_SET_RHT_COMPENSATION, buf, 6);        /* write config */
-    if (res != 0)                                                                       /* check result */
-    {
-        handle->debug_print("stcc4: set rht compensation failed.\n");                   /* set rht compensation failed */
-       
-        return 1;                                                                       /* return error */
-    }
-    handle->delay_ms(1);                                                                /* wait 1ms */
+    start = a_stcc4_stats_timestamp(handle);                                         /* get the start time */
+    res = a_stcc4_hook_write(handle, addr, buf, len);                                /* write command */
+    a_stcc4_stats_bus(handle, start, len, res);                                      /* count the transfer */
     
-    return 0;                                                                           /* success return 0 */
+    return res;                                                                      /* return the result */
+#else
+    return a_stcc4_hook_write(handle, addr, buf, len);                               /* write command */
+#endif
 }
 
 /**
- * @brief     set pressure compensation
- * @param[in] *handle pointer to a stcc4 handle structure
- * @param[in] pressure_raw raw pressure
- * @return    status code
- *            - 0 success
- *            - 1 set pressure compensation failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      bus read command
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
  */
-uint8_t stcc4_set_pressure_compensation(stcc4_handle_t *handle, uint16_t pressure_raw)
+static uint8_t a_stcc4_bus_read(stcc4_handle_t *handle, uint8_t *buf, uint16_t len)
 {
+#if (STCC4_INSTRUMENTATION != 0)
     uint8_t res;
-    uint8_t buf[3];
+    uint32_t start;
     
-    if (handle == NULL)                                                                       /* check handle */
-    {
-        return 2;                                                                             /* return error */
-    }
-    if (handle->inited != 1)                                                                  /* check handle initialization */
-    {
-        return 3;                                                                             /* return error */
-    }
-
-    buf[0] = (pressure_raw >> 8) & 0xFF;                                                      /* set pressure msb */
-    buf[1] = (pressure_raw >> 0) & 0xFF;                                                      /* set pressure lsb */
-    buf[2] = a_stcc4_generate_crc(buf + 0, 2);                                                /* set pressure crc */
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_SET_PRESSURE_COMPENSATION, buf, 3);         /* write config */
-    if (res != 0)                                                                             /* check result */
-    {
-        handle->debug_print("stcc4: set pressure compensation failed.\n");                    /* set pressure compensation failed */
-       
-        return 1;                                                                             /* return error */
-    }
-    handle->delay_ms(1);                                                                      /* wait 1ms */
+    start = a_stcc4_stats_timestamp(handle);                                         /* get the start time */
+    res = a_stcc4_hook_read(handle, buf, len);                                       /* read data */
+    a_stcc4_stats_bus(handle, start, len, res);                                      /* count the transfer */
     
-    return 0;                                                                                 /* success return 0 */
+    return res;                                                                      /* return the result */
+#else
+    return a_stcc4_hook_read(handle, buf, len);                                      /* read data */
+#endif
 }
 
 /**
- * @brief     measure single shot
- * @param[in] *handle pointer to an stcc4 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 measure single shot failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      bus write read command
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       none
  */
-uint8_t stcc4_measure_single_shot(stcc4_handle_t *handle)
+static uint8_t a_stcc4_bus_write_read(stcc4_handle_t *handle, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
 {
+#if (STCC4_INSTRUMENTATION != 0)
     uint8_t res;
+    uint32_t start;
+    
+    start = a_stcc4_stats_timestamp(handle);                                         /* get the start time */
+    res = a_stcc4_hook_write_read(handle, wbuf, wlen, rbuf, rlen);                   /* write and read */
+    a_stcc4_stats_bus(handle, start, (uint16_t)(wlen + rlen), res);                  /* count the transfer */
+    
+    return res;                                                                      /* return the result */
+#else
+    return a_stcc4_hook_write_read(handle, wbuf, wlen, rbuf, rlen);                  /* write and read */
+#endif
+}
+
+/**
+ * @brief     delay ms
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] ms time
+ * @note      without timestamp_us the requested time is counted
+ */
+static void a_stcc4_delay_ms(stcc4_handle_t *handle, uint32_t ms)
+{
+#if (STCC4_INSTRUMENTATION != 0)
+    uint32_t start;
+    uint32_t elapsed;
     
-    if (handle == NULL)                                                                 /* check handle */
+    start = a_stcc4_stats_timestamp(handle);                                         /* get the start time */
+    a_stcc4_hook_delay_ms(handle, ms);                                               /* delay ms */
+    if (STCC4_OPS(handle)->timestamp_us != NULL)                                     /* check timestamp_us */
     {
-        return 2;                                                                       /* return error */
+        elapsed = STCC4_OPS(handle)->timestamp_us() - start;                         /* get the elapsed time */
     }
-    if (handle->inited != 1)                                                            /* check handle initialization */
+    else
     {
-        return 3;                                                                       /* return error */
+        elapsed = ms * 1000;                                                         /* use the requested time */
     }
-
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_MEASURE_SINGLE_SHOT, NULL, 0);        /* write config */
-    if (res != 0)                                                                       /* check result */
+    if (handle->stats_open != 0)                                                     /* check the open command */
     {
-        handle->debug_print("stcc4: measure single shot failed.\n");                    /* measure single shot failed */
-       
-        return 1;                                                                       /* return error */
+        handle->stats.command[handle->stats_command].delay_us += elapsed;            /* count the delay time */
+        handle->stats_latency_us += elapsed;                                         /* count the latency */
     }
-    handle->delay_ms(500);                                                              /* wait 500ms */
-    
+#else
+    a_stcc4_hook_delay_ms(handle, ms);                                               /* delay ms */
+#endif
+}
+
+/**
+ * @brief      poll the sensor until it acks a read
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  index command index
+ * @param[in]  resend resend the command before every read
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @param[in]  worst_ms worst case ready time in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the first read is after the lower bound, then the back-off step doubles up to the max step 
+ *             and the last read is at the worst case time
+ */
+static uint8_t a_stcc4_poll_read(stcc4_handle_t *handle, uint8_t index, uint8_t resend,
+                                 uint8_t *data, uint16_t len, uint32_t worst_ms)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    uint32_t elapsed;
+    uint32_t step;
+    uint32_t wait;
+    
+    elapsed = worst_ms * handle->poll_lower_percent / 100;                           /* get the lower bound */
+    a_stcc4_delay_ms(handle, elapsed);                                               /* wait the lower bound */
+    step = (handle->poll_first_step_ms != 0) ? handle->poll_first_step_ms : 1;       /* set the first step */
+    while (1)
+    {
+        if (resend != 0)                                                             /* check the resend */
+        {
+            buf[0] = (uint8_t)((gs_command[index].opcode >> 8) & 0xFF);              /* set opcode MSB */
+            buf[1] = (uint8_t)(gs_command[index].opcode & 0xFF);                     /* set opcode LSB */
+            a_stcc4_stats_begin(handle, index);                                      /* begin the command stats */
+            res = a_stcc4_bus_write(handle, handle->iic_addr, buf, 2);               /* write command */
+            if (res == 0)                                                            /* check result */
+            {
+                a_stcc4_delay_ms(handle, STCC4_WRITE_READ_MAX_DELAY_MS);             /* wait the command */
+                elapsed += STCC4_WRITE_READ_MAX_DELAY_MS;                            /* count the wait */
+                res = a_stcc4_bus_read(handle, data, len);                           /* read data */
+            }
+        }
+        else
+        {
+            res = a_stcc4_bus_read(handle, data, len);                               /* read data */
+        }
+        if (res == 0)                                                                /* check result */
+        {
+            handle->ready_ms = elapsed;                                              /* save the ready time */
+            
+            return 0;                                                                /* success return 0 */
+        }
+        if (elapsed >= worst_ms)                                                     /* check the worst case */
+        {
+            return 1;                                                                /* return error */
+        }
+        wait = (step < (worst_ms - elapsed)) ? step : (worst_ms - elapsed);          /* clamp to the worst case */
+        a_stcc4_delay_ms(handle, wait);                                              /* wait the step */
+        elapsed += wait;                                                             /* count the wait */
+        step *= 2;                                                                   /* double the step */
+        if ((handle->poll_max_step_ms != 0) && (step > handle->poll_max_step_ms))    /* check the max step */
+        {
+            step = handle->poll_max_step_ms;                                         /* limit the step */
+        }
+    }
+}
+
+/**
+ * @brief     find the descriptor index of a command
+ * @param[in] reg command
+ * @return    command index, STCC4_STATS_COMMAND_OTHER when the command is unknown
+ * @note      none
+ */
+static uint8_t a_stcc4_command_index(uint16_t reg)
+{
+    uint8_t i;
+    
+    for (i = 0; i < STCC4_STATS_COMMAND_OTHER; i++)        /* find the command */
+    {
+        if (gs_command[i].opcode == reg)                   /* check the opcode */
+        {
+            break;                                         /* found */
+        }
+    }
+    
+    return i;                                              /* return the index */
+}
+
+/**
+ * @brief      send a command and read the response
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  index command index
+ * @param[in]  flags command flags
+ * @param[in]  time_ms execution time in ms
+ * @param[in]  *wbuf pointer to an encoded command buffer
+ * @param[in]  wlen encoded command length
+ * @param[out] *rbuf pointer to a response buffer
+ * @param[in]  rlen response length, 0 means no response
+ * @return     status code
+ *             - 0 success
+ *             - 1 transfer failed
+ * @note       commands with a short delay use the linked iic_write_read_cmd in one transfer,
+ *             commands with a long delay poll the response when the ready polling is enabled
+ */
+static uint8_t a_stcc4_transfer(stcc4_handle_t *handle, uint8_t index, uint8_t flags, uint32_t time_ms,
+                                uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    uint8_t addr;
+    
+    a_stcc4_stats_begin(handle, index);                                                       /* begin the command stats */
+    if ((rlen != 0) && (time_ms <= STCC4_WRITE_READ_MAX_DELAY_MS) &&
+        ((STCC4_OPS(handle)->iic_write_read_cmd != NULL) || 
+         (STCC4_OPS(handle)->iic_write_read_cmd_ctx != NULL)))                                /* check the combined transfer */
+    {
+        return (a_stcc4_bus_write_read(handle, wbuf, wlen, rbuf, rlen) != 0) ? 1 : 0;        /* write and read */
+    }
+    addr = ((flags & STCC4_COMMAND_FLAG_GENERAL_CALL) != 0) ? 0x00 : handle->iic_addr;       /* set the address */
+    if ((a_stcc4_bus_write(handle, addr, wbuf, wlen) != 0) && 
+        ((flags & STCC4_COMMAND_FLAG_NACK) == 0))                                             /* write command */
+    {
+        return 1;                                                                             /* return error */
+    }
+    if ((rlen != 0) && (handle->poll_enable != 0) && 
+        (time_ms > STCC4_WRITE_READ_MAX_DELAY_MS))                                            /* check the ready polling */
+    {
+        return a_stcc4_poll_read(handle, index, 0, rbuf, rlen, time_ms);                     /* poll the response */
+    }
+    if (time_ms != 0)                                                                         /* check the time */
+    {
+        a_stcc4_delay_ms(handle, time_ms);                                                    /* delay ms */
+    }
+    if (rlen == 0)                                                                            /* check the response */
+    {
+        return 0;                                                                             /* success return 0 */
+    }
+    
+    return (a_stcc4_bus_read(handle, rbuf, rlen) != 0) ? 1 : 0;                              /* read the response */
+}
+
+#if (STCC4_CRC8_BACKEND == STCC4_CRC8_BACKEND_TABLE_256)
+/**
+ * @brief crc8 byte table definition
+ */
+static const uint8_t gs_crc8_table[256] =
+{
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E,
+    0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D,
+    0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8,
+    0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F, 0xB8, 0x89, 0xDA, 0xEB,
+    0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA, 0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13,
+    0x7E, 0x4F, 0x1C, 0x2D, 0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51, 0xC6, 0xF7, 0xA4, 0x95,
+    0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F, 0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6,
+    0x7A, 0x4B, 0x18, 0x29, 0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3, 0x44, 0x75, 0x26, 0x17,
+    0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B, 0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2,
+    0xBF, 0x8E, 0xDD, 0xEC, 0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD, 0x3A, 0x0B, 0x58, 0x69,
+    0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93, 0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A,
+    0xC1, 0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF,
+    0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D, 0xAC
+};
+#elif (STCC4_CRC8_BACKEND == STCC4_CRC8_BACKEND_TABLE_16)
+/**
+ * @brief crc8 nibble table definition
+ */
+static const uint8_t gs_crc8_table[16] =
+{
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97,
+    0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E
+};
+#elif (STCC4_CRC8_BACKEND != STCC4_CRC8_BACKEND_BITWISE)
+    #error "stcc4: unknown crc8 backend."
+#endif
+
+/**
+ * @brief     generate the crc
+ * @param[in] *data pointer to a data buffer
+ * @param[in] count data length
+ * @return    crc
+ * @note      none
+ */
+static uint8_t a_stcc4_generate_crc(uint8_t* data, uint16_t count)
+{
+    uint16_t current_byte;
+    uint8_t crc = STCC4_CRC8_INIT;
+#if (STCC4_CRC8_BACKEND == STCC4_CRC8_BACKEND_TABLE_256)
+    
+    for (current_byte = 0; current_byte < count; ++current_byte)        /* calculate crc */
+    {
+        crc = gs_crc8_table[crc ^ data[current_byte]];                  /* look up the whole byte */
+    }
+#elif (STCC4_CRC8_BACKEND == STCC4_CRC8_BACKEND_TABLE_16)
+    
+    for (current_byte = 0; current_byte < count; ++current_byte)        /* calculate crc */
+    {
+        crc ^= (data[current_byte]);                                    /* xor data */
+        crc = (uint8_t)(crc << 4) ^ gs_crc8_table[crc >> 4];            /* look up the high nibble */
+        crc = (uint8_t)(crc << 4) ^ gs_crc8_table[crc >> 4];            /* look up the low nibble */
+    }
+#else
+    uint8_t crc_bit;
+
+    for (current_byte = 0; current_byte < count; ++current_byte)        /* calculate crc */
+    {
+        crc ^= (data[current_byte]);                                    /* xor data */
+        for (crc_bit = 8; crc_bit > 0; --crc_bit)                       /* 8 bit */
+        {
+            if ((crc & 0x80) != 0)                                      /* if 7th bit is 1 */
+            {
+                crc = (crc << 1) ^ STCC4_CRC8_POLYNOMIAL;               /* xor */
+            }
+            else
+            {
+                crc = crc << 1;                                         /* left shift 1 */
+            }
+        }
+    }
+#endif
+    
+    return crc;                                                         /* return crc */
+}
+
+/**
+ * @brief     check all crc words of a frame in one pass
+ * @param[in] *buf pointer to a frame buffer
+ * @param[in] words number of 2 + 1 bytes words in the frame
+ * @return    error mask, bit n is set when word n has a crc error
+ * @note      words must not be greater than 16
+ */
+static uint16_t a_stcc4_check_frame(uint8_t *buf, uint8_t words)
+{
+    uint8_t i;
+    uint16_t mask = 0;
+    
+    for (i = 0; i < words; i++)                                                            /* check all words */
+    {
+        mask |= (uint16_t)((uint16_t)(a_stcc4_generate_crc(buf, 2) != buf[2]) << i);      /* set the error bit */
+        buf += 3;                                                                          /* next word */
+    }
+    
+    return mask;                                                                           /* return the mask */
+}
+
+/**
+ * @brief      execute a command of the descriptor table
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  index command index
+ * @param[in]  *param pointer to a payload words buffer
+ * @param[out] *response pointer to a response buffer of 3 bytes per word
+ * @param[in]  wait wait the execution time after a command without response
+ * @return     status code
+ *             - 0 success
+ *             - 1 command failed
+ *             - 4 crc check failed
+ * @note       the handle is checked by the caller
+ */
+static uint8_t a_stcc4_execute(stcc4_handle_t *handle, uint8_t index, const uint16_t *param,
+                               uint8_t *response, uint8_t wait)
+{
+    const stcc4_command_t *command = &gs_command[index];
+    uint8_t buf[2 + STCC4_COMMAND_MAX_PARAM * 3];
+    uint8_t len;
+    uint8_t i;
+    
+    len = 0;                                                                            /* init 0 */
+    if ((command->flags & STCC4_COMMAND_FLAG_SHORT) == 0)                               /* check the short opcode */
+    {
+        buf[len++] = (uint8_t)((command->opcode >> 8) & 0xFF);                          /* set opcode MSB */
+    }
+    buf[len++] = (uint8_t)(command->opcode & 0xFF);                                     /* set opcode LSB */
+    for (i = 0; i < command->param; i++)                                                /* encode the payload */
+    {
+        buf[len + 0] = (uint8_t)((param[i] >> 8) & 0xFF);                               /* set word msb */
+        buf[len + 1] = (uint8_t)((param[i] >> 0) & 0xFF);                               /* set word lsb */
+        buf[len + 2] = a_stcc4_generate_crc(buf + len, 2);                              /* set word crc */
+        len += 3;                                                                       /* next word */
+    }
+    if (a_stcc4_transfer(handle, index, command->flags, 
+                         ((wait != 0) || (command->response != 0)) ? command->time_ms : 0, 
+                         buf, len, response, (uint16_t)(command->response * 3)) != 0)   /* transfer */
+    {
+        STCC4_OPS(handle)->debug_print("stcc4: %s failed.\n", command->name);           /* command failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    if ((command->flags & STCC4_COMMAND_FLAG_IDLE) != 0)                                /* check the idle flag */
+    {
+        handle->measure_state = STCC4_MEASURE_STATE_IDLE;                               /* set idle state */
+    }
+    if (((command->flags & STCC4_COMMAND_FLAG_CRC) != 0) && 
+        (a_stcc4_check_frame(response, command->response) != 0))                        /* check all crc */
+    {
+        a_stcc4_stats_crc_error(handle);                                                /* count the crc error */
+        STCC4_OPS(handle)->debug_print("stcc4: crc check failed.\n");                   /* crc check failed */
+        
+        return 4;                                                                       /* return error */
+    }
+    
     return 0;                                                                           /* success return 0 */
 }
 
 /**
- * @brief     enter sleep mode
+ * @brief     set address pin
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] address address pin
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t stcc4_set_address_pin(stcc4_handle_t *handle, stcc4_address_t address)
+{
+    if (handle == NULL)                         /* check handle */
+    {
+        return 2;                               /* return error */
+    }
+    
+    handle->iic_addr = (uint8_t)address;        /* set address */
+    
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      get address pin
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *address pointer to an address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t stcc4_get_address_pin(stcc4_handle_t *handle, stcc4_address_t *address)
+{
+    if (handle == NULL)                                    /* check handle */
+    {
+        return 2;                                          /* return error */
+    }
+    
+    *address = (stcc4_address_t)(handle->iic_addr);        /* get address */
+    
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     start continuous measurement
  * @param[in] *handle pointer to an stcc4 handle structure
  * @return    status code
  *            - 0 success
- *            - 1 enter sleep mode failed
+ *            - 1 start continuous measurement failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      sets the continuous measure state, the begin functions refuse to start while it runs
  */
-uint8_t stcc4_enter_sleep_mode(stcc4_handle_t *handle)
+uint8_t stcc4_start_continuous_measurement(stcc4_handle_t *handle)
 {
     uint8_t res;
     
-    if (handle == NULL)                                                              /* check handle */
+    if (handle == NULL)                                                                                     /* check handle */
     {
-        return 2;                                                                    /* return error */
+        return 2;                                                                                           /* return error */
     }
-    if (handle->inited != 1)                                                         /* check handle initialization */
+    if (handle->inited != 1)                                                                                /* check handle initialization */
     {
-        return 3;                                                                    /* return error */
+        return 3;                                                                                           /* return error */
     }
 
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_ENTER_SLEEP_MODE, NULL, 0);        /* write config */
-    if (res != 0)                                                                    /* check result */
+    handle->frame_valid = 0;                                                                                /* drop the last polled frame */
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_START_CONTINUOUS_MEASUREMENT, NULL, NULL, 1);         /* execute the command */
+    if (res != 0)                                                                                           /* check result */
     {
-        handle->debug_print("stcc4: enter sleep mode failed.\n");                    /* enter sleep mode failed */
-       
-        return 1;                                                                    /* return error */
+        return 1;                                                                                           /* return error */
     }
-    handle->delay_ms(1);                                                             /* wait 1ms */
+    handle->measure_state = STCC4_MEASURE_STATE_CONTINUOUS;                                                 /* set continuous state */
     
-    return 0;                                                                        /* success return 0 */
+    return 0;                                                                                               /* success return 0 */
 }
 
 /**
- * @brief     exit sleep mode
+ * @brief     stop continuous measurement
  * @param[in] *handle pointer to an stcc4 handle structure
  * @return    status code
  *            - 0 success
+ *            - 1 stop continuous measurement failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t stcc4_exit_sleep_mode(stcc4_handle_t *handle)
+uint8_t stcc4_stop_continuous_measurement(stcc4_handle_t *handle)
 {
-    uint8_t reg;
-    
-    if (handle == NULL)                                            /* check handle */
+    if (handle == NULL)                                                                                    /* check handle */
     {
-        return 2;                                                  /* return error */
+        return 2;                                                                                          /* return error */
     }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle->inited != 1)                                                                               /* check handle initialization */
     {
-        return 3;                                                  /* return error */
+        return 3;                                                                                          /* return error */
     }
-
-    reg = STCC4_COMMAND_EXIT_SLEEP_MODE;                           /* set exit sleep command */
-    (void)handle->iic_write_cmd(handle->iic_addr, &reg, 1);        /* exit sleep mode */
-    handle->delay_ms(5);                                           /* wait 5ms */
     
-    return 0;                                                      /* success return 0 */
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_STOP_CONTINUOUS_MEASUREMENT, NULL, NULL, 1);        /* execute the command */
 }
 
 /**
- * @brief     perform conditioning
- * @param[in] *handle pointer to an stcc4 handle structure
+ * @brief     set rht compensation
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] temperature_raw raw temperature
+ * @param[in] humidity_raw raw humidity
  * @return    status code
  *            - 0 success
- *            - 1 perform conditioning failed
+ *            - 1 set rht compensation failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t stcc4_perform_conditioning(stcc4_handle_t *handle)
+uint8_t stcc4_set_rht_compensation(stcc4_handle_t *handle, uint16_t temperature_raw, uint16_t humidity_raw)
 {
-    uint8_t res;
+    uint16_t param[2];
     
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                                              /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                                                    /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                                                                         /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                                                                    /* return error */
     }
 
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_PERFORM_CONDITIONING, NULL, 0);        /* write config */
-    if (res != 0)                                                                        /* check result */
+    param[0] = temperature_raw;                                                                      /* set temperature */
+    param[1] = humidity_raw;                                                                         /* set humidity */
+    
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_SET_RHT_COMPENSATION, param, NULL, 1);        /* execute the command */
+}
+
+/**
+ * @brief     set pressure compensation
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] pressure_raw raw pressure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set pressure compensation failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t stcc4_set_pressure_compensation(stcc4_handle_t *handle, uint16_t pressure_raw)
+{
+    if (handle == NULL)                                                                                           /* check handle */
     {
-        handle->debug_print("stcc4: perform conditioning failed.\n");                    /* perform conditioning failed */
-       
-        return 1;                                                                        /* return error */
+        return 2;                                                                                                 /* return error */
     }
-    handle->delay_ms(22000);                                                             /* wait 22000ms */
-    
-    return 0;                                                                            /* success return 0 */
+    if (handle->inited != 1)                                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                                 /* return error */
+    }
+
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_SET_PRESSURE_COMPENSATION, &pressure_raw, NULL, 1);        /* execute the command */
 }
 
 /**
- * @brief     perform soft reset
+ * @brief     measure single shot
  * @param[in] *handle pointer to an stcc4 handle structure
  * @return    status code
  *            - 0 success
+ *            - 1 measure single shot failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t stcc4_perform_soft_reset(stcc4_handle_t *handle)
+uint8_t stcc4_measure_single_shot(stcc4_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    handle->frame_valid = 0;                                                                /* drop the last polled frame */
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_MEASURE_SINGLE_SHOT, 
+                          NULL, NULL, (handle->poll_enable == 0) ? 1 : 0);                  /* execute the command */
+    if ((res == 0) && (handle->poll_enable != 0))                                           /* check the ready polling */
+    {
+        if (a_stcc4_poll_read(handle, STCC4_STATS_COMMAND_READ_MEASUREMENT, 1, handle->frame, 
+                              STCC4_RAW_FRAME_SIZE, STCC4_SINGLE_SHOT_TIME_MS) != 0)        /* poll the frame */
+        {
+            STCC4_OPS(handle)->debug_print("stcc4: measure single shot failed.\n");         /* measure single shot failed */
+            
+            return 1;                                                                       /* return error */
+        }
+        handle->frame_valid = 1;                                                            /* keep the frame for the next read */
+    }
+    
+    return res;                                                                             /* return the result */
+}
+
+/**
+ * @brief     enter sleep mode
+ * @param[in] *handle pointer to an stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 enter sleep mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t stcc4_enter_sleep_mode(stcc4_handle_t *handle)
+{
+    if (handle == NULL)                                                                         /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+        return 3;                                                                               /* return error */
+    }
+    
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_ENTER_SLEEP_MODE, NULL, NULL, 1);        /* execute the command */
+}
+
+/**
+ * @brief     exit sleep mode
+ * @param[in] *handle pointer to an stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t stcc4_exit_sleep_mode(stcc4_handle_t *handle)
+{
+    if (handle == NULL)                                                                        /* check handle */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                                   /* check handle initialization */
+    {
+        return 3;                                                                              /* return error */
+    }
+    
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_EXIT_SLEEP_MODE, NULL, NULL, 1);        /* execute the command */
+}
+
+/**
+ * @brief     perform conditioning
+ * @param[in] *handle pointer to an stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 perform conditioning failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t stcc4_perform_conditioning(stcc4_handle_t *handle)
+{
+    if (handle == NULL)                                                                             /* check handle */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                   /* return error */
+    }
+    
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_PERFORM_CONDITIONING, NULL, NULL, 1);        /* execute the command */
+}
+
+/**
+ * @brief     perform soft reset
+ * @param[in] *handle pointer to an stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t stcc4_perform_soft_reset(stcc4_handle_t *handle)
+{
+    if (handle == NULL)                                                                           /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_PERFORM_SOFT_RESET, NULL, NULL, 1);        /* execute the command */
+}
+
+/**
+ * @brief     perform factory reset
+ * @param[in] *handle pointer to an stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 perform factory reset failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 not passed
+ * @note      the response word is crc checked, a crc error is a failed factory reset
+ */
+uint8_t stcc4_perform_factory_reset(stcc4_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t buf[3];
+    
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_PERFORM_FACTORY_RESET, NULL, buf, 1);        /* execute the command */
+    if (res != 0)                                                                                  /* check result */
+    {
+        return 1;                                                                                  /* return error */
+    }
+    if ((buf[0] != 0) || (buf[1] != 0))                                                            /* check the result */
+    {
+        STCC4_OPS(handle)->debug_print("stcc4: not passed.\n");                                    /* not passed */
+       
+        return 4;                                                                                  /* return error */
+    }
+    
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      perform self test
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *result pointer to a result buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 perform self test failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc check failed
+ * @note       none
+ */
+uint8_t stcc4_perform_self_test(stcc4_handle_t *handle, uint16_t *result)
+{
+    uint8_t res;
+    uint8_t buf[3];
+    
+    if (handle == NULL)                                                                        /* check handle */
+    {
+        return 2;                                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                                   /* check handle initialization */
+    {
+        return 3;                                                                              /* return error */
+    }
+
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_PERFORM_SELF_TEST, NULL, buf, 1);        /* execute the command */
+    if (res != 0)                                                                              /* check result */
+    {
+        return res;                                                                            /* return error */
+    }
+    *result = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                                      /* set the result */
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     enable testing mode
+ * @param[in] *handle pointer to an stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 enable testing mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t stcc4_enable_testing_mode(stcc4_handle_t *handle)
+{
+    if (handle == NULL)                                                                            /* check handle */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_ENABLE_TESTING_MODE, NULL, NULL, 1);        /* execute the command */
+}
+
+/**
+ * @brief     disable testing mode
+ * @param[in] *handle pointer to an stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 disable testing mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t stcc4_disable_testing_mode(stcc4_handle_t *handle)
+{
+    if (handle == NULL)                                                                             /* check handle */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                   /* return error */
+    }
+    
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_DISABLE_TESTING_MODE, NULL, NULL, 1);        /* execute the command */
+}
+
+/**
+ * @brief      perform forced recalibration
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  target_co2 input target co2
+ * @param[out] *correct_co2 pointer to a correct co2 buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 perform forced recalibration failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc check failed
+ * @note       none
+ */
+uint8_t stcc4_perform_forced_recalibration(stcc4_handle_t *handle, uint16_t target_co2, uint16_t *correct_co2)
+{
+    uint8_t res;
+    uint8_t output[3];
+    
+    if (handle == NULL)                                                                                             /* check handle */
+    {
+        return 2;                                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                                   /* return error */
+    }
+
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_PERFORM_FORCED_RECALIBRATION, &target_co2, output, 1);        /* execute the command */
+    if (res != 0)                                                                                                   /* check result */
+    {
+        return res;                                                                                                 /* return error */
+    }
+    *correct_co2 = (uint16_t)((uint16_t)output[0] << 8) | output[1];                                                /* set the correct co2 */
+    
+    return 0;                                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get product id
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *product_id pointer to a product id buffer
+ * @param[out] *unique_serial_number pointer to a unique serial number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get product id failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc check failed
+ * @note       none
+ */
+uint8_t stcc4_get_product_id(stcc4_handle_t *handle, uint32_t *product_id, uint8_t unique_serial_number[8])
+{
+    uint8_t res;
+    uint8_t buf[18];
+    
+    if (handle == NULL)                                                                     /* check handle */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                /* check handle initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_GET_PRODUCT_ID, NULL, buf, 1);        /* execute the command */
+    if (res != 0)                                                                           /* check result */
+    {
+        return res;                                                                         /* return error */
+    }
+    *product_id = ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) |
+                  ((uint32_t)buf[3] << 8) | ((uint32_t)buf[4] << 0);                        /* set product id */
+    unique_serial_number[0] = buf[6];                                                       /* set unique serial number index 0 */
+    unique_serial_number[1] = buf[7];                                                       /* set unique serial number index 1 */
+    unique_serial_number[2] = buf[9];                                                       /* set unique serial number index 2 */
+    unique_serial_number[3] = buf[10];                                                      /* set unique serial number index 3 */
+    unique_serial_number[4] = buf[12];                                                      /* set unique serial number index 4 */
+    unique_serial_number[5] = buf[13];                                                      /* set unique serial number index 5 */
+    unique_serial_number[6] = buf[15];                                                      /* set unique serial number index 6 */
+    unique_serial_number[7] = buf[16];                                                      /* set unique serial number index 7 */
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     divide by 65535 without a hardware divider
+ * @param[in] x dividend
+ * @return    x / 65535
+ * @note      exact for all x <= 59465 * 65535 + 32767, which covers every caller
+ */
+static inline uint32_t a_stcc4_div_65535(uint32_t x)
+{
+    return (x + (x >> 16) + 1) >> 16;        /* shift and add division */
+}
+
+/**
+ * @brief     convert the temperature raw data to milli degrees
+ * @param[in] raw temperature raw data
+ * @return    temperature in 0.001 degrees
+ * @note      175000 * raw / 65535 is split into 2 * raw + 43930 * raw / 65535 to stay in 32 bits,
+ *            the result is rounded to the nearest milli degree
+ */
+static inline int32_t a_stcc4_temperature_to_milli(uint16_t raw)
+{
+    return (int32_t)(2UL * raw + a_stcc4_div_65535(43930UL * raw + 32767UL)) - 45000;        /* integer convert */
+}
+
+/**
+ * @brief     convert the humidity raw data to milli percentage
+ * @param[in] raw humidity raw data
+ * @return    humidity in 0.001 %
+ * @note      125000 * raw / 65535 is split into raw + 59465 * raw / 65535 to stay in 32 bits,
+ *            the result is rounded to the nearest milli percentage
+ */
+static inline int32_t a_stcc4_humidity_to_milli(uint16_t raw)
+{
+    return (int32_t)(raw + a_stcc4_div_65535(59465UL * raw + 32767UL)) - 6000;               /* integer convert */
+}
+
+/**
+ * @brief      read the measurement frame
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *buf pointer to a 12 bytes frame buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a frame already read by the polled single shot is returned first
+ */
+static uint8_t a_stcc4_read_measurement_frame(stcc4_handle_t *handle, uint8_t *buf)
+{
+    if (handle->frame_valid != 0)                                                              /* check the polled frame */
+    {
+        memcpy(buf, handle->frame, STCC4_RAW_FRAME_SIZE);                                      /* copy the frame */
+        handle->frame_valid = 0;                                                               /* the frame is read */
+        
+        return 0;                                                                              /* success return 0 */
+    }
+    
+    return a_stcc4_execute(handle, STCC4_STATS_COMMAND_READ_MEASUREMENT, NULL, buf, 1);        /* read data */
+}
+
+/**
+ * @brief      read the measurement frame and check all crc words
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *buf pointer to a 12 bytes frame buffer
+ * @param[out] *mask pointer to a crc error mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_stcc4_read_frame(stcc4_handle_t *handle, uint8_t *buf, uint8_t *mask)
+{
+    uint8_t res;
+    
+    res = a_stcc4_read_measurement_frame(handle, buf);                   /* read data */
+    if (res != 0)                                                        /* check result */
+    {
+        return 1;                                                        /* return error */
+    }
+    *mask = (uint8_t)a_stcc4_check_frame(buf, 4);                        /* check all crc */
+    if ((*mask) != 0)                                                    /* check the mask */
+    {
+        a_stcc4_stats_crc_error(handle);                                 /* count the crc error */
+        STCC4_OPS(handle)->debug_print("stcc4: crc is error.\n");        /* crc is error */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      decode the words of a measurement frame
+ * @param[in]  *buf pointer to a 12 bytes frame buffer
+ * @param[in]  mask crc error mask, the marked words are skipped
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @note       none
+ */
+static void a_stcc4_decode_frame(uint8_t *buf, uint8_t mask, int16_t *co2_raw, int16_t *co2_ppm,
+                                 uint16_t *temperature_raw, float *temperature_s,
+                                 uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status)
+{
+    if ((mask & STCC4_CRC_ERROR_CO2) == 0)                                                /* co2 word is good */
+    {
+        *co2_raw = (int16_t)(((uint16_t)buf[0]) << 8) | buf[1];                           /* set co2 raw */
+        *co2_ppm = *co2_raw;                                                              /* set co2 ppm */
+    }
+    if ((mask & STCC4_CRC_ERROR_TEMPERATURE) == 0)                                        /* temperature word is good */
+    {
+        *temperature_raw = (uint16_t)(((uint16_t)buf[3]) << 8) | buf[4];                  /* set temperature raw */
+        *temperature_s = -45.0f + 175.0f * (float)(*temperature_raw) / 65535.0f;          /* set temperature */
+    }
+    if ((mask & STCC4_CRC_ERROR_HUMIDITY) == 0)                                           /* humidity word is good */
+    {
+        *humidity_raw = (uint16_t)(((uint16_t)buf[6]) << 8) | buf[7];                     /* set humidity raw */
+        *humidity_s = 125.0f * (float)(*humidity_raw) / 65535.0f - 6.0f;                  /* set humidity */
+    }
+    if ((mask & STCC4_CRC_ERROR_SENSOR_STATUS) == 0)                                      /* status word is good */
+    {
+        *sensor_status = (uint16_t)(((uint16_t)buf[9]) << 8) | buf[10];                   /* set sensor status */
+    }
+}
+
+/**
+ * @brief      read and decode the measurement frame
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @param[out] *crc_error_mask pointer to a crc error mask buffer, NULL rejects the whole frame
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 4 crc is error
+ * @note       with a crc error mask buffer the words with a good crc are still decoded
+ */
+static uint8_t a_stcc4_read_measurement(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
+                                        uint16_t *temperature_raw, float *temperature_s,
+                                        uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status,
+                                        uint8_t *crc_error_mask)
+{
+    uint8_t res;
+    uint8_t mask;
+    uint8_t buf[STCC4_RAW_FRAME_SIZE];
+    
+    res = a_stcc4_read_frame(handle, buf, &mask);                                         /* read frame */
+    if (res != 0)                                                                         /* check result */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if ((mask != 0) && (crc_error_mask == NULL))                                          /* reject the frame */
+    {
+        return 4;                                                                         /* return error */
+    }
+    if (crc_error_mask != NULL)                                                           /* check the mask buffer */
+    {
+        *crc_error_mask = mask;                                                           /* set the mask */
+    }
+    a_stcc4_decode_frame(buf, mask, co2_raw, co2_ppm,
+                         temperature_raw, temperature_s,
+                         humidity_raw, humidity_s, sensor_status);                        /* decode the frame */
+    
+    return (mask != 0) ? 4 : 0;                                                           /* return the result */
+}
+
+/**
+ * @brief      read data
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc is error
+ * @note       none
+ */
+uint8_t stcc4_read(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
+                   uint16_t *temperature_raw, float *temperature_s,
+                   uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status)
+{
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    return a_stcc4_read_measurement(handle, co2_raw, co2_ppm,
+                                    temperature_raw, temperature_s,
+                                    humidity_raw, humidity_s, sensor_status, NULL);       /* read measurement */
+}
+
+/**
+ * @brief      read data and keep the words with a good crc
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @param[out] *crc_error_mask pointer to a crc error mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc is error
+ * @note       when 4 is returned only the buffers of the words not set in the crc error mask are updated
+ */
+uint8_t stcc4_read_with_crc_mask(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
+                                 uint16_t *temperature_raw, float *temperature_s,
+                                 uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status,
+                                 uint8_t *crc_error_mask)
+{
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    return a_stcc4_read_measurement(handle, co2_raw, co2_ppm,
+                                    temperature_raw, temperature_s,
+                                    humidity_raw, humidity_s, sensor_status, 
+                                    crc_error_mask);                                      /* read measurement */
+}
+
+/**
+ * @brief      read data with integer math only
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_mdeg pointer to a temperature buffer in 0.001 degrees
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_mpercentage pointer to a humidity buffer in 0.001 %
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc is error
+ * @note       no float operation is used, the results are rounded to the nearest milli unit
+ */
+uint8_t stcc4_read_fixed(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
+                         uint16_t *temperature_raw, int32_t *temperature_mdeg,
+                         uint16_t *humidity_raw, int32_t *humidity_mpercentage, uint16_t *sensor_status)
+{
+    uint8_t res;
+    uint8_t mask;
+    uint8_t buf[STCC4_RAW_FRAME_SIZE];
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    res = a_stcc4_read_frame(handle, buf, &mask);                                         /* read frame */
+    if (res != 0)                                                                         /* check result */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (mask != 0)                                                                        /* check the mask */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    *co2_raw = (int16_t)(((uint16_t)buf[0]) << 8) | buf[1];                               /* set co2 raw */
+    *co2_ppm = *co2_raw;                                                                  /* set co2 ppm */
+    *temperature_raw = (uint16_t)(((uint16_t)buf[3]) << 8) | buf[4];                      /* set temperature raw */
+    *temperature_mdeg = a_stcc4_temperature_to_milli(*temperature_raw);                   /* set temperature */
+    *humidity_raw = (uint16_t)(((uint16_t)buf[6]) << 8) | buf[7];                         /* set humidity raw */
+    *humidity_mpercentage = a_stcc4_humidity_to_milli(*humidity_raw);                     /* set humidity */
+    *sensor_status = (uint16_t)(((uint16_t)buf[9]) << 8) | buf[10];                       /* set sensor status */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      read the raw measurement frame
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *frame pointer to a STCC4_RAW_FRAME_SIZE bytes frame buffer
+ * @param[in]  check_crc check the crc now or defer it to stcc4_decode_raw_frame
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc is error
+ * @note       the wire frame is read straight into the frame buffer
+ */
+uint8_t stcc4_read_raw_frame(stcc4_handle_t *handle, uint8_t *frame, stcc4_bool_t check_crc)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    res = a_stcc4_read_measurement_frame(handle, frame);                               /* read data */
+    if (res != 0)                                                                      /* check result */
+    {
+        return 1;                                                                      /* return error */
+    }
+    if ((check_crc == STCC4_BOOL_TRUE) && (a_stcc4_check_frame(frame, 4) != 0))        /* check all crc */
+    {
+        a_stcc4_stats_crc_error(handle);                                               /* count the crc error */
+        STCC4_OPS(handle)->debug_print("stcc4: crc is error.\n");                      /* crc is error */
+        
+        return 4;                                                                      /* return error */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      decode a raw measurement frame
+ * @param[in]  *frame pointer to a STCC4_RAW_FRAME_SIZE bytes frame buffer
+ * @param[in]  check_crc check the crc before decoding
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 frame is NULL
+ *             - 4 crc is error
+ * @note       the frame is left untouched, so it can be decoded from a ring buffer in place
+ */
+uint8_t stcc4_decode_raw_frame(uint8_t *frame, stcc4_bool_t check_crc, int16_t *co2_raw, int16_t *co2_ppm,
+                               uint16_t *temperature_raw, float *temperature_s,
+                               uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status)
+{
+    if (frame == NULL)                                                                    /* check frame */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if ((check_crc == STCC4_BOOL_TRUE) && (a_stcc4_check_frame(frame, 4) != 0))           /* check all crc */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    a_stcc4_decode_frame(frame, 0, co2_raw, co2_ppm,
+                         temperature_raw, temperature_s,
+                         humidity_raw, humidity_s, sensor_status);                        /* decode the frame */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      begin a single shot measurement without waiting
+ * @param[in]  *handle pointer to an stcc4 handle structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *ready_ms pointer to a ready deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 measure single shot failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 measurement is running
+ * @note       the timestamp may be any free running ms counter and is allowed to wrap around,
+ *             call stcc4_measure_poll once the counter has reached the ready deadline
+ */
+uint8_t stcc4_measure_single_shot_begin(stcc4_handle_t *handle, uint32_t timestamp_ms, uint32_t *ready_ms)
 {
-    uint8_t reg;
+    uint8_t res;
     
-    if (handle == NULL)                                /* check handle */
+    if (handle == NULL)                                                                           /* check handle */
     {
-        return 2;                                      /* return error */
+        return 2;                                                                                 /* return error */
     }
-    if (handle->inited != 1)                           /* check handle initialization */
+    if (handle->inited != 1)                                                                      /* check handle initialization */
     {
-        return 3;                                      /* return error */
+        return 3;                                                                                 /* return error */
     }
-
-    reg = STCC4_COMMAND_PERFORM_SOFT_RESET;            /* perform soft reset command */
-    (void)handle->iic_write_cmd(0x00, &reg, 1);        /* perform soft reset */
-    handle->delay_ms(10);                              /* wait 10ms */
+    if (handle->measure_state != STCC4_MEASURE_STATE_IDLE)                                        /* check measure state */
+    {
+        STCC4_OPS(handle)->debug_print("stcc4: measurement is running.\n");                       /* measurement is running */
+       
+        return 4;                                                                                 /* return error */
+    }
+    
+    handle->frame_valid = 0;                                                                      /* drop the last polled frame */
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_MEASURE_SINGLE_SHOT, NULL, NULL, 0);        /* execute the command */
+    if (res != 0)                                                                                 /* check result */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    handle->measure_deadline = timestamp_ms + STCC4_SINGLE_SHOT_TIME_MS;                          /* set the deadline */
+    handle->measure_state = STCC4_MEASURE_STATE_SINGLE_SHOT;                                      /* set single shot state */
+    *ready_ms = handle->measure_deadline;                                                         /* set the ready time */
     
-    return 0;                                          /* success return 0 */
+    return 0;                                                                                     /* success return 0 */
 }
 
 /**
- * @brief     perform factory reset
- * @param[in] *handle pointer to an stcc4 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 perform factory reset failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 not passed
- * @note      none
+ * @brief      begin the continuous measurement without waiting
+ * @param[in]  *handle pointer to an stcc4 handle structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *ready_ms pointer to a ready deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start continuous measurement failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 measurement is running
+ * @note       the timestamp may be any free running ms counter and is allowed to wrap around
  */
-uint8_t stcc4_perform_factory_reset(stcc4_handle_t *handle)
+uint8_t stcc4_start_continuous_measurement_begin(stcc4_handle_t *handle, uint32_t timestamp_ms, uint32_t *ready_ms)
 {
     uint8_t res;
-    uint8_t buf[2];
-    uint16_t result;
     
-    if (handle == NULL)                                                                     /* check handle */
+    if (handle == NULL)                                                                                    /* check handle */
     {
-        return 2;                                                                           /* return error */
+        return 2;                                                                                          /* return error */
     }
-    if (handle->inited != 1)                                                                /* check handle initialization */
+    if (handle->inited != 1)                                                                               /* check handle initialization */
     {
-        return 3;                                                                           /* return error */
+        return 3;                                                                                          /* return error */
     }
-
-    res = a_stcc4_iic_read(handle, STCC4_COMMAND_PERFORM_FACTORY_RESET, buf, 2, 90);        /* write config */
-    if (res != 0)                                                                           /* check result */
+    if (handle->measure_state != STCC4_MEASURE_STATE_IDLE)                                                 /* check measure state */
     {
-        handle->debug_print("stcc4: perform factory reset failed.\n");                      /* perform factory reset failed */
+        STCC4_OPS(handle)->debug_print("stcc4: measurement is running.\n");                                /* measurement is running */
        
-        return 1;                                                                           /* return error */
+        return 4;                                                                                          /* return error */
     }
-    result = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                                    /* set the result */
-    if (result != 0)                                                                        /* check the result */
+    
+    handle->frame_valid = 0;                                                                               /* drop the last polled frame */
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_START_CONTINUOUS_MEASUREMENT, NULL, NULL, 0);        /* execute the command */
+    if (res != 0)                                                                                          /* check result */
     {
-        handle->debug_print("stcc4: not passed.\n");                                        /* not passed */
-       
-        return 4;                                                                           /* return error */
+        return 1;                                                                                          /* return error */
     }
+    handle->measure_deadline = timestamp_ms + STCC4_CONTINUOUS_START_TIME_MS;                              /* set the deadline */
+    handle->measure_state = STCC4_MEASURE_STATE_CONTINUOUS;                                                /* set continuous state */
+    *ready_ms = handle->measure_deadline;                                                                  /* set the ready time */
     
-    return 0;                                                                               /* success return 0 */
+    return 0;                                                                                              /* success return 0 */
 }
 
 /**
- * @brief      perform self test
+ * @brief      poll the running measurement
  * @param[in]  *handle pointer to a stcc4 handle structure
- * @param[out] *result pointer to a result buffer
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *ready_ms pointer to a next ready deadline buffer
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
  * @return     status code
  *             - 0 success
- *             - 1 perform self test failed
+ *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- *             - 4 crc check failed
- * @note       none
+ *             - 4 crc is error
+ *             - 5 no measurement is running
+ *             - 6 data is not ready
+ * @note       the data buffers are only written when 0 is returned,
+ *             a single shot returns the handle to the idle state after the read attempt,
+ *             a continuous measurement moves the deadline to the next sample
  */
-uint8_t stcc4_perform_self_test(stcc4_handle_t *handle, uint16_t *result)
+uint8_t stcc4_measure_poll(stcc4_handle_t *handle, uint32_t timestamp_ms, uint32_t *ready_ms,
+                           int16_t *co2_raw, int16_t *co2_ppm,
+                           uint16_t *temperature_raw, float *temperature_s,
+                           uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status)
 {
     uint8_t res;
-    uint8_t buf[3];
     
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                                   /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                                                         /* return error */
     }
-
-    res = a_stcc4_iic_read(handle, STCC4_COMMAND_PERFORM_SELF_TEST, buf, 3, 360);        /* write config */
-    if (res != 0)                                                                        /* check result */
+    if (handle->measure_state == STCC4_MEASURE_STATE_IDLE)                                /* check measure state */
     {
-        handle->debug_print("stcc4: perform self test failed.\n");                       /* perform self test failed */
+        STCC4_OPS(handle)->debug_print("stcc4: no measurement is running.\n");            /* no measurement is running */
        
-        return 1;                                                                        /* return error */
+        return 5;                                                                         /* return error */
     }
-    if (a_stcc4_generate_crc(buf, 2) != buf[2])                                          /* check crc */
+    *ready_ms = handle->measure_deadline;                                                 /* set the ready time */
+    if ((int32_t)(timestamp_ms - handle->measure_deadline) < 0)                           /* check the deadline */
     {
-        handle->debug_print("stcc4: crc check failed.\n");                               /* crc check failed */
-       
-        return 4;                                                                        /* return error */
+        return 6;                                                                         /* not ready */
+    }
+    
+    res = a_stcc4_read_measurement(handle, co2_raw, co2_ppm,
+                                   temperature_raw, temperature_s,
+                                   humidity_raw, humidity_s, sensor_status, NULL);        /* read measurement */
+    if (handle->measure_state == STCC4_MEASURE_STATE_SINGLE_SHOT)                         /* single shot */
+    {
+        handle->measure_state = STCC4_MEASURE_STATE_IDLE;                                 /* conversion finished */
+    }
+    else                                                                                  /* continuous */
+    {
+        handle->measure_deadline += STCC4_CONTINUOUS_PERIOD_MS;                           /* next sample */
+        if ((int32_t)(timestamp_ms - handle->measure_deadline) >= 0)                      /* check the missed samples */
+        {
+            handle->measure_deadline = timestamp_ms + STCC4_CONTINUOUS_PERIOD_MS;         /* resync to the next sample */
+        }
     }
-    *result = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                                /* set the result */
+    *ready_ms = handle->measure_deadline;                                                 /* set the ready time */
     
-    return 0;                                                                            /* success return 0 */
+    return res;                                                                           /* return the result */
 }
 
 /**
- * @brief     enable testing mode
- * @param[in] *handle pointer to an stcc4 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 enable testing mode failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      get the measure state
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *state pointer to a measure state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t stcc4_enable_testing_mode(stcc4_handle_t *handle)
+uint8_t stcc4_get_measure_state(stcc4_handle_t *handle, stcc4_measure_state_t *state)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                                                 /* check handle */
-    {
-        return 2;                                                                       /* return error */
-    }
-    if (handle->inited != 1)                                                            /* check handle initialization */
+    if (handle == NULL)                                                 /* check handle */
     {
-        return 3;                                                                       /* return error */
+        return 2;                                                       /* return error */
     }
-
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_ENABLE_TESTING_MODE, NULL, 0);        /* write config */
-    if (res != 0)                                                                       /* check result */
+    if (handle->inited != 1)                                            /* check handle initialization */
     {
-        handle->debug_print("stcc4: enable testing mode failed.\n");                    /* enable testing mode failed */
-       
-        return 1;                                                                       /* return error */
+        return 3;                                                       /* return error */
     }
     
-    return 0;                                                                           /* success return 0 */
+    *state = (stcc4_measure_state_t)(handle->measure_state);            /* get the state */
+    
+    return 0;                                                           /* success return 0 */
 }
 
 /**
- * @brief     disable testing mode
- * @param[in] *handle pointer to an stcc4 handle structure
+ * @brief     enable or disable the ready polling
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 disable testing mode failed
  *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @note      when enabled, single shot, self test, forced recalibration and factory reset poll 
+ *            the sensor until it acks instead of waiting the worst case time
  */
-uint8_t stcc4_disable_testing_mode(stcc4_handle_t *handle)
+uint8_t stcc4_set_ready_polling(stcc4_handle_t *handle, stcc4_bool_t enable)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                                                 /* check handle */
-    {
-        return 2;                                                                       /* return error */
-    }
-    if (handle->inited != 1)                                                            /* check handle initialization */
+    if (handle == NULL)                               /* check handle */
     {
-        return 3;                                                                       /* return error */
-    }
-
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_DISABLE_TESTING_MODE, NULL, 0);       /* write config */
-    if (res != 0)                                                                       /* check result */
-    {
-        handle->debug_print("stcc4: disable testing mode failed.\n");                   /* disable testing mode failed */
-       
-        return 1;                                                                       /* return error */
+        return 2;                                     /* return error */
     }
     
-    return 0;                                                                           /* success return 0 */
+    handle->poll_enable = (uint8_t)enable;            /* set the ready polling */
+    
+    return 0;                                         /* success return 0 */
 }
 
 /**
- * @brief      perform forced recalibration
+ * @brief      get the ready polling status
  * @param[in]  *handle pointer to a stcc4 handle structure
- * @param[in]  target_co2 input target co2
- * @param[out] *correct_co2 pointer to a correct co2 buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 perform forced recalibration failed
  *             - 2 handle is NULL
- *             - 3 handle is not initialized
- *             - 4 crc check failed
  * @note       none
  */
-uint8_t stcc4_perform_forced_recalibration(stcc4_handle_t *handle, uint16_t target_co2, uint16_t *correct_co2)
+uint8_t stcc4_get_ready_polling(stcc4_handle_t *handle, stcc4_bool_t *enable)
 {
-    uint8_t res;
-    uint8_t buf[3];
-    uint8_t output[3];
-    
-    if (handle == NULL)                                                                          /* check handle */
-    {
-        return 2;                                                                                /* return error */
-    }
-    if (handle->inited != 1)                                                                     /* check handle initialization */
+    if (handle == NULL)                                      /* check handle */
     {
-        return 3;                                                                                /* return error */
+        return 2;                                            /* return error */
     }
     
-    buf[0] = (target_co2 >> 8) & 0xFF;                                                           /* set target co2 msb */
-    buf[1] = (target_co2 >> 0) & 0xFF;                                                           /* set target co2 lsb */
-    buf[2] = a_stcc4_generate_crc(buf, 2);                                                       /* set target co2 crc */
-    res = a_stcc4_iic_read_with_param(handle, STCC4_COMMAND_PERFORM_FORCED_RECALIBRATION, 
-                                      buf, 3, 90, output, 3);                                    /* write config */
-    if (res != 0)                                                                                /* check result */
+    *enable = (stcc4_bool_t)(handle->poll_enable);           /* get the ready polling */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the ready polling back-off
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] lower_bound_percent first poll after this percent of the worst case time
+ * @param[in] first_step_ms first back-off step in ms, 0 means 1ms
+ * @param[in] max_step_ms max back-off step in ms, 0 means no limit
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 lower bound percent is over 100
+ * @note      the step doubles after every nack and the last poll is at the worst case time
+ */
+uint8_t stcc4_set_ready_polling_backoff(stcc4_handle_t *handle, uint8_t lower_bound_percent,
+                                        uint16_t first_step_ms, uint16_t max_step_ms)
+{
+    if (handle == NULL)                                                      /* check handle */
     {
-        handle->debug_print("stcc4: perform forced recalibration failed.\n");                    /* perform forced recalibration failed */
-       
-        return 1;                                                                                /* return error */
+        return 2;                                                            /* return error */
     }
-    if (a_stcc4_generate_crc(output, 2) != output[2])                                            /* check crc */
+    if (lower_bound_percent > 100)                                           /* check the percent */
     {
-        handle->debug_print("stcc4: crc check failed.\n");                                       /* crc check failed */
-       
-        return 4;                                                                                /* return error */
+        STCC4_OPS(handle)->debug_print("stcc4: lower bound percent is over 100.\n"); /* lower bound percent is over 100 */
+        
+        return 4;                                                            /* return error */
     }
-    *correct_co2 = (uint16_t)((uint16_t)output[0] << 8) | output[1];                             /* set the correct co2 */
     
-    return 0;                                                                                    /* success return 0 */
+    handle->poll_lower_percent = lower_bound_percent;                        /* set the lower bound */
+    handle->poll_first_step_ms = first_step_ms;                              /* set the first step */
+    handle->poll_max_step_ms = max_step_ms;                                  /* set the max step */
+    
+    return 0;                                                                /* success return 0 */
 }
 
 /**
- * @brief      get product id
+ * @brief      get the ready polling back-off
  * @param[in]  *handle pointer to a stcc4 handle structure
- * @param[out] *product_id pointer to a product id buffer
- * @param[out] *unique_serial_number pointer to a unique serial number buffer
+ * @param[out] *lower_bound_percent pointer to a lower bound percent buffer
+ * @param[out] *first_step_ms pointer to a first step buffer
+ * @param[out] *max_step_ms pointer to a max step buffer
  * @return     status code
  *             - 0 success
- *             - 1 get product id failed
  *             - 2 handle is NULL
- *             - 3 handle is not initialized
- *             - 4 crc check failed
  * @note       none
  */
-uint8_t stcc4_get_product_id(stcc4_handle_t *handle, uint32_t *product_id, uint8_t unique_serial_number[8])
+uint8_t stcc4_get_ready_polling_backoff(stcc4_handle_t *handle, uint8_t *lower_bound_percent,
+                                        uint16_t *first_step_ms, uint16_t *max_step_ms)
 {
-    uint8_t res;
-    uint8_t i;
-    uint8_t buf[18];
-    
-    if (handle == NULL)                                                              /* check handle */
-    {
-        return 2;                                                                    /* return error */
-    }
-    if (handle->inited != 1)                                                         /* check handle initialization */
-    {
-        return 3;                                                                    /* return error */
-    }
-
-    res = a_stcc4_iic_read(handle, STCC4_COMMAND_GET_PRODUCT_ID, buf, 18, 1);        /* write config */
-    if (res != 0)                                                                    /* check result */
-    {
-        handle->debug_print("stcc4: get product id failed.\n");                      /* get product id failed */
-       
-        return 1;                                                                    /* return error */
-    }
-    for (i = 0; i < 18; i += 3)                                                      /* check all */
+    if (handle == NULL)                                       /* check handle */
     {
-        if (a_stcc4_generate_crc(buf + i, 2) != buf[i + 2])                          /* check crc */
-        {
-            handle->debug_print("stcc4: crc check failed.\n");                       /* crc check failed */
-           
-            return 4;                                                                /* return error */
-        }
+        return 2;                                             /* return error */
     }
-    *product_id = ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) |
-                  ((uint32_t)buf[3] << 8) | ((uint32_t)buf[4] << 0);                 /* set product id */
-    unique_serial_number[0] = buf[6];                                                /* set unique serial number index 0 */
-    unique_serial_number[1] = buf[7];                                                /* set unique serial number index 1 */
-    unique_serial_number[2] = buf[9];                                                /* set unique serial number index 2 */
-    unique_serial_number[3] = buf[10];                                               /* set unique serial number index 3 */
-    unique_serial_number[4] = buf[12];                                               /* set unique serial number index 4 */
-    unique_serial_number[5] = buf[13];                                               /* set unique serial number index 5 */
-    unique_serial_number[6] = buf[15];                                               /* set unique serial number index 6 */
-    unique_serial_number[7] = buf[16];                                               /* set unique serial number index 7 */
     
-    return 0;                                                                        /* success return 0 */
+    *lower_bound_percent = handle->poll_lower_percent;        /* get the lower bound */
+    *first_step_ms = handle->poll_first_step_ms;              /* get the first step */
+    *max_step_ms = handle->poll_max_step_ms;                  /* get the max step */
+    
+    return 0;                                                 /* success return 0 */
 }
 
 /**
- * @brief      read data
+ * @brief      get the observed ready time of the last polled command
  * @param[in]  *handle pointer to a stcc4 handle structure
- * @param[out] *co2_raw pointer to a co2 raw buffer
- * @param[out] *co2_ppm pointer to a co2 ppm buffer
- * @param[out] *temperature_raw pointer to a temperature raw buffer
- * @param[out] *temperature_s pointer to a temperature buffer
- * @param[out] *humidity_raw pointer to a humidity raw buffer
- * @param[out] *humidity_s pointer to a humidity buffer
- * @param[out] *sensor_status pointer to a sensor status buffer
+ * @param[out] *ms pointer to a time buffer
  * @return     status code
  *             - 0 success
- *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- *             - 4 crc is error
- * @note       none
+ * @note       the time is measured in delay_ms steps from the command write, 0 before the first polled command
  */
-uint8_t stcc4_read(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
-                   uint16_t *temperature_raw, float *temperature_s,
-                   uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status)
+uint8_t stcc4_get_observed_ready_time(stcc4_handle_t *handle, uint32_t *ms)
 {
-    uint8_t res;
-    uint8_t buf[12];
-    
-    if (handle == NULL)                                                                   /* check handle */
+    if (handle == NULL)                        /* check handle */
     {
-        return 2;                                                                         /* return error */
+        return 2;                              /* return error */
     }
-    if (handle->inited != 1)                                                              /* check handle initialization */
+    if (handle->inited != 1)                   /* check handle initialization */
     {
-        return 3;                                                                         /* return error */
+        return 3;                              /* return error */
     }
     
-    res = a_stcc4_iic_read(handle, STCC4_COMMAND_READ_MEASUREMENT, buf, 12, 1);           /* read data */
-    if (res != 0)                                                                         /* check result */
+    *ms = handle->ready_ms;                    /* get the ready time */
+    
+    return 0;                                  /* success return 0 */
+}
+
+/**
+ * @brief     check the linked functions
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 3 linked functions is NULL
+ * @note      every hook needs the plain or the *_ctx function
+ */
+static uint8_t a_stcc4_check_link(stcc4_handle_t *handle)
+{
+    if (STCC4_OPS(handle)->debug_print == NULL)                                      /* check debug_print */
     {
-        handle->debug_print("stcc4: read measurement failed.\n");                         /* read measurement failed */
-       
-        return 1;                                                                         /* return error */
+        return 3;                                                                    /* return error */
     }
-    
-    if (buf[2] != a_stcc4_generate_crc(&buf[0], 2))                                       /* check crc */
+    if ((STCC4_OPS(handle)->iic_init == NULL) && 
+        (STCC4_OPS(handle)->iic_init_ctx == NULL))                                   /* check iic_init */
     {
-        handle->debug_print("stcc4: crc is error.\n");                                    /* crc is error */
-       
-        return 4;                                                                         /* return error */
+        STCC4_OPS(handle)->debug_print("stcc4: iic_init is null.\n");                /* iic_init is null */
+    
+        return 3;                                                                    /* return error */
     }
-    if (buf[5] != a_stcc4_generate_crc(&buf[3], 2))                                       /* check crc */
+    if ((STCC4_OPS(handle)->iic_deinit == NULL) && 
+        (STCC4_OPS(handle)->iic_deinit_ctx == NULL))                                 /* check iic_deinit */
     {
-        handle->debug_print("stcc4: crc is error.\n");                                    /* crc is error */
-       
-        return 4;                                                                         /* return error */
+        STCC4_OPS(handle)->debug_print("stcc4: iic_deinit is null.\n");              /* iic_deinit is null */
+    
+        return 3;                                                                    /* return error */
     }
-    if (buf[8] != a_stcc4_generate_crc(&buf[6], 2))                                       /* check crc */
+    if ((STCC4_OPS(handle)->iic_write_cmd == NULL) && 
+        (STCC4_OPS(handle)->iic_write_cmd_ctx == NULL))                              /* check iic_write_cmd */
     {
-        handle->debug_print("stcc4: crc is error.\n");                                    /* crc is error */
-       
-        return 4;                                                                         /* return error */
+        STCC4_OPS(handle)->debug_print("stcc4: iic_write_cmd is null.\n");           /* iic_write_cmd is null */
+    
+        return 3;                                                                    /* return error */
     }
-    if (buf[11] != a_stcc4_generate_crc(&buf[9], 2))                                      /* check crc */
+    if ((STCC4_OPS(handle)->iic_read_cmd == NULL) && 
+        (STCC4_OPS(handle)->iic_read_cmd_ctx == NULL))                               /* check iic_read_cmd */
     {
-        handle->debug_print("stcc4: crc is error.\n");                                    /* crc is error */
-       
-        return 4;                                                                         /* return error */
+        STCC4_OPS(handle)->debug_print("stcc4: iic_read_cmd is null.\n");            /* iic_read_cmd is null */
+    
+        return 3;                                                                    /* return error */
     }
+    if ((STCC4_OPS(handle)->delay_ms == NULL) && 
+        (STCC4_OPS(handle)->delay_ms_ctx == NULL))                                   /* check delay_ms */
+    {
+        STCC4_OPS(handle)->debug_print("stcc4: delay_ms is null.\n");                /* delay_ms is null */
     
-    *co2_raw = (int16_t)(((uint16_t)buf[0]) << 8) | buf[1];                               /* set co2 raw */
-    *temperature_raw = (uint16_t)(((uint16_t)buf[3]) << 8) | buf[4];                      /* set temperature raw */
-    *humidity_raw = (uint16_t)(((uint16_t)buf[6]) << 8) | buf[7];                         /* set humidity raw */
-    *sensor_status = (uint16_t)(((uint16_t)buf[9]) << 8) | buf[10];                       /* set sensor status */
-    *co2_ppm = *co2_raw;                                                                  /* set co2 ppm */
-    *temperature_s = -45.0f + 175.0f * (float)(*temperature_raw) / 65535.0f;              /* set temperature */
-    *humidity_s = 125.0f * (float)(*humidity_raw) / 65535.0f - 6.0f;                      /* set humidity */
+        return 3;                                                                    /* return error */
+    }
     
-    return 0;                                                                             /* success return 0 */
+    return 0;                                                                        /* success return 0 */
 }
 
 /**
@@ -933,99 +2076,92 @@ uint8_t stcc4_read(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
  *            - 0 success
  *            - 1 iic initialization failed
  *            - 2 handle is NULL
- *            - 3 linked functions is NULL
+ *            - 3 linked functions is NULL or the link table is relinked
  *            - 4 product id is invalid
- * @note      none
+ * @note      with STCC4_OPS_TABLE a handle on the macro filled stcc4_link_ops is rejected when
+ *            the table differs from the one of a still inited handle, stcc4_init and stcc4_deinit
+ *            update the shared link bookkeeping without a lock and must not run concurrently
  */
 uint8_t stcc4_init(stcc4_handle_t *handle)
 {
     uint8_t res;
-    uint8_t reg;
-    uint8_t i;
     uint32_t product_id;
     uint8_t buf[18];
     
-    if (handle == NULL)                                                              /* check handle */
-    {
-        return 2;                                                                    /* return error */
-    }
-    if (handle->debug_print == NULL)                                                 /* check debug_print */
-    {
-        return 3;                                                                    /* return error */
-    }
-    if (handle->iic_init == NULL)                                                    /* check iic_init */
+    if (handle == NULL)                                                                          /* check handle */
     {
-        handle->debug_print("stcc4: iic_init is null.\n");                           /* iic_init is null */
-    
-        return 3;                                                                    /* return error */
+        return 2;                                                                                /* return error */
     }
-    if (handle->iic_deinit == NULL)                                                  /* check iic_deinit */
+#if (STCC4_OPS_TABLE != 0)
+    if (handle->ops == NULL)                                                                     /* check ops */
     {
-        handle->debug_print("stcc4: iic_deinit is null.\n");                         /* iic_deinit is null */
-    
-        return 3;                                                                    /* return error */
+        return 3;                                                                                /* return error */
     }
-    if (handle->iic_write_cmd == NULL)                                               /* check iic_write_cmd */
+    if (handle->ops != gs_ops_checked)                                                           /* check a new table once */
     {
-        handle->debug_print("stcc4: iic_write_cmd is null.\n");                      /* iic_write_cmd is null */
-    
-        return 3;                                                                    /* return error */
+        if (a_stcc4_check_link(handle) != 0)                                                     /* check the linked functions */
+        {
+            return 3;                                                                            /* return error */
+        }
+        if (handle->ops != &stcc4_link_ops)                                                      /* the macros may still change the link table */
+        {
+            gs_ops_checked = handle->ops;                                                        /* remember the checked table */
+        }
     }
-    if (handle->iic_read_cmd == NULL)                                                /* check iic_read_cmd */
+    if ((handle->ops == &stcc4_link_ops) && (handle->inited != 1) && (gs_link_users != 0) &&
+        (memcmp(&stcc4_link_ops, &gs_link_snapshot, sizeof(stcc4_ops_t)) != 0))                  /* check a relinked table */
     {
-        handle->debug_print("stcc4: iic_read_cmd is null.\n");                       /* iic_read_cmd is null */
-    
-        return 3;                                                                    /* return error */
+        stcc4_link_ops.debug_print("stcc4: link table is relinked while a handle is inited.\n"); /* link table is relinked */
+        
+        return 3;                                                                                /* return error */
     }
-    if (handle->delay_ms == NULL)                                                    /* check delay_ms */
+#else
+    if (a_stcc4_check_link(handle) != 0)                                                         /* check the linked functions */
     {
-        handle->debug_print("stcc4: delay_ms is null.\n");                           /* delay_ms is null */
-    
-        return 3;                                                                    /* return error */
+        return 3;                                                                                /* return error */
     }
+#endif
     
-    if (handle->iic_init() != 0)                                                     /* iic init */
+    if (a_stcc4_hook_init(handle) != 0)                                                          /* iic init */
     {
-        handle->debug_print("stcc4: iic init failed.\n");                            /* iic init failed */
+        STCC4_OPS(handle)->debug_print("stcc4: iic init failed.\n");                             /* iic init failed */
     
-        return 1;                                                                    /* return error */
+        return 1;                                                                                /* return error */
     }
     
-    reg = STCC4_COMMAND_PERFORM_SOFT_RESET;                                          /* perform soft reset command */
-    (void)handle->iic_write_cmd(0x00, &reg, 1);                                      /* perform soft reset */
-    handle->delay_ms(10);                                                            /* wait 10ms */
-    
-    res = a_stcc4_iic_read(handle, STCC4_COMMAND_GET_PRODUCT_ID, buf, 18, 1);        /* write config */
-    if (res != 0)                                                                    /* check result */
+    (void)a_stcc4_execute(handle, STCC4_STATS_COMMAND_PERFORM_SOFT_RESET, NULL, NULL, 1);        /* perform soft reset */
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_GET_PRODUCT_ID, NULL, buf, 1);             /* get product id */
+    if (res != 0)                                                                                /* check result */
     {
-        handle->debug_print("stcc4: get product id failed.\n");                      /* get product id failed */
-        (void)handle->iic_deinit();                                                  /* iic deinit */
+        (void)a_stcc4_hook_deinit(handle);                                                       /* iic deinit */
         
-        return 4;                                                                    /* return error */
-    }
-    for (i = 0; i < 18; i += 3)                                                      /* check all */
-    {
-        if (a_stcc4_generate_crc(buf + i, 2) != buf[i + 2])                          /* check crc */
-        {
-            handle->debug_print("stcc4: crc check failed.\n");                       /* crc check failed */
-            (void)handle->iic_deinit();                                              /* iic deinit */
-            
-            return 4;                                                                /* return error */
-        }
+        return 4;                                                                                /* return error */
     }
     product_id = ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) |
-                  ((uint32_t)buf[3] << 8) | ((uint32_t)buf[4] << 0);                 /* set product id */
-    if (product_id != 0x0901018AU)                                                   /* check product id */
+                  ((uint32_t)buf[3] << 8) | ((uint32_t)buf[4] << 0);                             /* set product id */
+    if (product_id != 0x0901018AU)                                                               /* check product id */
     {
-        handle->debug_print("stcc4: product id is invalid.\n");                      /* id is invalid */
-        (void)handle->iic_deinit();                                                  /* iic deinit */
+        STCC4_OPS(handle)->debug_print("stcc4: product id is invalid.\n");                       /* id is invalid */
+        (void)a_stcc4_hook_deinit(handle);                                                       /* iic deinit */
         
-        return 4;                                                                    /* return error */
+        return 4;                                                                                /* return error */
     }
     
-    handle->inited = 1;                                                              /* flag finish initialization */
+#if (STCC4_OPS_TABLE != 0)
+    if ((handle->ops == &stcc4_link_ops) && (handle->inited != 1))                               /* check the link table */
+    {
+        if (gs_link_users == 0)                                                                  /* check the first user */
+        {
+            gs_link_snapshot = stcc4_link_ops;                                                   /* save the table */
+        }
+        gs_link_users++;                                                                         /* users++ */
+    }
+#endif
+    handle->frame_valid = 0;                                                                     /* drop the last polled frame */
+    handle->measure_state = STCC4_MEASURE_STATE_IDLE;                                            /* set idle state */
+    handle->inited = 1;                                                                          /* flag finish initialization */
   
-    return 0;                                                                        /* success return 0 */
+    return 0;                                                                                    /* success return 0 */
 }
 
 /**
@@ -1043,31 +2179,37 @@ uint8_t stcc4_deinit(stcc4_handle_t *handle)
 {
     uint8_t res;
     
-    if (handle == NULL)                                                                         /* check handle */
+    if (handle == NULL)                                                                                   /* check handle */
     {
-        return 2;                                                                               /* return error */
+        return 2;                                                                                         /* return error */
     }
-    if (handle->inited != 1)                                                                    /* check handle initialization */
+    if (handle->inited != 1)                                                                              /* check handle initialization */
     {
-        return 3;                                                                               /* return error */
+        return 3;                                                                                         /* return error */
     }    
     
-    res = a_stcc4_iic_write(handle, STCC4_COMMAND_STOP_CONTINUOUS_MEASUREMENT, NULL, 0);        /* write config */
-    if (res != 0)                                                                               /* check result */
+    res = a_stcc4_execute(handle, STCC4_STATS_COMMAND_STOP_CONTINUOUS_MEASUREMENT, NULL, NULL, 0);        /* stop continuous measurement */
+    if (res != 0)                                                                                         /* check result */
     {
-        handle->debug_print("stcc4: stop continuous measurement failed.\n");                    /* stop continuous measurement failed */
-       
-        return 4;                                                                               /* return error */
+        return 4;                                                                                         /* return error */
     }
-    if (handle->iic_deinit() != 0)                                                              /* iic deinit */
+    if (a_stcc4_hook_deinit(handle) != 0)                                                                 /* iic deinit */
     {
-        handle->debug_print("stcc4: iic close failed.\n");                                      /* iic close failed */
+        STCC4_OPS(handle)->debug_print("stcc4: iic close failed.\n");                                     /* iic close failed */
     
-        return 3;                                                                               /* return error */
+        return 3;                                                                                         /* return error */
+    }
+#if (STCC4_OPS_TABLE != 0)
+    if ((handle->ops == &stcc4_link_ops) && (gs_link_users != 0))                                         /* check the link table */
+    {
+        gs_link_users--;                                                                                  /* users-- */
     }
-    handle->inited = 0;                                                                         /* flag close initialization */
+#endif
+    handle->frame_valid = 0;                                                                              /* drop the last polled frame */
+    handle->measure_state = STCC4_MEASURE_STATE_IDLE;                                                     /* set idle state */
+    handle->inited = 0;                                                                                   /* flag close initialization */
   
-    return 0;                                                                                   /* success return 0 */
+    return 0;                                                                                             /* success return 0 */
 }
 
 /**
@@ -1232,6 +2374,60 @@ uint8_t stcc4_temperature_convert_to_data(stcc4_handle_t *handle, uint16_t reg,
     return 0;                                               /* success return 0 */
 }
 
+/**
+ * @brief      convert the register raw data to humidity in 0.001 %
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *mpercentage pointer to a 0.001 % buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only
+ */
+uint8_t stcc4_humidity_convert_to_fixed(stcc4_handle_t *handle, uint16_t reg, int32_t *mpercentage)
+{
+    if (handle == NULL)                                     /* check handle */
+    {
+        return 2;                                           /* return error */
+    }
+    if (handle->inited != 1)                                /* check handle initialization */
+    {
+        return 3;                                           /* return error */
+    }
+    
+    *mpercentage = a_stcc4_humidity_to_milli(reg);          /* convert raw data to real data */
+    
+    return 0;                                               /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to temperature in 0.001 degrees
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *mdeg pointer to a 0.001 degrees buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only
+ */
+uint8_t stcc4_temperature_convert_to_fixed(stcc4_handle_t *handle, uint16_t reg, int32_t *mdeg)
+{
+    if (handle == NULL)                                     /* check handle */
+    {
+        return 2;                                           /* return error */
+    }
+    if (handle->inited != 1)                                /* check handle initialization */
+    {
+        return 3;                                           /* return error */
+    }
+    
+    *mdeg = a_stcc4_temperature_to_milli(reg);              /* convert raw data to real data */
+    
+    return 0;                                               /* success return 0 */
+}
+
 /**
  * @brief      convert the pressure to the register raw data
  * @param[in]  *handle pointer to a stcc4 handle structure
@@ -1286,6 +2482,224 @@ uint8_t stcc4_pressure_convert_to_data(stcc4_handle_t *handle, uint16_t reg, flo
     return 0;                       /* success return 0 */
 }
 
+/**
+ * @brief     convert a raw array with y = x / div * mul - sub
+ * @param[in] *reg pointer to a register raw array
+ * @param[out] *out pointer to a float array
+ * @param[in] len array length
+ * @param[in] div divisor
+ * @param[in] mul multiplier
+ * @param[in] sub subtrahend
+ * @note      every lane runs the same ieee operations in the same order as the scalar code,
+ *            so all kernels give bit exact results
+ */
+static void a_stcc4_convert_batch(const uint16_t *reg, float *out, uint32_t len, float div, float mul, float sub)
+{
+    uint32_t i = 0;
+    
+#if defined(STCC4_CONVERT_KERNEL_AVX2)
+    const __m256 vdiv = _mm256_set1_ps(div);
+    const __m256 vmul = _mm256_set1_ps(mul);
+    const __m256 vsub = _mm256_set1_ps(sub);
+    
+    for (; (i + 8) <= len; i += 8)                                                          /* 8 lanes */
+    {
+        __m128i raw = _mm_loadu_si128((const __m128i *)(reg + i));                          /* load 8 raw */
+        __m256 x = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(raw));                          /* widen to float */
+        
+        x = _mm256_sub_ps(_mm256_mul_ps(_mm256_div_ps(x, vdiv), vmul), vsub);               /* convert */
+        _mm256_storeu_ps(out + i, x);                                                       /* store */
+    }
+#elif defined(STCC4_CONVERT_KERNEL_SSE2)
+    const __m128 vdiv = _mm_set1_ps(div);
+    const __m128 vmul = _mm_set1_ps(mul);
+    const __m128 vsub = _mm_set1_ps(sub);
+    const __m128i zero = _mm_setzero_si128();
+    
+    for (; (i + 8) <= len; i += 8)                                                          /* 2 x 4 lanes */
+    {
+        __m128i raw = _mm_loadu_si128((const __m128i *)(reg + i));                          /* load 8 raw */
+        __m128 lo = _mm_cvtepi32_ps(_mm_unpacklo_epi16(raw, zero));                         /* widen low half */
+        __m128 hi = _mm_cvtepi32_ps(_mm_unpackhi_epi16(raw, zero));                         /* widen high half */
+        
+        lo = _mm_sub_ps(_mm_mul_ps(_mm_div_ps(lo, vdiv), vmul), vsub);                      /* convert low half */
+        hi = _mm_sub_ps(_mm_mul_ps(_mm_div_ps(hi, vdiv), vmul), vsub);                      /* convert high half */
+        _mm_storeu_ps(out + i + 0, lo);                                                     /* store low half */
+        _mm_storeu_ps(out + i + 4, hi);                                                     /* store high half */
+    }
+#elif defined(STCC4_CONVERT_KERNEL_NEON)
+    const float32x4_t vdiv = vdupq_n_f32(div);
+    const float32x4_t vmul = vdupq_n_f32(mul);
+    const float32x4_t vsub = vdupq_n_f32(sub);
+    
+    for (; (i + 8) <= len; i += 8)                                                          /* 2 x 4 lanes */
+    {
+        uint16x8_t raw = vld1q_u16(reg + i);                                                /* load 8 raw */
+        float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(raw)));                       /* widen low half */
+        float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(raw)));                      /* widen high half */
+        
+        lo = vsubq_f32(vmulq_f32(vdivq_f32(lo, vdiv), vmul), vsub);                         /* convert low half */
+        hi = vsubq_f32(vmulq_f32(vdivq_f32(hi, vdiv), vmul), vsub);                         /* convert high half */
+        vst1q_f32(out + i + 0, lo);                                                         /* store low half */
+        vst1q_f32(out + i + 4, hi);                                                         /* store high half */
+    }
+#endif
+    for (; i < len; i++)                                                                    /* scalar tail */
+    {
+        out[i] = (float)(reg[i]) / div * mul - sub;                                         /* convert */
+    }
+}
+
+/**
+ * @brief      convert a register raw array to frc co2 ppm
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *ppm pointer to a ppm array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       results are bit exact with stcc4_frc_co2_convert_to_data
+ */
+uint8_t stcc4_frc_co2_convert_to_data_batch(stcc4_handle_t *handle, const uint16_t *reg, float *ppm, uint32_t len)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    a_stcc4_convert_batch(reg, ppm, len, 1.0f, 1.0f, 32768.0f);       /* convert raw data to real data */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      convert a register raw array to humidity
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *percentage pointer to a percentage array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       results are bit exact with stcc4_humidity_convert_to_data
+ */
+uint8_t stcc4_humidity_convert_to_data_batch(stcc4_handle_t *handle, const uint16_t *reg, float *percentage, uint32_t len)
+{
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    a_stcc4_convert_batch(reg, percentage, len, 65535.0f, 125.0f, 6.0f);     /* convert raw data to real data */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      convert a register raw array to temperature
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *deg pointer to a degrees array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       results are bit exact with stcc4_temperature_convert_to_data
+ */
+uint8_t stcc4_temperature_convert_to_data_batch(stcc4_handle_t *handle, const uint16_t *reg, float *deg, uint32_t len)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    a_stcc4_convert_batch(reg, deg, len, 65535.0f, 175.0f, 45.0f);    /* convert raw data to real data */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      convert a register raw array to humidity in 0.01 %
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *centi_percentage pointer to a 0.01 % array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only, rounded to the nearest 0.01 %
+ */
+uint8_t stcc4_humidity_convert_to_fixed_batch(stcc4_handle_t *handle, const uint16_t *reg, int16_t *centi_percentage, uint32_t len)
+{
+    uint32_t i;
+    
+    if (handle == NULL)                                                                       /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                  /* check handle initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                                 /* convert all */
+    {
+        centi_percentage[i] = (int16_t)((int32_t)a_stcc4_div_65535(12500UL * reg[i] + 32767UL) - 600);   /* convert raw data to real data */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      convert a register raw array to temperature in 0.01 degrees
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *centi_deg pointer to a 0.01 degrees array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only, rounded to the nearest 0.01 degree
+ */
+uint8_t stcc4_temperature_convert_to_fixed_batch(stcc4_handle_t *handle, const uint16_t *reg, int16_t *centi_deg, uint32_t len)
+{
+    uint32_t i;
+    
+    if (handle == NULL)                                                                       /* check handle */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                                  /* check handle initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                                 /* convert all */
+    {
+        centi_deg[i] = (int16_t)((int32_t)a_stcc4_div_65535(17500UL * reg[i] + 32767UL) - 4500);  /* convert raw data to real data */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
 /**
  * @brief     set the chip register
  * @param[in] *handle pointer to a stcc4 handle structure
@@ -1297,20 +2711,39 @@ uint8_t stcc4_pressure_convert_to_data(stcc4_handle_t *handle, uint16_t reg, flo
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      a plain write of the register and the data
  */
 uint8_t stcc4_set_reg(stcc4_handle_t *handle, uint16_t reg, uint8_t *buf, uint16_t len)
 {
-    if (handle == NULL)                                       /* check handle */
+    uint8_t data[16];
+    
+    if (handle == NULL)                                                 /* check handle */
     {
-        return 2;                                             /* return error */
+        return 2;                                                       /* return error */
     }
-    if (handle->inited != 1)                                  /* check handle initialization */
+    if (handle->inited != 1)                                            /* check handle initialization */
     {
-        return 3;                                             /* return error */
+        return 3;                                                       /* return error */
     }
-  
-    return a_stcc4_iic_write(handle, reg, buf, len);          /* write data */
+    if (len > 14)                                                       /* check length */
+    {
+        return 1;                                                       /* return error */
+    }
+    
+    data[0] = (uint8_t)((reg >> 8) & 0xFF);                             /* set MSB of reg */
+    data[1] = (uint8_t)(reg & 0xFF);                                    /* set LSB of reg */
+    if (len != 0)                                                       /* check length */
+    {
+        memcpy(data + 2, buf, len);                                     /* copy write data */
+    }
+    a_stcc4_stats_begin(handle, a_stcc4_command_index(reg));            /* begin the command stats */
+    if (a_stcc4_bus_write(handle, handle->iic_addr, data, 
+                          (uint16_t)(len + 2)) != 0)                    /* write data */
+    {
+        return 1;                                                       /* return error */
+    }
+    
+    return 0;                                                           /* success return 0 */
 }
 
 /**
@@ -1325,21 +2758,133 @@ uint8_t stcc4_set_reg(stcc4_handle_t *handle, uint16_t reg, uint8_t *buf, uint16
  *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the plain write, delay_ms and read sequence, ready polling and the combined transfer are not used
  */
 uint8_t stcc4_get_reg(stcc4_handle_t *handle, uint16_t reg, uint8_t *buf, uint16_t len, uint16_t delay_ms)
 {
-    if (handle == NULL)                                            /* check handle */
+    uint8_t data[2];
+    
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                  /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                       /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                                  /* return error */
+        return 3;                                                         /* return error */
     }
-  
-    return a_stcc4_iic_read(handle, reg, buf, len, delay_ms);      /* read data */
+    
+    data[0] = (uint8_t)((reg >> 8) & 0xFF);                               /* set MSB of reg */
+    data[1] = (uint8_t)(reg & 0xFF);                                      /* set LSB of reg */
+    a_stcc4_stats_begin(handle, a_stcc4_command_index(reg));              /* begin the command stats */
+    if (a_stcc4_bus_write(handle, handle->iic_addr, data, 2) != 0)        /* write command */
+    {
+        return 1;                                                         /* return error */
+    }
+    if (delay_ms != 0)                                                    /* check the delay */
+    {
+        a_stcc4_delay_ms(handle, delay_ms);                               /* delay ms */
+    }
+    if (a_stcc4_bus_read(handle, buf, len) != 0)                          /* read data */
+    {
+        return 1;                                                         /* return error */
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      generate the crc8 of a data buffer
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len data buffer length
+ * @param[out] *crc pointer to a crc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf is NULL
+ * @note       polynomial 0x31, init 0xFF, the backend is selected by STCC4_CRC8_BACKEND
+ */
+uint8_t stcc4_crc8(uint8_t *buf, uint16_t len, uint8_t *crc)
+{
+    if ((buf == NULL) || (crc == NULL))              /* check buf */
+    {
+        return 2;                                    /* return error */
+    }
+    
+    *crc = a_stcc4_generate_crc(buf, len);           /* generate the crc */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief      check all crc words of a sensirion word frame
+ * @param[in]  *frame pointer to a frame buffer
+ * @param[in]  words number of 2 + 1 bytes words in the frame
+ * @param[out] *error_mask pointer to an error mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 frame is NULL
+ *             - 5 words is over 16
+ * @note       bit n of the error mask is set when word n has a crc error
+ */
+uint8_t stcc4_check_frame(uint8_t *frame, uint8_t words, uint16_t *error_mask)
+{
+    if ((frame == NULL) || (error_mask == NULL))             /* check frame */
+    {
+        return 2;                                            /* return error */
+    }
+    if (words > 16)                                          /* check words */
+    {
+        return 5;                                            /* return error */
+    }
+    
+    *error_mask = a_stcc4_check_frame(frame, words);         /* check the frame */
+    
+    return 0;                                                /* success return 0 */
+}
+
+#if (STCC4_INSTRUMENTATION != 0)
+/**
+ * @brief      get a snapshot of the command stats
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *stats pointer to a stcc4 stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or stats is NULL
+ * @note       the stats are kept through stcc4_deinit and stcc4_init
+ */
+uint8_t stcc4_get_stats(stcc4_handle_t *handle, stcc4_stats_t *stats)
+{
+    if ((handle == NULL) || (stats == NULL))                 /* check handle */
+    {
+        return 2;                                            /* return error */
+    }
+    
+    a_stcc4_stats_close(handle);                             /* close the last latency */
+    memcpy(stats, &handle->stats, sizeof(stcc4_stats_t));    /* copy the stats */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     clear the command stats
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t stcc4_clear_stats(stcc4_handle_t *handle)
+{
+    if (handle == NULL)                                      /* check handle */
+    {
+        return 2;                                            /* return error */
+    }
+    
+    memset(&handle->stats, 0, sizeof(stcc4_stats_t));        /* clear the stats */
+    handle->stats_open = 0;                                  /* drop the open latency */
+    
+    return 0;                                                /* success return 0 */
 }
+#endif
 
 /**
  * @brief      get chip information
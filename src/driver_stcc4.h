@@ -56,6 +56,21 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief stcc4 crc8 backend definition
+ */
+#define STCC4_CRC8_BACKEND_BITWISE         0        /**< bit by bit loop, no table */
+#define STCC4_CRC8_BACKEND_TABLE_16        1        /**< 16 bytes nibble table */
+#define STCC4_CRC8_BACKEND_TABLE_256       2        /**< 256 bytes byte table */
+
+/**
+ * @brief stcc4 crc8 backend selection
+ * @note  override it in the compiler flags, e.g. -DSTCC4_CRC8_BACKEND=1 for the flash constrained builds
+ */
+#ifndef STCC4_CRC8_BACKEND
+    #define STCC4_CRC8_BACKEND STCC4_CRC8_BACKEND_TABLE_256
+#endif
+
 /**
  * @brief stcc4 address enumeration definition
  */
@@ -74,19 +89,180 @@ typedef enum
     STCC4_BOOL_TRUE  = 0x01,        /**< true */
 } stcc4_bool_t;
 
+/**
+ * @brief stcc4 batch convert simd switch definition
+ * @note  set 0 to build the batch convert functions with the scalar loop only
+ */
+#ifndef STCC4_CONVERT_SIMD
+    #define STCC4_CONVERT_SIMD        1        /**< use sse2, avx2 or aarch64 neon kernels when available */
+#endif
+
+/**
+ * @brief stcc4 raw measurement frame size definition
+ */
+#define STCC4_RAW_FRAME_SIZE        12        /**< co2, temperature, humidity and status words with crc */
+
+/**
+ * @brief stcc4 measurement frame crc error bit definition
+ */
+#define STCC4_CRC_ERROR_CO2                (1 << 0)        /**< co2 word crc error */
+#define STCC4_CRC_ERROR_TEMPERATURE        (1 << 1)        /**< temperature word crc error */
+#define STCC4_CRC_ERROR_HUMIDITY           (1 << 2)        /**< humidity word crc error */
+#define STCC4_CRC_ERROR_SENSOR_STATUS      (1 << 3)        /**< sensor status word crc error */
+
+/**
+ * @brief stcc4 measure state enumeration definition
+ */
+typedef enum
+{
+    STCC4_MEASURE_STATE_IDLE        = 0x00,        /**< no measurement is running */
+    STCC4_MEASURE_STATE_SINGLE_SHOT = 0x01,        /**< single shot conversion is running */
+    STCC4_MEASURE_STATE_CONTINUOUS  = 0x02,        /**< continuous measurement is running */
+} stcc4_measure_state_t;
+
+/**
+ * @brief stcc4 instrumentation switch definition
+ * @note  set 1 to count the calls, bus bytes, errors and time of every command, 0 compiles all of it out
+ */
+#ifndef STCC4_INSTRUMENTATION
+    #define STCC4_INSTRUMENTATION        0        /**< disable by default */
+#endif
+
+/**
+ * @brief stcc4 ops table switch definition
+ * @note  set 1 to keep the linked functions in one shared stcc4_ops_t and only a pointer to it in every handle
+ */
+#ifndef STCC4_OPS_TABLE
+    #define STCC4_OPS_TABLE        0        /**< disable by default */
+#endif
+
+/**
+ * @brief stcc4 latency histogram size definition
+ */
+#define STCC4_STATS_HISTOGRAM_SIZE        26        /**< bucket n holds [2^n, 2^(n + 1)) us, the last one is open */
+
+/**
+ * @brief stcc4 stats command enumeration definition
+ */
+typedef enum
+{
+    STCC4_STATS_COMMAND_START_CONTINUOUS_MEASUREMENT = 0x00,        /**< start continuous measurement */
+    STCC4_STATS_COMMAND_STOP_CONTINUOUS_MEASUREMENT  = 0x01,        /**< stop continuous measurement */
+    STCC4_STATS_COMMAND_READ_MEASUREMENT             = 0x02,        /**< read measurement */
+    STCC4_STATS_COMMAND_SET_RHT_COMPENSATION         = 0x03,        /**< set rht compensation */
+    STCC4_STATS_COMMAND_SET_PRESSURE_COMPENSATION    = 0x04,        /**< set pressure compensation */
+    STCC4_STATS_COMMAND_MEASURE_SINGLE_SHOT          = 0x05,        /**< measure single shot */
+    STCC4_STATS_COMMAND_ENTER_SLEEP_MODE             = 0x06,        /**< enter sleep mode */
+    STCC4_STATS_COMMAND_EXIT_SLEEP_MODE              = 0x07,        /**< exit sleep mode */
+    STCC4_STATS_COMMAND_PERFORM_CONDITIONING         = 0x08,        /**< perform conditioning */
+    STCC4_STATS_COMMAND_PERFORM_SOFT_RESET           = 0x09,        /**< perform soft reset */
+    STCC4_STATS_COMMAND_PERFORM_FACTORY_RESET        = 0x0A,        /**< perform factory reset */
+    STCC4_STATS_COMMAND_PERFORM_SELF_TEST            = 0x0B,        /**< perform self test */
+    STCC4_STATS_COMMAND_ENABLE_TESTING_MODE          = 0x0C,        /**< enable testing mode */
+    STCC4_STATS_COMMAND_DISABLE_TESTING_MODE         = 0x0D,        /**< disable testing mode */
+    STCC4_STATS_COMMAND_PERFORM_FORCED_RECALIBRATION = 0x0E,        /**< perform forced recalibration */
+    STCC4_STATS_COMMAND_GET_PRODUCT_ID               = 0x0F,        /**< get product id */
+    STCC4_STATS_COMMAND_OTHER                        = 0x10,        /**< unknown command sent by stcc4_set_reg or stcc4_get_reg */
+    STCC4_STATS_COMMAND_MAX                          = 0x11,        /**< command number */
+} stcc4_stats_command_t;
+
+/**
+ * @brief stcc4 command stats structure definition
+ */
+typedef struct stcc4_command_stats_s
+{
+    uint32_t calls;                                           /**< command count */
+    uint32_t bus_bytes;                                       /**< written and read bytes */
+    uint32_t iic_errors;                                      /**< failed bus transfers */
+    uint32_t crc_errors;                                      /**< frames with a crc error */
+    uint64_t bus_us;                                          /**< time spent in the bus callbacks in us */
+    uint64_t delay_us;                                        /**< time spent in delay_ms in us */
+    uint32_t histogram[STCC4_STATS_HISTOGRAM_SIZE];           /**< log2 histogram of the bus and delay time of one command in us */
+} stcc4_command_stats_t;
+
+/**
+ * @brief stcc4 stats structure definition
+ */
+typedef struct stcc4_stats_s
+{
+    stcc4_command_stats_t command[STCC4_STATS_COMMAND_MAX];        /**< stats of each command */
+} stcc4_stats_t;
+
+/**
+ * @brief stcc4 ops structure definition
+ * @note  the linked functions, shared by many handles when STCC4_OPS_TABLE is 1
+ */
+typedef struct stcc4_ops_s
+{
+    uint8_t (*iic_init)(void);                                                 /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void);                                               /**< point to an iic_deinit function address */
+    uint8_t (*iic_write_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);        /**< point to an iic_write_cmd function address */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);         /**< point to an iic_read_cmd function address */
+    uint8_t (*iic_write_read_cmd)(uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                  uint8_t *rbuf, uint16_t rlen);               /**< point to an optional iic_write_read_cmd function address */
+    void (*delay_ms)(uint32_t ms);                                             /**< point to a delay_ms function address */
+    void (*debug_print)(const char *const fmt, ...);                           /**< point to a debug_print function address */
+    uint8_t (*iic_init_ctx)(void *user);                                       /**< point to an optional iic_init_ctx function address */
+    uint8_t (*iic_deinit_ctx)(void *user);                                     /**< point to an optional iic_deinit_ctx function address */
+    uint8_t (*iic_write_cmd_ctx)(void *user, uint8_t addr,
+                                 uint8_t *buf, uint16_t len);                  /**< point to an optional iic_write_cmd_ctx function address */
+    uint8_t (*iic_read_cmd_ctx)(void *user, uint8_t addr,
+                                uint8_t *buf, uint16_t len);                   /**< point to an optional iic_read_cmd_ctx function address */
+    uint8_t (*iic_write_read_cmd_ctx)(void *user, uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                      uint8_t *rbuf, uint16_t rlen);           /**< point to an optional iic_write_read_cmd_ctx function address */
+    void (*delay_ms_ctx)(void *user, uint32_t ms);                             /**< point to an optional delay_ms_ctx function address */
+#if (STCC4_INSTRUMENTATION != 0)
+    uint32_t (*timestamp_us)(void);                                            /**< point to an optional timestamp_us function address */
+#endif
+} stcc4_ops_t;
+
 /**
  * @brief stcc4 handle structure definition
  */
 typedef struct stcc4_handle_s
 {
-    uint8_t iic_addr;                                                          /**< iic address */
+#if (STCC4_OPS_TABLE != 0)
+    const stcc4_ops_t *ops;                                                    /**< point to a shared ops table */
+#else
     uint8_t (*iic_init)(void);                                                 /**< point to an iic_init function address */
     uint8_t (*iic_deinit)(void);                                               /**< point to an iic_deinit function address */
     uint8_t (*iic_write_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);        /**< point to an iic_write_cmd function address */
     uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);         /**< point to an iic_read_cmd function address */
+    uint8_t (*iic_write_read_cmd)(uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                  uint8_t *rbuf, uint16_t rlen);               /**< point to an optional iic_write_read_cmd function address */
     void (*delay_ms)(uint32_t ms);                                             /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                           /**< point to a debug_print function address */
+    uint8_t (*iic_init_ctx)(void *user);                                       /**< point to an optional iic_init_ctx function address */
+    uint8_t (*iic_deinit_ctx)(void *user);                                     /**< point to an optional iic_deinit_ctx function address */
+    uint8_t (*iic_write_cmd_ctx)(void *user, uint8_t addr,
+                                 uint8_t *buf, uint16_t len);                  /**< point to an optional iic_write_cmd_ctx function address */
+    uint8_t (*iic_read_cmd_ctx)(void *user, uint8_t addr,
+                                uint8_t *buf, uint16_t len);                   /**< point to an optional iic_read_cmd_ctx function address */
+    uint8_t (*iic_write_read_cmd_ctx)(void *user, uint8_t addr, uint8_t *wbuf, uint16_t wlen,
+                                      uint8_t *rbuf, uint16_t rlen);           /**< point to an optional iic_write_read_cmd_ctx function address */
+    void (*delay_ms_ctx)(void *user, uint32_t ms);                             /**< point to an optional delay_ms_ctx function address */
+#endif
+    void *user;                                                                /**< user context passed to the *_ctx functions */
+    uint8_t iic_addr;                                                          /**< iic address */
     uint8_t inited;                                                            /**< inited flag */
+    uint8_t measure_state;                                                     /**< measure state */
+    uint32_t measure_deadline;                                                 /**< measure ready deadline in ms */
+    uint8_t poll_enable;                                                       /**< ready polling flag */
+    uint8_t poll_lower_percent;                                                /**< first poll after this percent of the worst case time */
+    uint16_t poll_first_step_ms;                                               /**< first poll back-off step in ms */
+    uint16_t poll_max_step_ms;                                                 /**< max poll back-off step in ms, 0 means no limit */
+    uint32_t ready_ms;                                                         /**< observed ready time of the last polled command in ms */
+    uint8_t frame_valid;                                                       /**< polled single shot frame flag */
+    uint8_t frame[STCC4_RAW_FRAME_SIZE];                                       /**< polled single shot frame */
+#if ((STCC4_INSTRUMENTATION != 0) && (STCC4_OPS_TABLE == 0))
+    uint32_t (*timestamp_us)(void);                                            /**< point to an optional timestamp_us function address */
+#endif
+#if (STCC4_INSTRUMENTATION != 0)
+    uint8_t stats_open;                                                        /**< a command latency is being counted */
+    uint8_t stats_command;                                                     /**< command of the counted latency */
+    uint32_t stats_latency_us;                                                 /**< counted latency in us */
+    stcc4_stats_t stats;                                                       /**< command stats */
+#endif
 } stcc4_handle_t;
 
 /**
@@ -116,6 +292,39 @@ typedef struct stcc4_info_s
  * @{
  */
 
+#if (STCC4_OPS_TABLE != 0)
+/**
+ * @brief shared ops table filled by the link macros
+ * @note  kept for the link macros only, handles with different functions need their own
+ *        const tables linked by DRIVER_STCC4_LINK_OPS
+ */
+extern stcc4_ops_t stcc4_link_ops;
+
+/**
+ * @brief     get the functions linked by the link macros
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @note      points the handle to stcc4_link_ops, every handle linked by the macros shares it,
+ *            stcc4_init rejects a relinked table while another macro linked handle is inited
+ */
+#define DRIVER_STCC4_LINK_TABLE(HANDLE)                      (*((HANDLE)->ops = &stcc4_link_ops, &stcc4_link_ops))
+
+/**
+ * @brief     link a shared ops table
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] OPS pointer to a const stcc4_ops_t table
+ * @note      the table can live in flash, it is checked once by stcc4_init, the check is cached
+ *            in one unlocked static so the inits of the handles must be serialized
+ */
+#define DRIVER_STCC4_LINK_OPS(HANDLE, OPS)                   (HANDLE)->ops = (OPS)
+#else
+/**
+ * @brief     get the functions linked by the link macros
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @note      the functions live in the handle
+ */
+#define DRIVER_STCC4_LINK_TABLE(HANDLE)                      (*(HANDLE))
+#endif
+
 /**
  * @brief     initialize stcc4_handle_t structure
  * @param[in] HANDLE pointer to a stcc4 handle structure
@@ -130,7 +339,7 @@ typedef struct stcc4_info_s
  * @param[in] FUC pointer to an iic_init function address
  * @note      none
  */
-#define DRIVER_STCC4_LINK_IIC_INIT(HANDLE, FUC)              (HANDLE)->iic_init = FUC
+#define DRIVER_STCC4_LINK_IIC_INIT(HANDLE, FUC)              DRIVER_STCC4_LINK_TABLE(HANDLE).iic_init = FUC
 
 /**
  * @brief     link iic_deinit function
@@ -138,7 +347,7 @@ typedef struct stcc4_info_s
  * @param[in] FUC pointer to an iic_deinit function address
  * @note      none
  */
-#define DRIVER_STCC4_LINK_IIC_DEINIT(HANDLE, FUC)            (HANDLE)->iic_deinit = FUC
+#define DRIVER_STCC4_LINK_IIC_DEINIT(HANDLE, FUC)            DRIVER_STCC4_LINK_TABLE(HANDLE).iic_deinit = FUC
 
 /**
  * @brief     link iic_read_cmd function
@@ -146,7 +355,15 @@ typedef struct stcc4_info_s
  * @param[in] FUC pointer to an iic_read_cmd function address
  * @note      none
  */
-#define DRIVER_STCC4_LINK_IIC_READ_COMMAND(HANDLE, FUC)      (HANDLE)->iic_read_cmd = FUC
+#define DRIVER_STCC4_LINK_IIC_READ_COMMAND(HANDLE, FUC)      DRIVER_STCC4_LINK_TABLE(HANDLE).iic_read_cmd = FUC
+
+/**
+ * @brief     link iic_write_read_cmd function
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] FUC pointer to an iic_write_read_cmd function address
+ * @note      optional, when linked the short commands write and read in one repeated start transfer
+ */
+#define DRIVER_STCC4_LINK_IIC_WRITE_READ_COMMAND(HANDLE, FUC)    DRIVER_STCC4_LINK_TABLE(HANDLE).iic_write_read_cmd = FUC
 
 /**
  * @brief     link iic_write_cmd function
@@ -154,7 +371,7 @@ typedef struct stcc4_info_s
  * @param[in] FUC pointer to an iic_write_cmd function address
  * @note      none
  */
-#define DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(HANDLE, FUC)     (HANDLE)->iic_write_cmd = FUC
+#define DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(HANDLE, FUC)     DRIVER_STCC4_LINK_TABLE(HANDLE).iic_write_cmd = FUC
 
 /**
  * @brief     link delay_ms function
@@ -162,7 +379,7 @@ typedef struct stcc4_info_s
  * @param[in] FUC pointer to a delay_ms function address
  * @note      none
  */
-#define DRIVER_STCC4_LINK_DELAY_MS(HANDLE, FUC)              (HANDLE)->delay_ms = FUC
+#define DRIVER_STCC4_LINK_DELAY_MS(HANDLE, FUC)              DRIVER_STCC4_LINK_TABLE(HANDLE).delay_ms = FUC
 
 /**
  * @brief     link debug_print function
@@ -170,7 +387,73 @@ typedef struct stcc4_info_s
  * @param[in] FUC pointer to a debug_print function address
  * @note      none
  */
-#define DRIVER_STCC4_LINK_DEBUG_PRINT(HANDLE, FUC)           (HANDLE)->debug_print = FUC
+#define DRIVER_STCC4_LINK_DEBUG_PRINT(HANDLE, FUC)           DRIVER_STCC4_LINK_TABLE(HANDLE).debug_print = FUC
+
+/**
+ * @brief     link the user context
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] USER pointer to a user context passed to the *_ctx functions
+ * @note      none
+ */
+#define DRIVER_STCC4_LINK_USER(HANDLE, USER)                 (HANDLE)->user = (void *)(USER)
+
+/**
+ * @brief     link iic_init_ctx function
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] FUC pointer to an iic_init_ctx function address
+ * @note      used instead of iic_init when it is linked
+ */
+#define DRIVER_STCC4_LINK_IIC_INIT_CTX(HANDLE, FUC)          DRIVER_STCC4_LINK_TABLE(HANDLE).iic_init_ctx = FUC
+
+/**
+ * @brief     link iic_deinit_ctx function
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] FUC pointer to an iic_deinit_ctx function address
+ * @note      used instead of iic_deinit when it is linked
+ */
+#define DRIVER_STCC4_LINK_IIC_DEINIT_CTX(HANDLE, FUC)        DRIVER_STCC4_LINK_TABLE(HANDLE).iic_deinit_ctx = FUC
+
+/**
+ * @brief     link iic_read_cmd_ctx function
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] FUC pointer to an iic_read_cmd_ctx function address
+ * @note      used instead of iic_read_cmd when it is linked
+ */
+#define DRIVER_STCC4_LINK_IIC_READ_COMMAND_CTX(HANDLE, FUC)  DRIVER_STCC4_LINK_TABLE(HANDLE).iic_read_cmd_ctx = FUC
+
+/**
+ * @brief     link iic_write_read_cmd_ctx function
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] FUC pointer to an iic_write_read_cmd_ctx function address
+ * @note      used instead of iic_write_read_cmd when it is linked
+ */
+#define DRIVER_STCC4_LINK_IIC_WRITE_READ_COMMAND_CTX(HANDLE, FUC)    DRIVER_STCC4_LINK_TABLE(HANDLE).iic_write_read_cmd_ctx = FUC
+
+/**
+ * @brief     link iic_write_cmd_ctx function
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] FUC pointer to an iic_write_cmd_ctx function address
+ * @note      used instead of iic_write_cmd when it is linked
+ */
+#define DRIVER_STCC4_LINK_IIC_WRITE_COMMAND_CTX(HANDLE, FUC) DRIVER_STCC4_LINK_TABLE(HANDLE).iic_write_cmd_ctx = FUC
+
+/**
+ * @brief     link delay_ms_ctx function
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] FUC pointer to a delay_ms_ctx function address
+ * @note      used instead of delay_ms when it is linked
+ */
+#define DRIVER_STCC4_LINK_DELAY_MS_CTX(HANDLE, FUC)          DRIVER_STCC4_LINK_TABLE(HANDLE).delay_ms_ctx = FUC
+
+#if (STCC4_INSTRUMENTATION != 0)
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to a stcc4 handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      optional, without it the bus time is not measured and the delay time is the requested time
+ */
+#define DRIVER_STCC4_LINK_TIMESTAMP_US(HANDLE, FUC)          DRIVER_STCC4_LINK_TABLE(HANDLE).timestamp_us = FUC
+#endif
 
 /**
  * @}
@@ -222,9 +505,11 @@ uint8_t stcc4_get_address_pin(stcc4_handle_t *handle, stcc4_address_t *address);
  *            - 0 success
  *            - 1 iic initialization failed
  *            - 2 handle is NULL
- *            - 3 linked functions is NULL
+ *            - 3 linked functions is NULL or the link table is relinked
  *            - 4 product id is invalid
- * @note      none
+ * @note      with STCC4_OPS_TABLE a handle on the macro filled stcc4_link_ops is rejected when
+ *            the table differs from the one of a still inited handle, stcc4_init and stcc4_deinit
+ *            update the shared link bookkeeping without a lock and must not run concurrently
  */
 uint8_t stcc4_init(stcc4_handle_t *handle);
 
@@ -263,6 +548,88 @@ uint8_t stcc4_read(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
                    uint16_t *temperature_raw, float *temperature_s,
                    uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status);
 
+/**
+ * @brief      read the raw measurement frame
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *frame pointer to a STCC4_RAW_FRAME_SIZE bytes frame buffer
+ * @param[in]  check_crc check the crc now or defer it to stcc4_decode_raw_frame
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc is error
+ * @note       the wire frame is read straight into the frame buffer
+ */
+uint8_t stcc4_read_raw_frame(stcc4_handle_t *handle, uint8_t *frame, stcc4_bool_t check_crc);
+
+/**
+ * @brief      decode a raw measurement frame
+ * @param[in]  *frame pointer to a STCC4_RAW_FRAME_SIZE bytes frame buffer
+ * @param[in]  check_crc check the crc before decoding
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 frame is NULL
+ *             - 4 crc is error
+ * @note       the frame is left untouched, so it can be decoded from a ring buffer in place
+ */
+uint8_t stcc4_decode_raw_frame(uint8_t *frame, stcc4_bool_t check_crc, int16_t *co2_raw, int16_t *co2_ppm,
+                               uint16_t *temperature_raw, float *temperature_s,
+                               uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status);
+
+/**
+ * @brief      read data with integer math only
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_mdeg pointer to a temperature buffer in 0.001 degrees
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_mpercentage pointer to a humidity buffer in 0.001 %
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc is error
+ * @note       no float operation is used, the results are rounded to the nearest milli unit
+ */
+uint8_t stcc4_read_fixed(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
+                         uint16_t *temperature_raw, int32_t *temperature_mdeg,
+                         uint16_t *humidity_raw, int32_t *humidity_mpercentage, uint16_t *sensor_status);
+
+/**
+ * @brief      read data and keep the words with a good crc
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @param[out] *crc_error_mask pointer to a crc error mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc is error
+ * @note       when 4 is returned only the buffers of the words not set in the crc error mask are updated
+ */
+uint8_t stcc4_read_with_crc_mask(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
+                                 uint16_t *temperature_raw, float *temperature_s,
+                                 uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status,
+                                 uint8_t *crc_error_mask);
+
 /**
  * @brief     start continuous measurement
  * @param[in] *handle pointer to an stcc4 handle structure
@@ -271,7 +638,7 @@ uint8_t stcc4_read(stcc4_handle_t *handle, int16_t *co2_raw, int16_t *co2_ppm,
  *            - 1 start continuous measurement failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      sets the continuous measure state, the begin functions refuse to start while it runs
  */
 uint8_t stcc4_start_continuous_measurement(stcc4_handle_t *handle);
 
@@ -326,6 +693,142 @@ uint8_t stcc4_set_pressure_compensation(stcc4_handle_t *handle, uint16_t pressur
  */
 uint8_t stcc4_measure_single_shot(stcc4_handle_t *handle);
 
+/**
+ * @brief      begin a single shot measurement without waiting
+ * @param[in]  *handle pointer to an stcc4 handle structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *ready_ms pointer to a ready deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 measure single shot failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 measurement is running
+ * @note       the timestamp may be any free running ms counter and is allowed to wrap around,
+ *             call stcc4_measure_poll once the counter has reached the ready deadline
+ */
+uint8_t stcc4_measure_single_shot_begin(stcc4_handle_t *handle, uint32_t timestamp_ms, uint32_t *ready_ms);
+
+/**
+ * @brief      begin the continuous measurement without waiting
+ * @param[in]  *handle pointer to an stcc4 handle structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *ready_ms pointer to a ready deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start continuous measurement failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 measurement is running
+ * @note       the timestamp may be any free running ms counter and is allowed to wrap around
+ */
+uint8_t stcc4_start_continuous_measurement_begin(stcc4_handle_t *handle, uint32_t timestamp_ms, uint32_t *ready_ms);
+
+/**
+ * @brief      poll the running measurement
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  timestamp_ms current timestamp in ms
+ * @param[out] *ready_ms pointer to a next ready deadline buffer
+ * @param[out] *co2_raw pointer to a co2 raw buffer
+ * @param[out] *co2_ppm pointer to a co2 ppm buffer
+ * @param[out] *temperature_raw pointer to a temperature raw buffer
+ * @param[out] *temperature_s pointer to a temperature buffer
+ * @param[out] *humidity_raw pointer to a humidity raw buffer
+ * @param[out] *humidity_s pointer to a humidity buffer
+ * @param[out] *sensor_status pointer to a sensor status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 crc is error
+ *             - 5 no measurement is running
+ *             - 6 data is not ready
+ * @note       the data buffers are only written when 0 is returned,
+ *             a single shot returns the handle to the idle state after the read attempt,
+ *             a continuous measurement moves the deadline to the next sample
+ */
+uint8_t stcc4_measure_poll(stcc4_handle_t *handle, uint32_t timestamp_ms, uint32_t *ready_ms,
+                           int16_t *co2_raw, int16_t *co2_ppm,
+                           uint16_t *temperature_raw, float *temperature_s,
+                           uint16_t *humidity_raw, float *humidity_s, uint16_t *sensor_status);
+
+/**
+ * @brief      get the measure state
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *state pointer to a measure state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t stcc4_get_measure_state(stcc4_handle_t *handle, stcc4_measure_state_t *state);
+
+/**
+ * @brief     enable or disable the ready polling
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      when enabled, single shot, self test, forced recalibration and factory reset poll 
+ *            the sensor until it acks instead of waiting the worst case time
+ */
+uint8_t stcc4_set_ready_polling(stcc4_handle_t *handle, stcc4_bool_t enable);
+
+/**
+ * @brief      get the ready polling status
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t stcc4_get_ready_polling(stcc4_handle_t *handle, stcc4_bool_t *enable);
+
+/**
+ * @brief     set the ready polling back-off
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @param[in] lower_bound_percent first poll after this percent of the worst case time
+ * @param[in] first_step_ms first back-off step in ms, 0 means 1ms
+ * @param[in] max_step_ms max back-off step in ms, 0 means no limit
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 lower bound percent is over 100
+ * @note      the step doubles after every nack and the last poll is at the worst case time
+ */
+uint8_t stcc4_set_ready_polling_backoff(stcc4_handle_t *handle, uint8_t lower_bound_percent,
+                                        uint16_t first_step_ms, uint16_t max_step_ms);
+
+/**
+ * @brief      get the ready polling back-off
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *lower_bound_percent pointer to a lower bound percent buffer
+ * @param[out] *first_step_ms pointer to a first step buffer
+ * @param[out] *max_step_ms pointer to a max step buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t stcc4_get_ready_polling_backoff(stcc4_handle_t *handle, uint8_t *lower_bound_percent,
+                                        uint16_t *first_step_ms, uint16_t *max_step_ms);
+
+/**
+ * @brief      get the observed ready time of the last polled command
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *ms pointer to a time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the time is measured in delay_ms steps from the command write, 0 before the first polled command
+ */
+uint8_t stcc4_get_observed_ready_time(stcc4_handle_t *handle, uint32_t *ms);
+
 /**
  * @brief     enter sleep mode
  * @param[in] *handle pointer to an stcc4 handle structure
@@ -381,7 +884,7 @@ uint8_t stcc4_perform_soft_reset(stcc4_handle_t *handle);
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  *            - 4 not passed
- * @note      none
+ * @note      the response word is crc checked, a crc error is a failed factory reset
  */
 uint8_t stcc4_perform_factory_reset(stcc4_handle_t *handle);
 
@@ -531,6 +1034,32 @@ uint8_t stcc4_temperature_convert_to_register(stcc4_handle_t *handle, float deg,
  */
 uint8_t stcc4_temperature_convert_to_data(stcc4_handle_t *handle, uint16_t reg, float *deg);
 
+/**
+ * @brief      convert the register raw data to humidity in 0.001 %
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *mpercentage pointer to a 0.001 % buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only
+ */
+uint8_t stcc4_humidity_convert_to_fixed(stcc4_handle_t *handle, uint16_t reg, int32_t *mpercentage);
+
+/**
+ * @brief      convert the register raw data to temperature in 0.001 degrees
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *mdeg pointer to a 0.001 degrees buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only
+ */
+uint8_t stcc4_temperature_convert_to_fixed(stcc4_handle_t *handle, uint16_t reg, int32_t *mdeg);
+
 /**
  * @brief      convert the pressure to the register raw data
  * @param[in]  *handle pointer to a stcc4 handle structure
@@ -557,6 +1086,76 @@ uint8_t stcc4_pressure_convert_to_register(stcc4_handle_t *handle, float pa, uin
  */
 uint8_t stcc4_pressure_convert_to_data(stcc4_handle_t *handle, uint16_t reg, float *pa);
 
+/**
+ * @brief      convert a register raw array to frc co2 ppm
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *ppm pointer to a ppm array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       results are bit exact with stcc4_frc_co2_convert_to_data
+ */
+uint8_t stcc4_frc_co2_convert_to_data_batch(stcc4_handle_t *handle, const uint16_t *reg, float *ppm, uint32_t len);
+
+/**
+ * @brief      convert a register raw array to humidity
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *percentage pointer to a percentage array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       results are bit exact with stcc4_humidity_convert_to_data
+ */
+uint8_t stcc4_humidity_convert_to_data_batch(stcc4_handle_t *handle, const uint16_t *reg, float *percentage, uint32_t len);
+
+/**
+ * @brief      convert a register raw array to temperature
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *deg pointer to a degrees array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       results are bit exact with stcc4_temperature_convert_to_data
+ */
+uint8_t stcc4_temperature_convert_to_data_batch(stcc4_handle_t *handle, const uint16_t *reg, float *deg, uint32_t len);
+
+/**
+ * @brief      convert a register raw array to humidity in 0.01 %
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *centi_percentage pointer to a 0.01 % array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only, rounded to the nearest 0.01 %
+ */
+uint8_t stcc4_humidity_convert_to_fixed_batch(stcc4_handle_t *handle, const uint16_t *reg, int16_t *centi_percentage, uint32_t len);
+
+/**
+ * @brief      convert a register raw array to temperature in 0.01 degrees
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[in]  *reg pointer to a register raw array
+ * @param[out] *centi_deg pointer to a 0.01 degrees array
+ * @param[in]  len array length
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only, rounded to the nearest 0.01 degree
+ */
+uint8_t stcc4_temperature_convert_to_fixed_batch(stcc4_handle_t *handle, const uint16_t *reg, int16_t *centi_deg, uint32_t len);
+
 /**
  * @}
  */
@@ -579,7 +1178,7 @@ uint8_t stcc4_pressure_convert_to_data(stcc4_handle_t *handle, uint16_t reg, flo
  *            - 1 write failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      a plain write of the register and the data
  */
 uint8_t stcc4_set_reg(stcc4_handle_t *handle, uint16_t reg, uint8_t *buf, uint16_t len);
 
@@ -595,10 +1194,58 @@ uint8_t stcc4_set_reg(stcc4_handle_t *handle, uint16_t reg, uint8_t *buf, uint16
  *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       the plain write, delay_ms and read sequence, ready polling and the combined transfer are not used
  */
 uint8_t stcc4_get_reg(stcc4_handle_t *handle, uint16_t reg, uint8_t *buf, uint16_t len, uint16_t delay_ms);
 
+/**
+ * @brief      generate the crc8 of a data buffer
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len data buffer length
+ * @param[out] *crc pointer to a crc buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf is NULL
+ * @note       polynomial 0x31, init 0xFF, the backend is selected by STCC4_CRC8_BACKEND
+ */
+uint8_t stcc4_crc8(uint8_t *buf, uint16_t len, uint8_t *crc);
+
+/**
+ * @brief      check all crc words of a sensirion word frame
+ * @param[in]  *frame pointer to a frame buffer
+ * @param[in]  words number of 2 + 1 bytes words in the frame
+ * @param[out] *error_mask pointer to an error mask buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 frame is NULL
+ *             - 5 words is over 16
+ * @note       bit n of the error mask is set when word n has a crc error
+ */
+uint8_t stcc4_check_frame(uint8_t *frame, uint8_t words, uint16_t *error_mask);
+
+#if (STCC4_INSTRUMENTATION != 0)
+/**
+ * @brief      get a snapshot of the command stats
+ * @param[in]  *handle pointer to a stcc4 handle structure
+ * @param[out] *stats pointer to a stcc4 stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or stats is NULL
+ * @note       the stats are kept through stcc4_deinit and stcc4_init
+ */
+uint8_t stcc4_get_stats(stcc4_handle_t *handle, stcc4_stats_t *stats);
+
+/**
+ * @brief     clear the command stats
+ * @param[in] *handle pointer to a stcc4 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t stcc4_clear_stats(stcc4_handle_t *handle);
+#endif
+
 /**
  * @}
  */
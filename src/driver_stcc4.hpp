@@ -0,0 +1,905 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4.hpp
+ * @brief     driver stcc4 c++ header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_HPP
+#define DRIVER_STCC4_HPP
+
+#include "driver_stcc4.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#if defined(__has_include) && (__cplusplus > 201703L)
+#if __has_include(<span>)
+#include <span>
+#define STCC4_HPP_STD_SPAN
+#endif
+#endif
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#endif
+
+/**
+ * @defgroup stcc4_cpp_driver stcc4 c++ driver function
+ * @brief    stcc4 c++ driver modules
+ * @ingroup  stcc4_driver
+ * @{
+ */
+
+namespace stcc4
+{
+
+/**
+ * @brief stcc4 error enumeration definition
+ */
+enum class error : uint8_t
+{
+    bus        = 1,        /**< iic transfer failed */
+    not_inited = 3,        /**< sensor is not initialized */
+    crc        = 4,        /**< crc check failed */
+    not_passed = 5,        /**< self test or factory reset not passed */
+    invalid_id = 6,        /**< product id is invalid */
+    length     = 7,        /**< buffer length is invalid */
+};
+
+/**
+ * @brief stcc4 unexpected structure definition
+ * @note  builds a failed result like std::unexpected
+ */
+struct unexpected
+{
+    error value;        /**< error */
+};
+
+/**
+ * @brief stcc4 result class definition
+ * @note  a std::expected<T, error> subset that needs neither c++23 nor exceptions,
+ *        value() and operator* must only be used when has_value() is true
+ */
+template <class T>
+class result
+{
+  public:
+    constexpr result(const T &value) noexcept : m_value(value), m_error(error::bus), m_ok(true) {}
+    constexpr result(unexpected e) noexcept : m_value(), m_error(e.value), m_ok(false) {}
+    constexpr bool has_value() const noexcept { return m_ok; }
+    constexpr explicit operator bool() const noexcept { return m_ok; }
+    constexpr const T &value() const noexcept { return m_value; }
+    constexpr const T &operator*() const noexcept { return m_value; }
+    constexpr const T *operator->() const noexcept { return &m_value; }
+    constexpr T value_or(const T &other) const noexcept { return m_ok ? m_value : other; }
+    constexpr error error_code() const noexcept { return m_error; }
+    
+  private:
+    T m_value;            /**< value */
+    error m_error;        /**< error */
+    bool m_ok;            /**< has value flag */
+};
+
+/**
+ * @brief stcc4 void result class definition
+ */
+template <>
+class result<void>
+{
+  public:
+    constexpr result() noexcept : m_error(error::bus), m_ok(true) {}
+    constexpr result(unexpected e) noexcept : m_error(e.value), m_ok(false) {}
+    constexpr bool has_value() const noexcept { return m_ok; }
+    constexpr explicit operator bool() const noexcept { return m_ok; }
+    constexpr error error_code() const noexcept { return m_error; }
+    
+  private:
+    error m_error;        /**< error */
+    bool m_ok;            /**< has value flag */
+};
+
+#ifdef STCC4_HPP_STD_SPAN
+/**
+ * @brief stcc4 span definition
+ */
+template <class T>
+using span = std::span<T>;
+#else
+/**
+ * @brief stcc4 span class definition
+ * @note  the std::span subset used by the driver before c++20
+ */
+template <class T>
+class span
+{
+  public:
+    constexpr span() noexcept : m_data(nullptr), m_size(0) {}
+    constexpr span(T *data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+    template <std::size_t N>
+    constexpr span(T (&array)[N]) noexcept : m_data(array), m_size(N) {}
+    template <class C, class = std::enable_if_t<std::is_convertible<decltype(std::declval<C &>().data()), T *>::value>>
+    constexpr span(C &container) noexcept : m_data(container.data()), m_size(container.size()) {}
+    template <class U, class = std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>>
+    constexpr span(const span<U> &other) noexcept : m_data(other.data()), m_size(other.size()) {}
+    constexpr T *data() const noexcept { return m_data; }
+    constexpr std::size_t size() const noexcept { return m_size; }
+    constexpr bool empty() const noexcept { return m_size == 0; }
+    constexpr T &operator[](std::size_t i) const noexcept { return m_data[i]; }
+    constexpr T *begin() const noexcept { return m_data; }
+    constexpr T *end() const noexcept { return m_data + m_size; }
+    
+  private:
+    T *m_data;                /**< data */
+    std::size_t m_size;       /**< size */
+};
+#endif
+
+/**
+ * @brief stcc4 sample structure definition
+ */
+struct sample
+{
+    int16_t co2_raw;                /**< co2 raw */
+    int16_t co2_ppm;                /**< co2 ppm */
+    uint16_t temperature_raw;       /**< temperature raw */
+    float temperature;              /**< temperature in degrees */
+    uint16_t humidity_raw;          /**< humidity raw */
+    float humidity;                 /**< humidity in % */
+    uint16_t status;                /**< sensor status */
+};
+
+/**
+ * @brief stcc4 product id structure definition
+ */
+struct product_id
+{
+    uint32_t id;                            /**< product id */
+    std::array<uint8_t, 8> serial;          /**< unique serial number */
+};
+
+/**
+ * @brief stcc4 std delay policy structure definition
+ */
+struct std_delay
+{
+    /**
+     * @brief     delay ms
+     * @param[in] ms time
+     * @note      none
+     */
+    void delay_ms(uint32_t ms) const
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+};
+
+#if defined(__linux__)
+/**
+ * @brief stcc4 linux i2c-dev bus policy class definition
+ * @note  the addresses are the 8 bits driver addresses
+ */
+class linux_i2c_bus
+{
+  public:
+    /**
+     * @brief     linux i2c-dev bus constructor
+     * @param[in] *name pointer to an i2c-dev device name
+     * @note      the device is opened by init
+     */
+    explicit linux_i2c_bus(const char *name = "/dev/i2c-1") noexcept : m_name(name), m_fd(-1) {}
+    
+    /**
+     * @brief  open the bus
+     * @return status code
+     *         - 0 success
+     *         - 1 open failed
+     * @note   none
+     */
+    uint8_t init() noexcept
+    {
+        m_fd = ::open(m_name, O_RDWR);                        /* open the device */
+        
+        return (m_fd < 0) ? 1 : 0;                            /* return the result */
+    }
+    
+    /**
+     * @brief  close the bus
+     * @return status code
+     *         - 0 success
+     *         - 1 close failed
+     * @note   none
+     */
+    uint8_t deinit() noexcept
+    {
+        int fd = m_fd;
+        
+        m_fd = -1;                                            /* drop the handle */
+        
+        return (::close(fd) < 0) ? 1 : 0;                     /* close the device */
+    }
+    
+    /**
+     * @brief     write a command
+     * @param[in] addr iic device write address
+     * @param[in] *buf pointer to a data buffer
+     * @param[in] len length of the data buffer
+     * @return    status code
+     *            - 0 success
+     *            - 1 write failed
+     * @note      none
+     */
+    uint8_t write(uint8_t addr, uint8_t *buf, uint16_t len) noexcept
+    {
+        struct i2c_msg msg = {static_cast<__u16>(addr >> 1), 0, len, buf};
+        
+        return a_transfer(&msg, 1);                           /* transfer */
+    }
+    
+    /**
+     * @brief      read a response
+     * @param[in]  addr iic device write address
+     * @param[out] *buf pointer to a data buffer
+     * @param[in]  len length of the data buffer
+     * @return     status code
+     *             - 0 success
+     *             - 1 read failed
+     * @note       none
+     */
+    uint8_t read(uint8_t addr, uint8_t *buf, uint16_t len) noexcept
+    {
+        struct i2c_msg msg = {static_cast<__u16>(addr >> 1), I2C_M_RD, len, buf};
+        
+        return a_transfer(&msg, 1);                           /* transfer */
+    }
+    
+    /**
+     * @brief      write a command and read the response in one transfer
+     * @param[in]  addr iic device write address
+     * @param[in]  *wbuf pointer to a write buffer
+     * @param[in]  wlen length of the write buffer
+     * @param[out] *rbuf pointer to a read buffer
+     * @param[in]  rlen length of the read buffer
+     * @return     status code
+     *             - 0 success
+     *             - 1 transfer failed
+     * @note       none
+     */
+    uint8_t write_read(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen) noexcept
+    {
+        struct i2c_msg msgs[2] = {{static_cast<__u16>(addr >> 1), 0, wlen, wbuf},
+                                  {static_cast<__u16>(addr >> 1), I2C_M_RD, rlen, rbuf}};
+        
+        return a_transfer(msgs, 2);                           /* transfer */
+    }
+    
+  private:
+    uint8_t a_transfer(struct i2c_msg *msgs, uint32_t num) noexcept
+    {
+        struct i2c_rdwr_ioctl_data data = {msgs, num};
+        
+        return (::ioctl(m_fd, I2C_RDWR, &data) < 0) ? 1 : 0;  /* transmit */
+    }
+    
+    const char *m_name;        /**< device name */
+    int m_fd;                  /**< device handle */
+};
+#endif
+
+/**
+ * @brief stcc4 c++ driver class definition
+ * @note  BusPolicy provides uint8_t init(), uint8_t deinit(), uint8_t write(addr, buf, len),
+ *        uint8_t read(addr, buf, len) and uint8_t write_read(addr, wbuf, wlen, rbuf, rlen),
+ *        DelayPolicy provides void delay_ms(ms), all of them return 0 on success,
+ *        the policies are bound at compile time so the bus access inlines into every command,
+ *        the crc and frame decoding are the c driver functions
+ */
+template <class BusPolicy, class DelayPolicy = std_delay>
+class Stcc4
+{
+  public:
+    /**
+     * @brief     stcc4 constructor
+     * @param[in] address address pin
+     * @param[in] bus bus policy
+     * @param[in] delay delay policy
+     * @note      none
+     */
+    explicit Stcc4(stcc4_address_t address = STCC4_ADDRESS_0, BusPolicy bus = BusPolicy(),
+                   DelayPolicy delay = DelayPolicy())
+        : m_bus(std::move(bus)), m_delay(std::move(delay)), m_addr(static_cast<uint8_t>(address)), m_inited(false)
+    {
+    }
+    
+    /**
+     * @brief  get the bus policy
+     * @return bus policy reference
+     * @note   none
+     */
+    BusPolicy &bus() noexcept
+    {
+        return m_bus;
+    }
+    
+    /**
+     * @brief  initialize the chip
+     * @return result
+     * @note   soft reset the chip and check the product id
+     */
+    result<void> init()
+    {
+        result<product_id> id = unexpected{error::bus};
+        
+        if (m_bus.init() != 0)                                                     /* iic init */
+        {
+            return unexpected{error::bus};                                         /* return error */
+        }
+        (void)a_execute(STCC4_STATS_COMMAND_PERFORM_SOFT_RESET, 
+                        nullptr, nullptr, true);                                   /* perform soft reset */
+        id = a_get_product_id();                                                   /* get product id */
+        if ((!id) || (id->id != 0x0901018AU))                                      /* check product id */
+        {
+            (void)m_bus.deinit();                                                  /* iic deinit */
+            
+            return unexpected{id ? error::invalid_id : id.error_code()};           /* return error */
+        }
+        m_inited = true;                                                           /* flag finish initialization */
+        
+        return {};                                                                 /* success */
+    }
+    
+    /**
+     * @brief  close the chip
+     * @return result
+     * @note   the continuous measurement is stopped first
+     */
+    result<void> deinit()
+    {
+        result<void> res = a_command(STCC4_STATS_COMMAND_STOP_CONTINUOUS_MEASUREMENT, false);
+        
+        if (!res)                                                                  /* check result */
+        {
+            return res;                                                            /* return error */
+        }
+        if (m_bus.deinit() != 0)                                                   /* iic deinit */
+        {
+            return unexpected{error::bus};                                         /* return error */
+        }
+        m_inited = false;                                                          /* flag close initialization */
+        
+        return {};                                                                 /* success */
+    }
+    
+    /**
+     * @brief  start continuous measurement
+     * @return result
+     * @note   waits until the first sample is ready
+     */
+    result<void> start_continuous_measurement()
+    {
+        return a_command(STCC4_STATS_COMMAND_START_CONTINUOUS_MEASUREMENT, true);
+    }
+    
+    /**
+     * @brief  stop continuous measurement
+     * @return result
+     * @note   none
+     */
+    result<void> stop_continuous_measurement()
+    {
+        return a_command(STCC4_STATS_COMMAND_STOP_CONTINUOUS_MEASUREMENT, true);
+    }
+    
+    /**
+     * @brief  measure single shot
+     * @return result
+     * @note   waits until the sample is ready
+     */
+    result<void> measure_single_shot()
+    {
+        return a_command(STCC4_STATS_COMMAND_MEASURE_SINGLE_SHOT, true);
+    }
+    
+    /**
+     * @brief     send a command without waiting its execution time
+     * @param[in] index command index of a command without payload and response
+     * @return    execution time in ms
+     * @note      the caller waits the returned time itself, e.g. the coroutine wrapper
+     */
+    result<uint32_t> send(stcc4_stats_command_t index)
+    {
+        result<void> res;
+        
+        if ((a_command_table(index).param != 0) || 
+            (a_command_table(index).response != 0))                                /* check the command */
+        {
+            return unexpected{error::length};                                      /* return error */
+        }
+        res = a_command(index, false);                                             /* send the command */
+        if (!res)                                                                  /* check result */
+        {
+            return unexpected{res.error_code()};                                   /* return error */
+        }
+        
+        return static_cast<uint32_t>(a_command_table(index).time_ms);              /* return the time */
+    }
+    
+    /**
+     * @brief  read a sample
+     * @return sample result
+     * @note   none
+     */
+    result<sample> read()
+    {
+        uint8_t frame[STCC4_RAW_FRAME_SIZE];
+        sample s;
+        result<void> res = read_raw(frame);
+        
+        if (!res)                                                                  /* check result */
+        {
+            return unexpected{res.error_code()};                                   /* return error */
+        }
+        (void)stcc4_decode_raw_frame(frame, STCC4_BOOL_FALSE, &s.co2_raw, &s.co2_ppm,
+                                     &s.temperature_raw, &s.temperature,
+                                     &s.humidity_raw, &s.humidity, &s.status);     /* decode the frame */
+        
+        return s;                                                                  /* return the sample */
+    }
+    
+    /**
+     * @brief      read the raw measurement frame
+     * @param[out] frame frame buffer of at least STCC4_RAW_FRAME_SIZE bytes
+     * @return     result
+     * @note       all crc words are checked
+     */
+    result<void> read_raw(span<uint8_t> frame)
+    {
+        if (frame.size() < STCC4_RAW_FRAME_SIZE)                                   /* check the length */
+        {
+            return unexpected{error::length};                                      /* return error */
+        }
+        if (!m_inited)                                                             /* check initialization */
+        {
+            return unexpected{error::not_inited};                                  /* return error */
+        }
+        
+        return a_execute(STCC4_STATS_COMMAND_READ_MEASUREMENT, 
+                         nullptr, frame.data(), true);                             /* read the frame */
+    }
+    
+    /**
+     * @brief     set rht compensation
+     * @param[in] temperature_raw raw temperature
+     * @param[in] humidity_raw raw humidity
+     * @return    result
+     * @note      none
+     */
+    result<void> set_rht_compensation(uint16_t temperature_raw, uint16_t humidity_raw)
+    {
+        const uint16_t param[2] = {temperature_raw, humidity_raw};
+        
+        return a_command(STCC4_STATS_COMMAND_SET_RHT_COMPENSATION, true, param);
+    }
+    
+    /**
+     * @brief     set pressure compensation
+     * @param[in] pressure_raw raw pressure
+     * @return    result
+     * @note      none
+     */
+    result<void> set_pressure_compensation(uint16_t pressure_raw)
+    {
+        return a_command(STCC4_STATS_COMMAND_SET_PRESSURE_COMPENSATION, true, &pressure_raw);
+    }
+    
+    /**
+     * @brief  enter sleep mode
+     * @return result
+     * @note   none
+     */
+    result<void> enter_sleep_mode()
+    {
+        return a_command(STCC4_STATS_COMMAND_ENTER_SLEEP_MODE, true);
+    }
+    
+    /**
+     * @brief  exit sleep mode
+     * @return result
+     * @note   the sensor nacks the wake up byte
+     */
+    result<void> exit_sleep_mode()
+    {
+        return a_command(STCC4_STATS_COMMAND_EXIT_SLEEP_MODE, true);
+    }
+    
+    /**
+     * @brief  perform conditioning
+     * @return result
+     * @note   blocks for 22 s
+     */
+    result<void> perform_conditioning()
+    {
+        return a_command(STCC4_STATS_COMMAND_PERFORM_CONDITIONING, true);
+    }
+    
+    /**
+     * @brief  perform soft reset
+     * @return result
+     * @note   the reset is sent to the general call address
+     */
+    result<void> perform_soft_reset()
+    {
+        return a_command(STCC4_STATS_COMMAND_PERFORM_SOFT_RESET, true);
+    }
+    
+    /**
+     * @brief  perform factory reset
+     * @return result
+     * @note   none
+     */
+    result<void> perform_factory_reset()
+    {
+        uint8_t buf[3];
+        result<void> res = a_command(STCC4_STATS_COMMAND_PERFORM_FACTORY_RESET, true, nullptr, buf);
+        
+        if (!res)                                                                  /* check result */
+        {
+            return res;                                                            /* return error */
+        }
+        if ((buf[0] != 0) || (buf[1] != 0))                                        /* check the result */
+        {
+            return unexpected{error::not_passed};                                  /* return error */
+        }
+        
+        return {};                                                                 /* success */
+    }
+    
+    /**
+     * @brief  perform self test
+     * @return self test result word
+     * @note   0 means passed
+     */
+    result<uint16_t> perform_self_test()
+    {
+        return a_command_word(STCC4_STATS_COMMAND_PERFORM_SELF_TEST, nullptr);
+    }
+    
+    /**
+     * @brief  enable testing mode
+     * @return result
+     * @note   none
+     */
+    result<void> enable_testing_mode()
+    {
+        return a_command(STCC4_STATS_COMMAND_ENABLE_TESTING_MODE, true);
+    }
+    
+    /**
+     * @brief  disable testing mode
+     * @return result
+     * @note   none
+     */
+    result<void> disable_testing_mode()
+    {
+        return a_command(STCC4_STATS_COMMAND_DISABLE_TESTING_MODE, true);
+    }
+    
+    /**
+     * @brief     perform forced recalibration
+     * @param[in] target_co2 target co2 raw
+     * @return    correct co2 raw
+     * @note      none
+     */
+    result<uint16_t> perform_forced_recalibration(uint16_t target_co2)
+    {
+        return a_command_word(STCC4_STATS_COMMAND_PERFORM_FORCED_RECALIBRATION, &target_co2);
+    }
+    
+    /**
+     * @brief  get product id
+     * @return product id
+     * @note   none
+     */
+    result<product_id> get_product_id()
+    {
+        if (!m_inited)                                                             /* check initialization */
+        {
+            return unexpected{error::not_inited};                                  /* return error */
+        }
+        
+        return a_get_product_id();                                                 /* get product id */
+    }
+    
+    /**
+     * @brief     set the chip register
+     * @param[in] reg iic register address
+     * @param[in] data data buffer of at most 14 bytes
+     * @return    result
+     * @note      none
+     */
+    result<void> set_reg(uint16_t reg, span<const uint8_t> data)
+    {
+        uint8_t buf[16];
+        
+        if (!m_inited)                                                             /* check initialization */
+        {
+            return unexpected{error::not_inited};                                  /* return error */
+        }
+        if (data.size() > 14)                                                      /* check the length */
+        {
+            return unexpected{error::length};                                      /* return error */
+        }
+        buf[0] = static_cast<uint8_t>(reg >> 8);                                   /* set MSB of reg */
+        buf[1] = static_cast<uint8_t>(reg & 0xFF);                                 /* set LSB of reg */
+        std::copy(data.begin(), data.end(), buf + 2);                              /* copy write data */
+        if (m_bus.write(m_addr, buf, static_cast<uint16_t>(data.size() + 2)) != 0) /* write data */
+        {
+            return unexpected{error::bus};                                         /* return error */
+        }
+        
+        return {};                                                                 /* success */
+    }
+    
+    /**
+     * @brief      get the chip register
+     * @param[in]  reg iic register address
+     * @param[out] data data buffer
+     * @param[in]  delay_ms delay time in ms
+     * @return     result
+     * @note       none
+     */
+    result<void> get_reg(uint16_t reg, span<uint8_t> data, uint16_t delay_ms)
+    {
+        uint8_t buf[2] = {static_cast<uint8_t>(reg >> 8), static_cast<uint8_t>(reg & 0xFF)};
+        
+        if (!m_inited)                                                             /* check initialization */
+        {
+            return unexpected{error::not_inited};                                  /* return error */
+        }
+        if (m_bus.write(m_addr, buf, 2) != 0)                                      /* write command */
+        {
+            return unexpected{error::bus};                                         /* return error */
+        }
+        if (delay_ms != 0)                                                         /* check the delay */
+        {
+            m_delay.delay_ms(delay_ms);                                            /* delay ms */
+        }
+        if (m_bus.read(m_addr, data.data(), 
+                       static_cast<uint16_t>(data.size())) != 0)                   /* read data */
+        {
+            return unexpected{error::bus};                                         /* return error */
+        }
+        
+        return {};                                                                 /* success */
+    }
+    
+  private:
+    /**
+     * @brief command flag definition
+     */
+    static constexpr uint8_t FLAG_SHORT = 1 << 0;               /**< one byte opcode */
+    static constexpr uint8_t FLAG_GENERAL_CALL = 1 << 1;        /**< sent to the general call address */
+    static constexpr uint8_t FLAG_NACK = 1 << 2;                /**< the sensor nacks, the write result is ignored */
+    static constexpr uint8_t FLAG_CRC = 1 << 3;                 /**< check the crc of all response words */
+    
+    /**
+     * @brief command descriptor structure definition
+     */
+    struct command
+    {
+        uint16_t opcode;          /**< command opcode */
+        uint16_t time_ms;         /**< execution time in ms */
+        uint8_t param;            /**< payload words */
+        uint8_t response;         /**< response words */
+        uint8_t flags;            /**< command flags */
+    };
+    
+    /**
+     * @brief     get a command descriptor
+     * @param[in] index command index
+     * @return    command descriptor
+     * @note      mirrors the c driver table, indexed by stcc4_stats_command_t
+     */
+    static constexpr command a_command_table(stcc4_stats_command_t index) noexcept
+    {
+        constexpr command table[STCC4_STATS_COMMAND_OTHER] =
+        {
+            {0x218B, 1000, 0, 0, 0},                                                /* start continuous measurement */
+            {0x3F86, 1200, 0, 0, 0},                                                /* stop continuous measurement */
+            {0xEC05, 1, 0, 4, FLAG_CRC},                                            /* read measurement */
+            {0xE000, 1, 2, 0, 0},                                                   /* set rht compensation */
+            {0xE016, 1, 1, 0, 0},                                                   /* set pressure compensation */
+            {0x219D, 500, 0, 0, 0},                                                 /* measure single shot */
+            {0x3650, 1, 0, 0, 0},                                                   /* enter sleep mode */
+            {0x00, 5, 0, 0, FLAG_SHORT | FLAG_NACK},                                /* exit sleep mode */
+            {0x29BC, 22000, 0, 0, 0},                                               /* perform conditioning */
+            {0x06, 10, 0, 0, FLAG_SHORT | FLAG_GENERAL_CALL | FLAG_NACK},           /* perform soft reset */
+            {0x3632, 90, 0, 1, 0},                                                  /* perform factory reset */
+            {0x278C, 360, 0, 1, FLAG_CRC},                                          /* perform self test */
+            {0x3FBC, 0, 0, 0, 0},                                                   /* enable testing mode */
+            {0x3F3D, 0, 0, 0, 0},                                                   /* disable testing mode */
+            {0x362F, 90, 1, 1, FLAG_CRC},                                           /* perform forced recalibration */
+            {0x365B, 1, 0, 6, FLAG_CRC},                                            /* get product id */
+        };
+        
+        return table[index];
+    }
+    
+    /**
+     * @brief      execute a command
+     * @param[in]  index command index
+     * @param[in]  *param pointer to a payload words buffer
+     * @param[out] *response pointer to a response buffer of 3 bytes per word
+     * @param[in]  wait wait the execution time after a command without response
+     * @return     result
+     * @note       none
+     */
+    result<void> a_execute(stcc4_stats_command_t index, const uint16_t *param, uint8_t *response, bool wait)
+    {
+        const command cmd = a_command_table(index);
+        uint8_t buf[2 + 2 * 3];
+        uint16_t len = 0;
+        uint16_t rlen = static_cast<uint16_t>(cmd.response * 3);
+        uint16_t mask;
+        uint8_t i;
+        
+        if ((cmd.flags & FLAG_SHORT) == 0)                                         /* check the short opcode */
+        {
+            buf[len++] = static_cast<uint8_t>(cmd.opcode >> 8);                    /* set opcode MSB */
+        }
+        buf[len++] = static_cast<uint8_t>(cmd.opcode & 0xFF);                      /* set opcode LSB */
+        for (i = 0; i < cmd.param; i++)                                            /* encode the payload */
+        {
+            buf[len + 0] = static_cast<uint8_t>(param[i] >> 8);                    /* set word msb */
+            buf[len + 1] = static_cast<uint8_t>(param[i] & 0xFF);                  /* set word lsb */
+            (void)stcc4_crc8(buf + len, 2, buf + len + 2);                         /* set word crc */
+            len += 3;                                                              /* next word */
+        }
+        if ((rlen != 0) && (cmd.time_ms <= 1))                                     /* combined transfer */
+        {
+            if (m_bus.write_read(m_addr, buf, len, response, rlen) != 0)           /* write and read */
+            {
+                return unexpected{error::bus};                                     /* return error */
+            }
+        }
+        else
+        {
+            if ((m_bus.write(((cmd.flags & FLAG_GENERAL_CALL) != 0) ? 0x00 : m_addr, buf, len) != 0) &&
+                ((cmd.flags & FLAG_NACK) == 0))                                    /* write command */
+            {
+                return unexpected{error::bus};                                     /* return error */
+            }
+            if (((wait) || (rlen != 0)) && (cmd.time_ms != 0))                     /* check the time */
+            {
+                m_delay.delay_ms(cmd.time_ms);                                     /* delay ms */
+            }
+            if ((rlen != 0) && (m_bus.read(m_addr, response, rlen) != 0))          /* read the response */
+            {
+                return unexpected{error::bus};                                     /* return error */
+            }
+        }
+        if ((cmd.flags & FLAG_CRC) != 0)                                           /* check the crc flag */
+        {
+            (void)stcc4_check_frame(response, cmd.response, &mask);                /* check all crc */
+            if (mask != 0)                                                         /* check the mask */
+            {
+                return unexpected{error::crc};                                     /* return error */
+            }
+        }
+        
+        return {};                                                                 /* success */
+    }
+    
+    /**
+     * @brief      execute a command of an initialized chip
+     * @param[in]  index command index
+     * @param[in]  wait wait the execution time
+     * @param[in]  *param pointer to a payload words buffer
+     * @param[out] *response pointer to a response buffer
+     * @return     result
+     * @note       none
+     */
+    result<void> a_command(stcc4_stats_command_t index, bool wait,
+                           const uint16_t *param = nullptr, uint8_t *response = nullptr)
+    {
+        if (!m_inited)                                                             /* check initialization */
+        {
+            return unexpected{error::not_inited};                                  /* return error */
+        }
+        
+        return a_execute(index, param, response, wait);                            /* execute */
+    }
+    
+    /**
+     * @brief     execute a command with one response word
+     * @param[in] index command index
+     * @param[in] *param pointer to a payload words buffer
+     * @return    response word
+     * @note      none
+     */
+    result<uint16_t> a_command_word(stcc4_stats_command_t index, const uint16_t *param)
+    {
+        uint8_t buf[3];
+        result<void> res = a_command(index, true, param, buf);
+        
+        if (!res)                                                                  /* check result */
+        {
+            return unexpected{res.error_code()};                                   /* return error */
+        }
+        
+        return static_cast<uint16_t>((buf[0] << 8) | buf[1]);                      /* return the word */
+    }
+    
+    /**
+     * @brief  read the product id
+     * @return product id
+     * @note   none
+     */
+    result<product_id> a_get_product_id()
+    {
+        uint8_t buf[18];
+        product_id id;
+        result<void> res = a_execute(STCC4_STATS_COMMAND_GET_PRODUCT_ID, nullptr, buf, true);
+        
+        if (!res)                                                                  /* check result */
+        {
+            return unexpected{res.error_code()};                                   /* return error */
+        }
+        id.id = (static_cast<uint32_t>(buf[0]) << 24) | 
+                (static_cast<uint32_t>(buf[1]) << 16) |
+                (static_cast<uint32_t>(buf[3]) << 8) | 
+                (static_cast<uint32_t>(buf[4]) << 0);                              /* set product id */
+        id.serial = {buf[6], buf[7], buf[9], buf[10], 
+                     buf[12], buf[13], buf[15], buf[16]};                          /* set serial number */
+        
+        return id;                                                                 /* return the id */
+    }
+    
+    BusPolicy m_bus;            /**< bus policy */
+    DelayPolicy m_delay;        /**< delay policy */
+    uint8_t m_addr;             /**< iic device address */
+    bool m_inited;              /**< inited flag */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,456 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_coro.hpp
+ * @brief     driver stcc4 c++20 coroutine header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_CORO_HPP
+#define DRIVER_STCC4_CORO_HPP
+
+#include "driver_stcc4.hpp"
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <queue>
+#include <vector>
+
+/**
+ * @defgroup stcc4_coro_driver stcc4 coroutine driver function
+ * @brief    stcc4 c++20 coroutine driver modules
+ * @ingroup  stcc4_driver
+ * @{
+ */
+
+namespace stcc4
+{
+
+/**
+ * @brief stcc4 steady timer policy structure definition
+ * @note  a timer policy gives a wrapping ms clock and blocks the thread until the next deadline
+ */
+struct steady_timer
+{
+    /**
+     * @brief  get the time
+     * @return time in ms
+     * @note   none
+     */
+    uint32_t now_ms() const noexcept
+    {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    
+    /**
+     * @brief     block the thread
+     * @param[in] ms time
+     * @note      none
+     */
+    void sleep_for_ms(uint32_t ms) const noexcept
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+};
+
+/**
+ * @brief stcc4 task class definition
+ * @note  a lazily started coroutine, the owner keeps it alive until the executor returns
+ */
+class task
+{
+  public:
+    /**
+     * @brief stcc4 task promise structure definition
+     */
+    struct promise_type
+    {
+        task get_return_object() noexcept { return task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+    
+    task(task &&other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+    task(const task &) = delete;
+    task &operator=(const task &) = delete;
+    ~task() { if (m_handle) { m_handle.destroy(); } }
+    bool done() const noexcept { return m_handle.done(); }
+    std::coroutine_handle<> handle() const noexcept { return m_handle; }
+    
+  private:
+    explicit task(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) {}
+    
+    std::coroutine_handle<promise_type> m_handle;        /**< coroutine handle */
+};
+
+/**
+ * @brief stcc4 executor class definition
+ * @note  one thread runs every ready coroutine, then blocks once until the earliest
+ *        timer of the timer service instead of once per sensor
+ */
+template <class TimerPolicy = steady_timer>
+class executor
+{
+  public:
+    /**
+     * @brief     executor constructor
+     * @param[in] timer timer policy instance
+     * @note      none
+     */
+    explicit executor(TimerPolicy timer = TimerPolicy()) noexcept(std::is_nothrow_move_constructible<TimerPolicy>::value)
+        : m_timer(std::move(timer)), m_last(0), m_now(0), m_seq(0), m_resumes(0), m_sleeps(0)
+    {
+        m_last = m_timer.now_ms();
+    }
+    
+    /**
+     * @brief  get the time
+     * @return monotonic time in ms since the executor was created
+     * @note   extends the 32 bit timer policy clock to 64 bit
+     */
+    uint64_t now_ms() noexcept
+    {
+        uint32_t now = m_timer.now_ms();
+        
+        m_now += static_cast<uint32_t>(now - m_last);                              /* add the delta */
+        m_last = now;                                                              /* save the last */
+        
+        return m_now;                                                              /* return the time */
+    }
+    
+    /**
+     * @brief     start a task
+     * @param[in] &t task
+     * @note      the task runs at the next run()
+     */
+    void spawn(task &t)
+    {
+        post(t.handle());
+    }
+    
+    /**
+     * @brief     resume a coroutine at the next turn
+     * @param[in] h coroutine handle
+     * @note      none
+     */
+    void post(std::coroutine_handle<> h)
+    {
+        m_ready.push_back(h);
+    }
+    
+    /**
+     * @brief     resume a coroutine at a deadline
+     * @param[in] deadline_ms deadline on the now_ms() clock
+     * @param[in] h coroutine handle
+     * @note      timers with the same deadline resume in schedule order
+     */
+    void schedule_at(uint64_t deadline_ms, std::coroutine_handle<> h)
+    {
+        m_timers.push(timer{deadline_ms, m_seq++, h});
+    }
+    
+    /**
+     * @brief run until no coroutine is ready or waiting
+     * @note  none
+     */
+    void run()
+    {
+        uint64_t now;
+        
+        while ((!m_ready.empty()) || (!m_timers.empty()))                          /* run all */
+        {
+            while (!m_ready.empty())                                               /* resume the ready ones */
+            {
+                std::coroutine_handle<> h = m_ready.front();
+                
+                m_ready.pop_front();                                               /* pop */
+                m_resumes++;                                                       /* resumes++ */
+                h.resume();                                                        /* resume */
+            }
+            if (m_timers.empty())                                                  /* check the timers */
+            {
+                break;                                                             /* break */
+            }
+            now = now_ms();                                                        /* get the time */
+            if (now < m_timers.top().deadline)                                     /* check the earliest */
+            {
+                m_sleeps++;                                                        /* sleeps++ */
+                m_timer.sleep_for_ms(static_cast<uint32_t>(m_timers.top().deadline - now));
+                now = now_ms();                                                    /* get the time */
+            }
+            while ((!m_timers.empty()) && (m_timers.top().deadline <= now))        /* expire the timers */
+            {
+                m_ready.push_back(m_timers.top().h);                               /* ready */
+                m_timers.pop();                                                    /* pop */
+            }
+        }
+    }
+    
+    /**
+     * @brief  get the resume count
+     * @return coroutine resumes
+     * @note   none
+     */
+    uint64_t resumes() const noexcept
+    {
+        return m_resumes;
+    }
+    
+    /**
+     * @brief  get the sleep count
+     * @return times the thread blocked on the timer policy
+     * @note   none
+     */
+    uint64_t sleeps() const noexcept
+    {
+        return m_sleeps;
+    }
+    
+  private:
+    /**
+     * @brief timer entry structure definition
+     */
+    struct timer
+    {
+        uint64_t deadline;              /**< deadline in ms */
+        uint64_t seq;                   /**< schedule order */
+        std::coroutine_handle<> h;      /**< coroutine handle */
+    };
+    
+    /**
+     * @brief timer order structure definition
+     * @note  makes the priority queue a min heap
+     */
+    struct later
+    {
+        bool operator()(const timer &a, const timer &b) const noexcept
+        {
+            return (a.deadline != b.deadline) ? (a.deadline > b.deadline) : (a.seq > b.seq);
+        }
+    };
+    
+    TimerPolicy m_timer;                                                    /**< timer policy */
+    uint32_t m_last;                                                        /**< last timer policy time */
+    uint64_t m_now;                                                         /**< monotonic time */
+    uint64_t m_seq;                                                         /**< schedule counter */
+    uint64_t m_resumes;                                                     /**< resume counter */
+    uint64_t m_sleeps;                                                      /**< sleep counter */
+    std::deque<std::coroutine_handle<>> m_ready;                            /**< ready queue */
+    std::priority_queue<timer, std::vector<timer>, later> m_timers;         /**< timer service */
+};
+
+/**
+ * @brief stcc4 async sensor class definition
+ * @note  the commands are sent at once when an awaitable is created, the awaiting coroutine
+ *        is then parked on the executor timers for the execution time instead of a delay,
+ *        init() and the short commands stay on the blocking Stcc4 api
+ */
+template <class BusPolicy, class DelayPolicy = std_delay, class TimerPolicy = steady_timer>
+class async_sensor
+{
+  public:
+    /**
+     * @brief stcc4 wait awaitable class definition
+     * @note  resumes at the deadline with the command result
+     */
+    class wait_awaitable
+    {
+      public:
+        wait_awaitable(executor<TimerPolicy> &exec, uint64_t deadline, result<void> res) noexcept
+            : m_exec(exec), m_deadline(deadline), m_res(res) {}
+        bool await_ready() const noexcept { return (!m_res) || (m_exec.now_ms() >= m_deadline); }
+        void await_suspend(std::coroutine_handle<> h) { m_exec.schedule_at(m_deadline, h); }
+        result<void> await_resume() const noexcept { return m_res; }
+        
+      private:
+        executor<TimerPolicy> &m_exec;        /**< executor */
+        uint64_t m_deadline;                  /**< deadline in ms */
+        result<void> m_res;                   /**< command result */
+    };
+    
+    /**
+     * @brief stcc4 read awaitable class definition
+     * @note  resumes when the next sample is ready and reads it
+     */
+    class read_awaitable
+    {
+      public:
+        explicit read_awaitable(async_sensor &sensor) noexcept : m_sensor(sensor) {}
+        bool await_ready() const noexcept { return m_sensor.m_exec.now_ms() >= m_sensor.m_ready; }
+        void await_suspend(std::coroutine_handle<> h) { m_sensor.m_exec.schedule_at(m_sensor.m_ready, h); }
+        result<sample> await_resume() { return m_sensor.a_read(); }
+        
+      private:
+        async_sensor &m_sensor;        /**< sensor */
+    };
+    
+    /**
+     * @brief     async sensor constructor
+     * @param[in] &sensor initialized blocking sensor
+     * @param[in] &exec executor
+     * @note      none
+     */
+    async_sensor(Stcc4<BusPolicy, DelayPolicy> &sensor, executor<TimerPolicy> &exec) noexcept
+        : m_sensor(sensor), m_exec(exec), m_ready(0), m_continuous(false)
+    {
+    }
+    
+    /**
+     * @brief  get the blocking sensor
+     * @return reference to the sensor
+     * @note   none
+     */
+    Stcc4<BusPolicy, DelayPolicy> &sensor() noexcept
+    {
+        return m_sensor;
+    }
+    
+    /**
+     * @brief  start a single shot, co_await resumes after 500 ms
+     * @return awaitable of result<void>
+     * @note   none
+     */
+    wait_awaitable measure_single_shot()
+    {
+        m_continuous = false;
+        
+        return a_begin(STCC4_STATS_COMMAND_MEASURE_SINGLE_SHOT, true);
+    }
+    
+    /**
+     * @brief  start the continuous measurement, co_await resumes after 1000 ms
+     * @return awaitable of result<void>
+     * @note   every read() then waits for the next 1 s sample
+     */
+    wait_awaitable start_continuous_measurement()
+    {
+        wait_awaitable a = a_begin(STCC4_STATS_COMMAND_START_CONTINUOUS_MEASUREMENT, true);
+        
+        m_continuous = a.await_resume().has_value();
+        
+        return a;
+    }
+    
+    /**
+     * @brief  stop the continuous measurement, co_await resumes after 1200 ms
+     * @return awaitable of result<void>
+     * @note   none
+     */
+    wait_awaitable stop_continuous_measurement()
+    {
+        m_continuous = false;
+        
+        return a_begin(STCC4_STATS_COMMAND_STOP_CONTINUOUS_MEASUREMENT, false);
+    }
+    
+    /**
+     * @brief  perform the conditioning, co_await resumes after 22 s
+     * @return awaitable of result<void>
+     * @note   none
+     */
+    wait_awaitable perform_conditioning()
+    {
+        return a_begin(STCC4_STATS_COMMAND_PERFORM_CONDITIONING, false);
+    }
+    
+    /**
+     * @brief  read the next sample
+     * @return awaitable of result<sample>
+     * @note   suspends until the pending single shot or continuous sample is ready
+     */
+    read_awaitable read() noexcept
+    {
+        return read_awaitable(*this);
+    }
+    
+  private:
+    /**
+     * @brief     send a command
+     * @param[in] index command index
+     * @param[in] sample the command produces a sample
+     * @return    awaitable of the execution time
+     * @note      none
+     */
+    wait_awaitable a_begin(stcc4_stats_command_t index, bool sample)
+    {
+        result<uint32_t> time = m_sensor.send(index);
+        uint64_t now = m_exec.now_ms();
+        
+        if (!time)                                                                 /* check result */
+        {
+            return wait_awaitable(m_exec, now, unexpected{time.error_code()});     /* return error */
+        }
+        if (sample)                                                                /* check the sample */
+        {
+            m_ready = now + *time;                                                 /* set the ready time */
+        }
+        
+        return wait_awaitable(m_exec, now + *time, result<void>());                /* return the awaitable */
+    }
+    
+    /**
+     * @brief  read a ready sample
+     * @return sample
+     * @note   none
+     */
+    result<sample> a_read()
+    {
+        uint64_t now;
+        
+        if (m_continuous)                                                          /* check the continuous mode */
+        {
+            now = m_exec.now_ms();                                                 /* get the time */
+            m_ready += 1000;                                                       /* next sample */
+            if (m_ready <= now)                                                    /* check missed samples */
+            {
+                m_ready = now + 1000;                                              /* resync */
+            }
+        }
+        
+        return m_sensor.read();                                                    /* read */
+    }
+    
+    Stcc4<BusPolicy, DelayPolicy> &m_sensor;        /**< blocking sensor */
+    executor<TimerPolicy> &m_exec;                  /**< executor */
+    uint64_t m_ready;                               /**< next sample time in ms */
+    bool m_continuous;                              /**< continuous mode flag */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
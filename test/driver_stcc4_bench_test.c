@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_bench_test.c
+ * @brief     driver stcc4 bench test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_bench_test.h"
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define BENCH_TEST_DWT        1        /**< dwt cycle counter */
+#else
+#define BENCH_TEST_DWT        0        /**< no cycle counter */
+#include <time.h>
+#endif
+
+#if (BENCH_TEST_DWT != 0)
+
+/**
+ * @brief bench test dwt register definition
+ */
+#define BENCH_TEST_DEMCR             (*(volatile uint32_t *)0xE000EDFCU)        /**< debug exception and monitor control */
+#define BENCH_TEST_DWT_CTRL          (*(volatile uint32_t *)0xE0001000U)        /**< dwt control */
+#define BENCH_TEST_DWT_CYCCNT        (*(volatile uint32_t *)0xE0001004U)        /**< dwt cycle counter */
+
+extern uint32_t SystemCoreClock;                  /**< cmsis core clock in hz */
+static uint8_t gs_dwt_started = 0;                /**< dwt started flag */
+static uint32_t gs_dwt_last;                      /**< last cycle counter */
+static uint64_t gs_dwt_high;                      /**< extended cycle counter */
+
+/**
+ * @brief  start the dwt cycle counter
+ * @return cycle counter
+ * @note   none
+ */
+static uint32_t a_stcc4_bench_test_dwt(void)
+{
+    if (gs_dwt_started == 0)
+    {
+        BENCH_TEST_DEMCR |= (1U << 24);
+        BENCH_TEST_DWT_CYCCNT = 0;
+        BENCH_TEST_DWT_CTRL |= (1U << 0);
+        gs_dwt_last = 0;
+        gs_dwt_high = 0;
+        gs_dwt_started = 1;
+    }
+    
+    return BENCH_TEST_DWT_CYCCNT;
+}
+
+#endif
+
+/**
+ * @brief  get a monotonic wall clock timestamp in ns
+ * @return timestamp in ns
+ * @note   every benchmark times itself with it so the reported numbers are comparable,
+ *         the simulator timestamp is not used because it can run on a virtual clock,
+ *         the cortex-m cores extend the cycle counter, so call it at least once per wrap around
+ */
+uint64_t stcc4_bench_test_ns(void)
+{
+#if (BENCH_TEST_DWT != 0)
+    uint32_t now;
+    
+    now = a_stcc4_bench_test_dwt();
+    gs_dwt_high += (uint32_t)(now - gs_dwt_last);
+    gs_dwt_last = now;
+    
+    return (gs_dwt_high / SystemCoreClock) * 1000000000ULL +
+           (gs_dwt_high % SystemCoreClock) * 1000000000ULL / SystemCoreClock;
+#else
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief      get the cpu cycle counter
+ * @param[out] *cycles pointer to a cycles buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no cycle counter
+ * @note       the dwt cycle counter of the cortex-m3, m4 and m7 cores, started on the first call,
+ *             it wraps around, so only the difference of two close readings is meaningful
+ */
+uint8_t stcc4_bench_test_cycles(uint32_t *cycles)
+{
+#if (BENCH_TEST_DWT != 0)
+    *cycles = a_stcc4_bench_test_dwt();
+    
+    return 0;
+#else
+    *cycles = 0;
+    
+    return 1;
+#endif
+}
+
+/**
+ * @brief         get a pseudo random number
+ * @param[in,out] *seed pointer to a non zero seed
+ * @param[in]     range number range
+ * @return        number in [0, range)
+ * @note          xorshift32, every test keeps its own seed so its data repeats from run to run
+ */
+uint32_t stcc4_bench_test_random(uint32_t *seed, uint32_t range)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    
+    return *seed % range;
+}
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_bench_test.h
+ * @brief     driver stcc4 bench test header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_STCC4_BENCH_TEST_H
+#define DRIVER_STCC4_BENCH_TEST_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup stcc4_test_driver
+ * @{
+ */
+
+/**
+ * @brief  get a monotonic wall clock timestamp in ns
+ * @return timestamp in ns
+ * @note   every benchmark times itself with it so the reported numbers are comparable,
+ *         the simulator timestamp is not used because it can run on a virtual clock
+ */
+uint64_t stcc4_bench_test_ns(void);
+
+/**
+ * @brief      get the cpu cycle counter
+ * @param[out] *cycles pointer to a cycles buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no cycle counter
+ * @note       the dwt cycle counter of the cortex-m3, m4 and m7 cores, started on the first call,
+ *             it wraps around, so only the difference of two close readings is meaningful
+ */
+uint8_t stcc4_bench_test_cycles(uint32_t *cycles);
+
+/**
+ * @brief         get a pseudo random number
+ * @param[in,out] *seed pointer to a non zero seed
+ * @param[in]     range number range
+ * @return        number in [0, range)
+ * @note          xorshift32, every test keeps its own seed so its data repeats from run to run
+ */
+uint32_t stcc4_bench_test_random(uint32_t *seed, uint32_t range);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
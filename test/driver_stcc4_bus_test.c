@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_bus_test.c
+ * @brief     driver stcc4 bus test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_bus_test.h"
+#include "driver_stcc4_bench_test.h"
+#ifdef STCC4_SIMULATOR
+#include "driver_stcc4_interface_simulator.h"
+#endif
+
+static stcc4_handle_t gs_handle;          /**< stcc4 handle */
+static uint32_t gs_transfer;              /**< bus transfer counter */
+static uint32_t gs_delay_ms;              /**< delay counter */
+
+/**
+ * @brief     counting iic bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_stcc4_bus_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    gs_transfer++;
+    
+    return stcc4_interface_iic_write_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      counting iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_stcc4_bus_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    gs_transfer++;
+    
+    return stcc4_interface_iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      counting iic bus write and read command
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       none
+ */
+static uint8_t a_stcc4_bus_write_read_cmd(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    gs_transfer++;
+    
+    return stcc4_interface_iic_write_read_cmd(addr, wbuf, wlen, rbuf, rlen);
+}
+
+/**
+ * @brief     counting delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_stcc4_bus_delay_ms(uint32_t ms)
+{
+    gs_delay_ms += ms;
+    stcc4_interface_delay_ms(ms);
+}
+
+/**
+ * @brief     run the product id reads of one bus mode
+ * @param[in] *name pointer to a mode name buffer
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_stcc4_bus_run(const char *name, uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t product_id;
+    uint8_t unique_serial_number[8];
+    uint64_t start;
+    uint64_t stop;
+    double s;
+    
+    gs_transfer = 0;
+    gs_delay_ms = 0;
+    start = stcc4_bench_test_ns();
+    for (i = 0; i < times; i++)
+    {
+        res = stcc4_get_product_id(&gs_handle, &product_id, unique_serial_number);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: get product id failed.\n");
+            
+            return 1;
+        }
+    }
+    stop = stcc4_bench_test_ns();
+    s = (double)(stop - start) / 1e9;
+    stcc4_interface_debug_print("stcc4: %s %0.2f transfers per read.\n", name, (double)gs_transfer / (double)times);
+    stcc4_interface_debug_print("stcc4: %s %0.2fms delay per read.\n", name, (double)gs_delay_ms / (double)times);
+    stcc4_interface_debug_print("stcc4: %s %0.2fus per read.\n", name, s * 1e6 / (double)times);
+    
+    return 0;
+}
+
+/**
+ * @brief     bus test
+ * @param[in] address address pin
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      compares separate write and read transfers with one combined write read transfer
+ */
+uint8_t stcc4_bus_test(stcc4_address_t address, uint32_t times)
+{
+    uint8_t res;
+    stcc4_info_t info;
+    
+    /* link functions */
+    DRIVER_STCC4_LINK_INIT(&gs_handle, stcc4_handle_t);
+    DRIVER_STCC4_LINK_IIC_INIT(&gs_handle, stcc4_interface_iic_init);
+    DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle, stcc4_interface_iic_deinit);
+    DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle, a_stcc4_bus_write_cmd);
+    DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle, a_stcc4_bus_read_cmd);
+    DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, a_stcc4_bus_delay_ms);
+    DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle, stcc4_interface_debug_print);
+    
+    /* stcc4 info */
+    res = stcc4_info(&info);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        stcc4_interface_debug_print("stcc4: chip is %s.\n", info.chip_name);
+        stcc4_interface_debug_print("stcc4: manufacturer is %s.\n", info.manufacturer_name);
+        stcc4_interface_debug_print("stcc4: interface is %s.\n", info.interface);
+        stcc4_interface_debug_print("stcc4: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        stcc4_interface_debug_print("stcc4: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        stcc4_interface_debug_print("stcc4: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        stcc4_interface_debug_print("stcc4: max current is %0.2fmA.\n", info.max_current_ma);
+        stcc4_interface_debug_print("stcc4: max temperature is %0.1fC.\n", info.temperature_max);
+        stcc4_interface_debug_print("stcc4: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start bus test */
+    stcc4_interface_debug_print("stcc4: start bus test.\n");
+    
+    /* set address pin */
+    res = stcc4_set_address_pin(&gs_handle, address);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set address pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* stcc4 init */
+    res = stcc4_init(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* separate write and read test */
+    stcc4_interface_debug_print("stcc4: separate write and read test.\n");
+    res = a_stcc4_bus_run("separate", times);
+    if (res != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* combined write read test */
+    stcc4_interface_debug_print("stcc4: combined write read test.\n");
+    DRIVER_STCC4_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, a_stcc4_bus_write_read_cmd);
+#ifdef STCC4_SIMULATOR
+    {
+        uint32_t product_id;
+        uint8_t sn[8];
+        
+        /* a read inside the execution time must be not acknowledged */
+        if (stcc4_get_product_id(&gs_handle, &product_id, sn) == 0)
+        {
+            stcc4_interface_debug_print("stcc4: combined read is acknowledged while busy.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* the combined transfer needs a clock stretching part */
+        stcc4_interface_delay_ms(1);
+        (void)stcc4_simulator_set_clock_stretch(address, STCC4_BOOL_TRUE);
+    }
+#endif
+    res = a_stcc4_bus_run("combined", times);
+    if (res != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+#ifdef STCC4_SIMULATOR
+    (void)stcc4_simulator_set_clock_stretch(address, STCC4_BOOL_FALSE);
+#endif
+    
+    /* finish bus test */
+    stcc4_interface_debug_print("stcc4: finish bus test.\n");
+    (void)stcc4_deinit(&gs_handle);
+    
+    return 0;
+}
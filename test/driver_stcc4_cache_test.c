@@ -0,0 +1,411 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_cache_test.c
+ * @brief     driver stcc4 cache test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_cache_test.h"
+#if defined(__linux__)
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief cache test definition
+ */
+#define CACHE_TEST_BURST          10        /**< reads in one burst */
+#define CACHE_TEST_TTL_MS         3000      /**< cache ttl, longer than the sensor period */
+#define CACHE_TEST_THREADS        4         /**< concurrent callers */
+#define CACHE_TEST_SLOW_US        50000     /**< slowed down bus read */
+
+static stcc4_handle_t gs_handle;               /**< stcc4 handle */
+static stcc4_cache_t gs_cache;                 /**< stcc4 cache */
+static volatile uint32_t gs_bus_reads;         /**< bus read transactions */
+static volatile uint8_t gs_slow;               /**< slow bus flag */
+#if defined(__linux__)
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;        /**< cache mutex */
+static volatile uint8_t gs_interleave;                              /**< run a transaction before the next lock */
+#endif
+
+/**
+ * @brief     counting iic read command
+ * @param[in] addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      the bus read can be slowed down to keep a transaction in flight
+ */
+static uint8_t a_stcc4_cache_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    gs_bus_reads++;
+#if defined(__linux__)
+    if (gs_slow != 0)
+    {
+        (void)usleep(CACHE_TEST_SLOW_US);
+    }
+#endif
+    
+    return stcc4_interface_iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief     check the cache counters
+ * @param[in] hits expected hits
+ * @param[in] misses expected misses
+ * @param[in] coalesced expected coalesced reads
+ * @param[in] bus_reads expected bus reads
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_stcc4_cache_check(uint32_t hits, uint32_t misses, uint32_t coalesced, uint32_t bus_reads)
+{
+    stcc4_cache_stats_t stats;
+    
+    (void)stcc4_cache_get_stats(&gs_cache, &stats);
+    stcc4_interface_debug_print("stcc4: %d hits, %d misses, %d coalesced, %d bus reads.\n",
+                                stats.hits, stats.misses, stats.coalesced, gs_bus_reads);
+    if ((stats.hits != hits) || (stats.misses != misses) ||
+        (stats.coalesced != coalesced) || (gs_bus_reads != bus_reads))
+    {
+        stcc4_interface_debug_print("stcc4: cache counters check failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+#if defined(__linux__)
+
+/**
+ * @brief cache lock
+ * @note  an armed interleave lets another caller read and invalidate, or lets the frame expire,
+ *        after the locking caller has sampled the generation and before it gets the lock
+ */
+static void a_stcc4_cache_lock(void)
+{
+    uint8_t interleave;
+    int16_t co2_ppm;
+    float temperature;
+    float humidity;
+    
+    interleave = gs_interleave;
+    gs_interleave = 0;
+    if (interleave != 0)
+    {
+        (void)stcc4_cache_read(&gs_cache, &co2_ppm, &temperature, &humidity);
+        if (interleave == 1)
+        {
+            (void)stcc4_cache_invalidate(&gs_cache);
+            stcc4_interface_delay_ms(1000);
+        }
+        else
+        {
+            stcc4_interface_delay_ms(CACHE_TEST_TTL_MS);
+        }
+    }
+    (void)pthread_mutex_lock(&gs_mutex);
+}
+
+/**
+ * @brief     read with another caller interleaved before the lock
+ * @param[in] interleave 1 invalidates the frame, 2 lets it expire
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the waiting read must go to the bus instead of taking the other caller's frame
+ */
+static uint8_t a_stcc4_cache_interleave(uint8_t interleave)
+{
+    uint8_t res;
+    uint32_t bus_reads;
+    int16_t co2_ppm;
+    float temperature;
+    float humidity;
+    stcc4_cache_stats_t before;
+    stcc4_cache_stats_t after;
+    
+    /* drop the frame so the interleaved caller runs a bus transaction */
+    stcc4_interface_delay_ms(1000);
+    (void)stcc4_cache_invalidate(&gs_cache);
+    (void)stcc4_cache_get_stats(&gs_cache, &before);
+    bus_reads = gs_bus_reads;
+    gs_interleave = interleave;
+    res = stcc4_cache_read(&gs_cache, &co2_ppm, &temperature, &humidity);
+    (void)stcc4_cache_get_stats(&gs_cache, &after);
+    stcc4_interface_debug_print("stcc4: %d misses, %d coalesced, %d bus reads.\n",
+                                after.misses - before.misses, after.coalesced - before.coalesced,
+                                gs_bus_reads - bus_reads);
+    if ((res != 0) || (after.misses - before.misses != 2) ||
+        (after.coalesced != before.coalesced) || (gs_bus_reads - bus_reads != 2))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief cache unlock
+ * @note  none
+ */
+static void a_stcc4_cache_unlock(void)
+{
+    (void)pthread_mutex_unlock(&gs_mutex);
+}
+
+/**
+ * @brief     concurrent caller thread
+ * @param[in] *arg pointer to a result buffer
+ * @return    NULL
+ * @note      none
+ */
+static void *a_stcc4_cache_caller(void *arg)
+{
+    int16_t co2_ppm;
+    float temperature;
+    float humidity;
+    
+    *(uint8_t *)arg = stcc4_cache_read(&gs_cache, &co2_ppm, &temperature, &humidity);
+    
+    return NULL;
+}
+
+#endif
+
+/**
+ * @brief     cache test
+ * @param[in] address address pin
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the coalescing part needs linux
+ */
+uint8_t stcc4_cache_test(stcc4_address_t address)
+{
+    uint8_t res;
+    uint32_t i;
+    int16_t co2_ppm;
+    float temperature;
+    float humidity;
+    
+    /* link interface function */
+    DRIVER_STCC4_LINK_INIT(&gs_handle, stcc4_handle_t);
+    DRIVER_STCC4_LINK_IIC_INIT(&gs_handle, stcc4_interface_iic_init);
+    DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle, stcc4_interface_iic_deinit);
+    DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle, stcc4_interface_iic_write_cmd);
+    DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle, a_stcc4_cache_iic_read_cmd);
+    DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, stcc4_interface_delay_ms);
+    DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle, stcc4_interface_debug_print);
+    
+    /* start cache test */
+    stcc4_interface_debug_print("stcc4: start cache test.\n");
+    
+    /* set address pin */
+    res = stcc4_set_address_pin(&gs_handle, address);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set address pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* stcc4 init */
+    res = stcc4_init(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* start continuous measurement */
+    res = stcc4_start_continuous_measurement(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: start continuous measurement failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    stcc4_interface_delay_ms(1500);
+    
+    /* cache init */
+#if defined(__linux__)
+    res = stcc4_cache_init(&gs_cache, &gs_handle, CACHE_TEST_TTL_MS, stcc4_interface_timestamp_us,
+                           a_stcc4_cache_lock, a_stcc4_cache_unlock);
+#else
+    res = stcc4_cache_init(&gs_cache, &gs_handle, CACHE_TEST_TTL_MS, stcc4_interface_timestamp_us, NULL, NULL);
+#endif
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: cache init failed.\n");
+        (void)stcc4_stop_continuous_measurement(&gs_handle);
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_bus_reads = 0;
+    
+    /* burst */
+    stcc4_interface_debug_print("stcc4: burst read test.\n");
+    for (i = 0; i < CACHE_TEST_BURST; i++)
+    {
+        res = stcc4_cache_read(&gs_cache, &co2_ppm, &temperature, &humidity);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: cache read failed.\n");
+            (void)stcc4_stop_continuous_measurement(&gs_handle);
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: co2 is %02dppm.\n", co2_ppm);
+    if (a_stcc4_cache_check(CACHE_TEST_BURST - 1, 1, 0, 1) != 0)
+    {
+        (void)stcc4_stop_continuous_measurement(&gs_handle);
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* ttl */
+    stcc4_interface_debug_print("stcc4: ttl test.\n");
+    stcc4_interface_delay_ms(CACHE_TEST_TTL_MS);
+    res = stcc4_cache_read(&gs_cache, &co2_ppm, &temperature, &humidity);
+    if ((res != 0) || (a_stcc4_cache_check(CACHE_TEST_BURST - 1, 2, 0, 2) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: ttl check failed.\n");
+        (void)stcc4_stop_continuous_measurement(&gs_handle);
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* invalidate */
+    stcc4_interface_debug_print("stcc4: invalidate test.\n");
+    stcc4_interface_delay_ms(1000);
+    (void)stcc4_cache_invalidate(&gs_cache);
+    res = stcc4_cache_read(&gs_cache, &co2_ppm, &temperature, &humidity);
+    if ((res != 0) || (a_stcc4_cache_check(CACHE_TEST_BURST - 1, 3, 0, 3) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: invalidate check failed.\n");
+        (void)stcc4_stop_continuous_measurement(&gs_handle);
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+#if defined(__linux__)
+    {
+        pthread_t thread[CACHE_TEST_THREADS];
+        uint8_t result[CACHE_TEST_THREADS];
+        stcc4_cache_stats_t stats;
+        
+        /* concurrent callers share one slow transaction */
+        stcc4_interface_debug_print("stcc4: coalescing test.\n");
+        stcc4_interface_delay_ms(1000);
+        (void)stcc4_cache_invalidate(&gs_cache);
+        gs_slow = 1;
+        for (i = 0; i < CACHE_TEST_THREADS; i++)
+        {
+            if (pthread_create(&thread[i], NULL, a_stcc4_cache_caller, &result[i]) != 0)
+            {
+                stcc4_interface_debug_print("stcc4: create caller failed.\n");
+                gs_slow = 0;
+                while (i != 0)
+                {
+                    (void)pthread_join(thread[--i], NULL);
+                }
+                (void)stcc4_stop_continuous_measurement(&gs_handle);
+                (void)stcc4_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        res = 0;
+        for (i = 0; i < CACHE_TEST_THREADS; i++)
+        {
+            (void)pthread_join(thread[i], NULL);
+            res |= result[i];
+        }
+        gs_slow = 0;
+        (void)stcc4_cache_get_stats(&gs_cache, &stats);
+        stcc4_interface_debug_print("stcc4: %d callers, %d coalesced, %d bus reads.\n",
+                                    CACHE_TEST_THREADS, stats.coalesced, gs_bus_reads);
+        if ((res != 0) || (stats.misses != 4) || (gs_bus_reads != 4) ||
+            (stats.hits + stats.coalesced != CACHE_TEST_BURST - 1 + CACHE_TEST_THREADS - 1))
+        {
+            stcc4_interface_debug_print("stcc4: coalescing check failed.\n");
+            (void)stcc4_stop_continuous_measurement(&gs_handle);
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* a waiting caller never takes a dropped frame */
+    stcc4_interface_debug_print("stcc4: invalidate while waiting test.\n");
+    if (a_stcc4_cache_interleave(1) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: invalidate while waiting check failed.\n");
+        (void)stcc4_stop_continuous_measurement(&gs_handle);
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* a waiting caller never takes an expired frame */
+    stcc4_interface_debug_print("stcc4: expire while waiting test.\n");
+    if (a_stcc4_cache_interleave(2) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: expire while waiting check failed.\n");
+        (void)stcc4_stop_continuous_measurement(&gs_handle);
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+#endif
+    
+    /* finish cache test */
+    stcc4_interface_debug_print("stcc4: finish cache test.\n");
+    (void)stcc4_stop_continuous_measurement(&gs_handle);
+    (void)stcc4_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,319 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_codec_test.c
+ * @brief     driver stcc4 codec test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_codec_test.h"
+#include "driver_stcc4_bench_test.h"
+
+/**
+ * @brief codec test definition
+ */
+#define CODEC_TEST_SENSORS        4                                                    /**< sensor number */
+#define CODEC_TEST_SECONDS        32768                                                /**< samples per sensor */
+#define CODEC_TEST_RECORDS        (CODEC_TEST_SENSORS * CODEC_TEST_SECONDS)            /**< record number */
+#define CODEC_TEST_BLOCKS         (CODEC_TEST_RECORDS / STCC4_CODEC_BLOCK + CODEC_TEST_SENSORS)  /**< max blocks */
+#define CODEC_TEST_REPEAT         8                                                    /**< passes per timing */
+
+static stcc4_log_record_t gs_record[CODEC_TEST_RECORDS];                          /**< source records */
+static stcc4_log_record_t gs_decoded[STCC4_CODEC_BLOCK];                          /**< decoded block */
+static uint8_t gs_stream[CODEC_TEST_BLOCKS * STCC4_CODEC_BLOCK_MAX_SIZE];         /**< encoded stream */
+static uint32_t gs_stream_len;                                                    /**< encoded length */
+static uint32_t gs_offset[CODEC_TEST_BLOCKS];                                     /**< block index */
+static stcc4_codec_encoder_t gs_encoder;                                          /**< encoder */
+static uint32_t gs_seed;                                                          /**< random seed */
+
+/**
+ * @brief stream output
+ * @param[in] *buf pointer to a block
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_stcc4_codec_write(const uint8_t *buf, uint32_t len)
+{
+    if (gs_stream_len + len > sizeof(gs_stream))
+    {
+        return 1;
+    }
+    memcpy(&gs_stream[gs_stream_len], buf, len);
+    gs_stream_len += len;
+    
+    return 0;
+}
+
+/**
+ * @brief make a recorded like trace
+ * @note  1 Hz samples with slow drift, sensor noise, a few missed seconds and rare status runs
+ */
+static void a_stcc4_codec_make(void)
+{
+    uint32_t s;
+    uint32_t i;
+    uint32_t t;
+    int32_t co2;
+    int32_t temperature;
+    int32_t humidity;
+    uint8_t status;
+    stcc4_log_record_t *r;
+    
+    gs_seed = 0x12345678U;
+    for (s = 0; s < CODEC_TEST_SENSORS; s++)
+    {
+        t = 1760000000U;
+        co2 = 800 + (int32_t)stcc4_bench_test_random(&gs_seed, 400);
+        temperature = 0x6600 + (int32_t)stcc4_bench_test_random(&gs_seed, 0x400);
+        humidity = 0x7000 + (int32_t)stcc4_bench_test_random(&gs_seed, 0x1000);
+        status = 0;
+        for (i = 0; i < CODEC_TEST_SECONDS; i++)
+        {
+            r = &gs_record[s * CODEC_TEST_SECONDS + i];
+            t += (stcc4_bench_test_random(&gs_seed, 500) == 0) ? 1 + stcc4_bench_test_random(&gs_seed, 3) : 1;
+            co2 += (int32_t)stcc4_bench_test_random(&gs_seed, 7) - 3;
+            temperature += (int32_t)stcc4_bench_test_random(&gs_seed, 9) - 4 + ((i & 0x3FF) == 0 ? 16 : 0);
+            humidity += (int32_t)stcc4_bench_test_random(&gs_seed, 21) - 10;
+            if (stcc4_bench_test_random(&gs_seed, 5000) == 0)
+            {
+                status ^= STCC4_LOG_STATUS(0x4000U);
+            }
+            r->timestamp = t;
+            r->co2_raw = (int16_t)co2;
+            r->temperature_raw = (uint16_t)temperature;
+            r->humidity_raw = (uint16_t)humidity;
+            r->sensor_id = (uint8_t)s;
+            r->sensor_status = status;
+        }
+    }
+}
+
+/**
+ * @brief  encode the trace
+ * @return status code
+ *         - 0 success
+ *         - 1 encode failed
+ * @note   none
+ */
+static uint8_t a_stcc4_codec_encode_all(void)
+{
+    uint32_t i;
+    
+    gs_stream_len = 0;
+    if (stcc4_codec_encoder_init(&gs_encoder, a_stcc4_codec_write) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < CODEC_TEST_RECORDS; i++)
+    {
+        if (stcc4_codec_encode(&gs_encoder, &gs_record[i]) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return stcc4_codec_flush(&gs_encoder);
+}
+
+/**
+ * @brief  run one round
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_stcc4_codec_round(void)
+{
+    uint64_t start;
+    uint64_t encode_ns;
+    uint64_t decode_ns;
+    uint64_t raw;
+    uint32_t blocks;
+    uint32_t first;
+    uint32_t b;
+    uint32_t k;
+    uint32_t j;
+    uint16_t num;
+    
+    /* encode */
+    start = stcc4_bench_test_ns();
+    for (k = 0; k < CODEC_TEST_REPEAT; k++)
+    {
+        if (a_stcc4_codec_encode_all() != 0)
+        {
+            stcc4_interface_debug_print("stcc4: encode failed.\n");
+            
+            return 1;
+        }
+    }
+    encode_ns = stcc4_bench_test_ns() - start;
+    if (stcc4_codec_index(gs_stream, gs_stream_len, gs_offset, CODEC_TEST_BLOCKS, &blocks) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: index failed.\n");
+        
+        return 1;
+    }
+    
+    /* decode and check every block in order */
+    first = 0;
+    for (b = 0; b < blocks; b++)
+    {
+        if ((stcc4_codec_decode_block(&gs_stream[gs_offset[b]], gs_stream_len - gs_offset[b], gs_decoded, &num) != 0) ||
+            (first + num > CODEC_TEST_RECORDS) ||
+            (memcmp(gs_decoded, &gs_record[first], sizeof(stcc4_log_record_t) * num) != 0))
+        {
+            stcc4_interface_debug_print("stcc4: block %d check failed.\n", b);
+            
+            return 1;
+        }
+        first += num;
+    }
+    if (first != CODEC_TEST_RECORDS)
+    {
+        stcc4_interface_debug_print("stcc4: record number check failed.\n");
+        
+        return 1;
+    }
+    
+    /* seek */
+    for (k = 0; k < 64; k++)
+    {
+        b = stcc4_bench_test_random(&gs_seed, blocks);
+        first = 0;
+        for (j = 0; j < b; j++)
+        {
+            first += (uint32_t)gs_stream[gs_offset[j] + 2] | ((uint32_t)gs_stream[gs_offset[j] + 3] << 8);
+        }
+        if ((stcc4_codec_decode_block(&gs_stream[gs_offset[b]], gs_stream_len - gs_offset[b], gs_decoded, &num) != 0) ||
+            (memcmp(gs_decoded, &gs_record[first], sizeof(stcc4_log_record_t) * num) != 0))
+        {
+            stcc4_interface_debug_print("stcc4: seek block %d check failed.\n", b);
+            
+            return 1;
+        }
+    }
+    
+    /* decode timing */
+    start = stcc4_bench_test_ns();
+    for (k = 0; k < CODEC_TEST_REPEAT; k++)
+    {
+        for (b = 0; b < blocks; b++)
+        {
+            (void)stcc4_codec_decode_block(&gs_stream[gs_offset[b]], gs_stream_len - gs_offset[b], gs_decoded, &num);
+        }
+    }
+    decode_ns = stcc4_bench_test_ns() - start;
+    
+    /* output */
+    raw = (uint64_t)CODEC_TEST_RECORDS * sizeof(stcc4_log_record_t);
+    stcc4_interface_debug_print("stcc4: %d records in %d blocks, %d raw bytes, %d encoded bytes.\n",
+                                CODEC_TEST_RECORDS, blocks, (uint32_t)raw, gs_stream_len);
+    stcc4_interface_debug_print("stcc4: ratio %0.2f, %0.2f bytes/sample.\n",
+                                (double)raw / gs_stream_len, (double)gs_stream_len / CODEC_TEST_RECORDS);
+    stcc4_interface_debug_print("stcc4: encode %d MB/s, decode %d MB/s of raw records.\n",
+                                (uint32_t)(raw * CODEC_TEST_REPEAT * 1000ULL / (encode_ns + 1)),
+                                (uint32_t)(raw * CODEC_TEST_REPEAT * 1000ULL / (decode_ns + 1)));
+    
+    return 0;
+}
+
+/**
+ * @brief     codec test
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t stcc4_codec_test(uint32_t times)
+{
+    uint8_t buf[STCC4_CODEC_BLOCK_MAX_SIZE];
+    uint32_t i;
+    uint16_t num;
+    
+    /* start codec test */
+    stcc4_interface_debug_print("stcc4: start codec test.\n");
+    
+    /* worst case block */
+    stcc4_interface_debug_print("stcc4: worst case block test.\n");
+    gs_seed = 0x9E3779B9U;
+    for (i = 0; i < STCC4_CODEC_BLOCK; i++)
+    {
+        gs_record[i].timestamp = (i & 1) ? 0xFFFFFFF0U : 0x10U;
+        gs_record[i].co2_raw = (int16_t)((i & 1) ? 0x7FFF : -0x8000);
+        gs_record[i].temperature_raw = (uint16_t)((i & 1) ? 0xFFFF : 0x0000);
+        gs_record[i].humidity_raw = (uint16_t)stcc4_bench_test_random(&gs_seed, 0x10000);
+        gs_record[i].sensor_id = 7;
+        gs_record[i].sensor_status = (uint8_t)i;
+    }
+    gs_stream_len = 0;
+    (void)stcc4_codec_encoder_init(&gs_encoder, a_stcc4_codec_write);
+    for (i = 0; i < STCC4_CODEC_BLOCK; i++)
+    {
+        (void)stcc4_codec_encode(&gs_encoder, &gs_record[i]);
+    }
+    memcpy(buf, gs_stream, gs_stream_len);
+    if ((gs_encoder.blocks != 1) || (gs_stream_len > STCC4_CODEC_BLOCK_MAX_SIZE) ||
+        (stcc4_codec_decode_block(buf, gs_stream_len, gs_decoded, &num) != 0) || (num != STCC4_CODEC_BLOCK) ||
+        (memcmp(gs_decoded, gs_record, sizeof(stcc4_log_record_t) * STCC4_CODEC_BLOCK) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: worst case block check failed.\n");
+        
+        return 1;
+    }
+    if (stcc4_codec_decode_block(buf, gs_stream_len - 1, gs_decoded, &num) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: truncated block check failed.\n");
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: worst case block is %d bytes, limit is %d bytes.\n",
+                                gs_stream_len, STCC4_CODEC_BLOCK_MAX_SIZE);
+    
+    /* recorded like trace */
+    stcc4_interface_debug_print("stcc4: trace benchmark test.\n");
+    a_stcc4_codec_make();
+    for (i = 0; i < times; i++)
+    {
+        if (a_stcc4_codec_round() != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* finish codec test */
+    stcc4_interface_debug_print("stcc4: finish codec test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,380 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_convert_test.c
+ * @brief     driver stcc4 convert test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_convert_test.h"
+#include "driver_stcc4_bench_test.h"
+#include <string.h>
+
+static stcc4_handle_t gs_handle;        /**< stcc4 handle */
+static uint16_t gs_reg[65536];          /**< raw buffer */
+static float gs_batch[65536];           /**< batch output buffer */
+static int16_t gs_fixed[65536];         /**< fixed output buffer */
+
+/**
+ * @brief     print a benchmark result
+ * @param[in] *name pointer to a name buffer
+ * @param[in] start start timestamp in ns
+ * @param[in] stop stop timestamp in ns
+ * @param[in] samples converted samples
+ * @note      none
+ */
+static void a_stcc4_convert_print(const char *name, uint64_t start, uint64_t stop, double samples)
+{
+    double s;
+    
+    s = (double)(stop - start) / 1e9;
+    if (s > 0.0)
+    {
+        stcc4_interface_debug_print("stcc4: %s %0.2f Msamples per second.\n", name, samples / s / 1e6);
+    }
+    else
+    {
+        stcc4_interface_debug_print("stcc4: %s is too fast to measure.\n", name);
+    }
+}
+
+/**
+ * @brief     convert test
+ * @param[in] address address pin
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      each round converts all 65536 raw values
+ */
+uint8_t stcc4_convert_test(stcc4_address_t address, uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    int32_t m;
+    int32_t max_float_error;
+    int32_t max_exact_error;
+    float f;
+    float acc;
+    double exact;
+    double e;
+    uint64_t start;
+    uint64_t stop;
+    stcc4_info_t info;
+    
+    /* link functions */
+    DRIVER_STCC4_LINK_INIT(&gs_handle, stcc4_handle_t);
+    DRIVER_STCC4_LINK_IIC_INIT(&gs_handle, stcc4_interface_iic_init);
+    DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle, stcc4_interface_iic_deinit);
+    DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle, stcc4_interface_iic_write_cmd);
+    DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle, stcc4_interface_iic_read_cmd);
+    DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, stcc4_interface_delay_ms);
+    DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle, stcc4_interface_debug_print);
+    
+    /* stcc4 info */
+    res = stcc4_info(&info);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        stcc4_interface_debug_print("stcc4: chip is %s.\n", info.chip_name);
+        stcc4_interface_debug_print("stcc4: manufacturer is %s.\n", info.manufacturer_name);
+        stcc4_interface_debug_print("stcc4: interface is %s.\n", info.interface);
+        stcc4_interface_debug_print("stcc4: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        stcc4_interface_debug_print("stcc4: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        stcc4_interface_debug_print("stcc4: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        stcc4_interface_debug_print("stcc4: max current is %0.2fmA.\n", info.max_current_ma);
+        stcc4_interface_debug_print("stcc4: max temperature is %0.1fC.\n", info.temperature_max);
+        stcc4_interface_debug_print("stcc4: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start convert test */
+    stcc4_interface_debug_print("stcc4: start convert test.\n");
+    
+    /* set address pin */
+    res = stcc4_set_address_pin(&gs_handle, address);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set address pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* stcc4 init */
+    res = stcc4_init(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* all raw values */
+    for (i = 0; i < 65536; i++)
+    {
+        gs_reg[i] = (uint16_t)i;
+    }
+    
+    /* stcc4_temperature_convert_to_data_batch test */
+    stcc4_interface_debug_print("stcc4: stcc4_temperature_convert_to_data_batch test.\n");
+    res = stcc4_temperature_convert_to_data_batch(&gs_handle, gs_reg, gs_batch, 65536);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: temperature convert to data batch failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < 65536; i++)
+    {
+        (void)stcc4_temperature_convert_to_data(&gs_handle, gs_reg[i], &f);
+        if (memcmp(&f, &gs_batch[i], sizeof(float)) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: temperature of 0x%04X is not bit exact.\n", i);
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: check temperature batch ok.\n");
+    
+    /* stcc4_humidity_convert_to_data_batch test */
+    stcc4_interface_debug_print("stcc4: stcc4_humidity_convert_to_data_batch test.\n");
+    res = stcc4_humidity_convert_to_data_batch(&gs_handle, gs_reg, gs_batch, 65536);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: humidity convert to data batch failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < 65536; i++)
+    {
+        (void)stcc4_humidity_convert_to_data(&gs_handle, gs_reg[i], &f);
+        if (memcmp(&f, &gs_batch[i], sizeof(float)) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: humidity of 0x%04X is not bit exact.\n", i);
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: check humidity batch ok.\n");
+    
+    /* stcc4_frc_co2_convert_to_data_batch test */
+    stcc4_interface_debug_print("stcc4: stcc4_frc_co2_convert_to_data_batch test.\n");
+    res = stcc4_frc_co2_convert_to_data_batch(&gs_handle, gs_reg, gs_batch, 65536);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: frc co2 convert to data batch failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < 65536; i++)
+    {
+        (void)stcc4_frc_co2_convert_to_data(&gs_handle, gs_reg[i], &f);
+        if (memcmp(&f, &gs_batch[i], sizeof(float)) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: frc co2 of 0x%04X is not bit exact.\n", i);
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: check frc co2 batch ok.\n");
+    
+    /* stcc4_temperature_convert_to_fixed_batch test */
+    stcc4_interface_debug_print("stcc4: stcc4_temperature_convert_to_fixed_batch test.\n");
+    res = stcc4_temperature_convert_to_fixed_batch(&gs_handle, gs_reg, gs_fixed, 65536);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: temperature convert to fixed batch failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < 65536; i++)
+    {
+        (void)stcc4_temperature_convert_to_data(&gs_handle, gs_reg[i], &f);
+        f = f * 100.0f - (float)gs_fixed[i];
+        if ((f > 0.51f) || (f < -0.51f))
+        {
+            stcc4_interface_debug_print("stcc4: fixed temperature of 0x%04X is error.\n", i);
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: check fixed temperature batch ok.\n");
+    
+    /* stcc4_humidity_convert_to_fixed_batch test */
+    stcc4_interface_debug_print("stcc4: stcc4_humidity_convert_to_fixed_batch test.\n");
+    res = stcc4_humidity_convert_to_fixed_batch(&gs_handle, gs_reg, gs_fixed, 65536);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: humidity convert to fixed batch failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    for (i = 0; i < 65536; i++)
+    {
+        (void)stcc4_humidity_convert_to_data(&gs_handle, gs_reg[i], &f);
+        f = f * 100.0f - (float)gs_fixed[i];
+        if ((f > 0.51f) || (f < -0.51f))
+        {
+            stcc4_interface_debug_print("stcc4: fixed humidity of 0x%04X is error.\n", i);
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: check fixed humidity batch ok.\n");
+    
+    /* fixed and float accuracy */
+    stcc4_interface_debug_print("stcc4: fixed and float accuracy test.\n");
+    max_float_error = 0;
+    max_exact_error = 0;
+    for (i = 0; i < 65536; i++)
+    {
+        (void)stcc4_temperature_convert_to_data(&gs_handle, gs_reg[i], &f);
+        (void)stcc4_temperature_convert_to_fixed(&gs_handle, gs_reg[i], &m);
+        exact = (double)gs_reg[i] * 175000.0 / 65535.0 - 45000.0;
+        e = (double)f * 1000.0 - (double)m;
+        e = (e < 0.0) ? -e : e;
+        if ((int32_t)(e * 1000.0) > max_float_error)
+        {
+            max_float_error = (int32_t)(e * 1000.0);
+        }
+        e = exact - (double)m;
+        e = (e < 0.0) ? -e : e;
+        if ((int32_t)(e * 1000.0) > max_exact_error)
+        {
+            max_exact_error = (int32_t)(e * 1000.0);
+        }
+    }
+    stcc4_interface_debug_print("stcc4: temperature fixed vs float max error is %d udeg.\n", max_float_error);
+    stcc4_interface_debug_print("stcc4: temperature fixed vs exact max error is %d udeg.\n", max_exact_error);
+    if (max_exact_error > 500)
+    {
+        stcc4_interface_debug_print("stcc4: fixed temperature is not rounded.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    max_float_error = 0;
+    max_exact_error = 0;
+    for (i = 0; i < 65536; i++)
+    {
+        (void)stcc4_humidity_convert_to_data(&gs_handle, gs_reg[i], &f);
+        (void)stcc4_humidity_convert_to_fixed(&gs_handle, gs_reg[i], &m);
+        exact = (double)gs_reg[i] * 125000.0 / 65535.0 - 6000.0;
+        e = (double)f * 1000.0 - (double)m;
+        e = (e < 0.0) ? -e : e;
+        if ((int32_t)(e * 1000.0) > max_float_error)
+        {
+            max_float_error = (int32_t)(e * 1000.0);
+        }
+        e = exact - (double)m;
+        e = (e < 0.0) ? -e : e;
+        if ((int32_t)(e * 1000.0) > max_exact_error)
+        {
+            max_exact_error = (int32_t)(e * 1000.0);
+        }
+    }
+    stcc4_interface_debug_print("stcc4: humidity fixed vs float max error is %d u%%.\n", max_float_error);
+    stcc4_interface_debug_print("stcc4: humidity fixed vs exact max error is %d u%%.\n", max_exact_error);
+    if (max_exact_error > 500)
+    {
+        stcc4_interface_debug_print("stcc4: fixed humidity is not rounded.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: check fixed accuracy ok.\n");
+    
+    /* benchmark */
+    stcc4_interface_debug_print("stcc4: benchmark test.\n");
+    acc = 0.0f;
+    start = stcc4_bench_test_ns();
+    for (j = 0; j < times; j++)
+    {
+        for (i = 0; i < 65536; i++)
+        {
+            (void)stcc4_temperature_convert_to_data(&gs_handle, gs_reg[i], &gs_batch[i]);
+        }
+        acc += gs_batch[j & 0xFFFFU];
+    }
+    stop = stcc4_bench_test_ns();
+    a_stcc4_convert_print("scalar temperature", start, stop, (double)times * 65536.0);
+    start = stcc4_bench_test_ns();
+    for (j = 0; j < times; j++)
+    {
+        (void)stcc4_temperature_convert_to_data_batch(&gs_handle, gs_reg, gs_batch, 65536);
+        acc += gs_batch[j & 0xFFFFU];
+    }
+    stop = stcc4_bench_test_ns();
+    a_stcc4_convert_print("batch temperature", start, stop, (double)times * 65536.0);
+    start = stcc4_bench_test_ns();
+    for (j = 0; j < times; j++)
+    {
+        (void)stcc4_temperature_convert_to_fixed_batch(&gs_handle, gs_reg, gs_fixed, 65536);
+        acc += (float)gs_fixed[j & 0xFFFFU];
+    }
+    stop = stcc4_bench_test_ns();
+    a_stcc4_convert_print("fixed temperature", start, stop, (double)times * 65536.0);
+    start = stcc4_bench_test_ns();
+    for (j = 0; j < times; j++)
+    {
+        for (i = 0; i < 65536; i++)
+        {
+            (void)stcc4_temperature_convert_to_fixed(&gs_handle, gs_reg[i], &m);
+            gs_fixed[i] = (int16_t)m;
+        }
+        acc += (float)gs_fixed[j & 0xFFFFU];
+    }
+    stop = stcc4_bench_test_ns();
+    a_stcc4_convert_print("scalar milli temperature", start, stop, (double)times * 65536.0);
+    stcc4_interface_debug_print("stcc4: checksum %0.1f.\n", acc);
+    
+    /* finish convert test */
+    stcc4_interface_debug_print("stcc4: finish convert test.\n");
+    (void)stcc4_deinit(&gs_handle);
+    
+    return 0;
+}
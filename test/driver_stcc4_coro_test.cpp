@@ -0,0 +1,565 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_coro_test.cpp
+ * @brief     driver stcc4 coro test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_coro_test.h"
+#include "driver_stcc4_coro.hpp"
+#include "driver_stcc4_interface.hpp"
+#ifdef STCC4_SIMULATOR
+#include "driver_stcc4_interface_simulator.h"
+#endif
+#include <cstdio>
+#include <memory>
+#include <sys/resource.h>
+
+/**
+ * @brief coro test definition
+ */
+#define CORO_TEST_SENSORS        4096        /**< coroutine sensors of the benchmark */
+#define CORO_TEST_THREADS        64          /**< thread per sensor baseline sensors */
+
+/**
+ * @brief coro test sensor type definition
+ */
+using stcc4_coro_sim_sensor_t = stcc4::async_sensor<stcc4::interface_bus, stcc4::interface_delay, stcc4::interface_timer>;
+
+static stcc4_handle_t gs_handle[CORO_TEST_THREADS];        /**< baseline stcc4 handles */
+static uint8_t gs_frame[STCC4_RAW_FRAME_SIZE];             /**< loopback measurement frame */
+static uint8_t gs_id[18];                                  /**< loopback product id frame */
+
+/**
+ * @brief     put a word with crc
+ * @param[in] *buf pointer to a 3 bytes buffer
+ * @param[in] word data word
+ * @note      none
+ */
+static void a_stcc4_coro_put_word(uint8_t *buf, uint16_t word)
+{
+    buf[0] = static_cast<uint8_t>(word >> 8);
+    buf[1] = static_cast<uint8_t>(word & 0xFF);
+    (void)stcc4_crc8(buf, 2, buf + 2);
+}
+
+/**
+ * @brief      loopback write and read
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write buffer
+ * @param[in]  wlen length of the write buffer
+ * @param[out] *rbuf pointer to a read buffer
+ * @param[in]  rlen length of the read buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transfer failed
+ * @note       answers the product id and measurement commands
+ */
+static uint8_t a_stcc4_coro_loopback_write_read(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    (void)addr;
+    if ((wlen == 2) && (wbuf[0] == 0x36) && (wbuf[1] == 0x5B) && (rlen == sizeof(gs_id)))
+    {
+        memcpy(rbuf, gs_id, sizeof(gs_id));
+        
+        return 0;
+    }
+    if ((wlen == 2) && (wbuf[0] == 0xEC) && (wbuf[1] == 0x05) && (rlen == sizeof(gs_frame)))
+    {
+        memcpy(rbuf, gs_frame, sizeof(gs_frame));
+        
+        return 0;
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     loopback write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      every command is accepted
+ */
+static uint8_t a_stcc4_coro_loopback_write(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    (void)len;
+    
+    return 0;
+}
+
+/**
+ * @brief      loopback read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 1 read failed
+ * @note       all responses are served by the combined transfer
+ */
+static uint8_t a_stcc4_coro_loopback_read(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    (void)len;
+    
+    return 1;
+}
+
+/**
+ * @brief  loopback init and deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_stcc4_coro_loopback_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     loopback delay
+ * @param[in] ms time
+ * @note      blocks the calling thread like a real delay
+ */
+static void a_stcc4_coro_loopback_delay_ms(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+/**
+ * @brief stcc4 coro loopback bus policy structure definition
+ */
+struct stcc4_coro_loopback_bus
+{
+    uint8_t init() noexcept { return a_stcc4_coro_loopback_init(); }
+    uint8_t deinit() noexcept { return a_stcc4_coro_loopback_init(); }
+    uint8_t write(uint8_t addr, uint8_t *buf, uint16_t len) noexcept { return a_stcc4_coro_loopback_write(addr, buf, len); }
+    uint8_t read(uint8_t addr, uint8_t *buf, uint16_t len) noexcept { return a_stcc4_coro_loopback_read(addr, buf, len); }
+    uint8_t write_read(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen) noexcept
+    {
+        return a_stcc4_coro_loopback_write_read(addr, wbuf, wlen, rbuf, rlen);
+    }
+};
+
+/**
+ * @brief stcc4 coro loopback delay policy structure definition
+ * @note  only init() of the coroutine sensors delays, it is skipped so that thousands of sensors start at once
+ */
+struct stcc4_coro_loopback_delay
+{
+    void delay_ms(uint32_t ms) const noexcept { (void)ms; }
+};
+
+/**
+ * @brief stcc4 coro loopback sensor type definition
+ */
+using stcc4_coro_loopback_sensor_t = stcc4::async_sensor<stcc4_coro_loopback_bus, stcc4_coro_loopback_delay>;
+
+/**
+ * @brief  get the thread count of the process
+ * @return thread count, 0 when it is unknown
+ * @note   none
+ */
+static uint32_t a_stcc4_coro_threads(void)
+{
+    char line[64];
+    uint32_t threads = 0;
+    FILE *fp = fopen("/proc/self/status", "r");
+    
+    if (fp == nullptr)
+    {
+        return 0;
+    }
+    while (fgets(line, sizeof(line), fp) != nullptr)
+    {
+        if (sscanf(line, "Threads: %u", &threads) == 1)
+        {
+            break;
+        }
+    }
+    (void)fclose(fp);
+    
+    return threads;
+}
+
+/**
+ * @brief  get the context switches of the process
+ * @return voluntary and involuntary context switches
+ * @note   none
+ */
+static uint64_t a_stcc4_coro_switches(void)
+{
+    struct rusage usage;
+    
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+    
+    return static_cast<uint64_t>(usage.ru_nvcsw) + static_cast<uint64_t>(usage.ru_nivcsw);
+}
+
+/**
+ * @brief  get a monotonic timestamp in ms
+ * @return timestamp in ms
+ * @note   none
+ */
+static uint64_t a_stcc4_coro_ms(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief      co_await the conversions on the linked interface
+ * @param[in]  &sensor async sensor
+ * @param[in]  &exec executor
+ * @param[out] &res test result
+ * @return     task
+ * @note       none
+ */
+static stcc4::task a_stcc4_coro_interface(stcc4_coro_sim_sensor_t &sensor,
+                                          stcc4::executor<stcc4::interface_timer> &exec, uint8_t &res)
+{
+    stcc4::result<stcc4::sample> sample = stcc4::unexpected{stcc4::error::bus};
+    uint64_t start;
+    uint64_t last;
+    uint32_t i;
+    
+    /* single shot */
+    stcc4_interface_debug_print("stcc4: co_await measure single shot.\n");
+    start = exec.now_ms();
+    if (!(co_await sensor.measure_single_shot()))
+    {
+        stcc4_interface_debug_print("stcc4: measure single shot failed.\n");
+        
+        co_return;
+    }
+    sample = co_await sensor.read();
+    if ((!sample) || (exec.now_ms() - start < 500))
+    {
+        stcc4_interface_debug_print("stcc4: read failed.\n");
+        
+        co_return;
+    }
+    stcc4_interface_debug_print("stcc4: %dms co2 is %dppm, temperature is %0.2fC, humidity is %0.2f%%.\n",
+                                static_cast<uint32_t>(exec.now_ms() - start), sample->co2_ppm,
+                                sample->temperature, sample->humidity);
+    
+    /* continuous measurement */
+    stcc4_interface_debug_print("stcc4: co_await start continuous measurement.\n");
+    if (!(co_await sensor.start_continuous_measurement()))
+    {
+        stcc4_interface_debug_print("stcc4: start continuous measurement failed.\n");
+        
+        co_return;
+    }
+    last = exec.now_ms();
+    for (i = 0; i < 3; i++)
+    {
+        sample = co_await sensor.read();
+        if ((!sample) || ((i != 0) && (exec.now_ms() - last < 1000)))
+        {
+            stcc4_interface_debug_print("stcc4: read failed.\n");
+            
+            co_return;
+        }
+        last = exec.now_ms();
+        stcc4_interface_debug_print("stcc4: %dms co2 is %dppm, temperature is %0.2fC, humidity is %0.2f%%.\n",
+                                    static_cast<uint32_t>(last - start), sample->co2_ppm,
+                                    sample->temperature, sample->humidity);
+    }
+    if (!(co_await sensor.stop_continuous_measurement()))
+    {
+        stcc4_interface_debug_print("stcc4: stop continuous measurement failed.\n");
+        
+        co_return;
+    }
+    
+    /* conditioning */
+    stcc4_interface_debug_print("stcc4: co_await perform conditioning.\n");
+    last = exec.now_ms();
+    if ((!(co_await sensor.perform_conditioning())) || (exec.now_ms() - last < 22000))
+    {
+        stcc4_interface_debug_print("stcc4: perform conditioning failed.\n");
+        
+        co_return;
+    }
+    stcc4_interface_debug_print("stcc4: conditioning resumed after %dms.\n", static_cast<uint32_t>(exec.now_ms() - last));
+    res = 0;
+}
+
+/**
+ * @brief      measure a loopback sensor
+ * @param[in]  &sensor async sensor
+ * @param[in]  times measurement rounds
+ * @param[out] &failed failed reads
+ * @return     task
+ * @note       none
+ */
+static stcc4::task a_stcc4_coro_loopback(stcc4_coro_loopback_sensor_t &sensor, uint32_t times, uint32_t &failed)
+{
+    stcc4::result<stcc4::sample> sample = stcc4::unexpected{stcc4::error::bus};
+    uint32_t i;
+    
+    for (i = 0; i < times; i++)
+    {
+        if (!(co_await sensor.measure_single_shot()))
+        {
+            failed++;
+            
+            continue;
+        }
+        sample = co_await sensor.read();
+        if ((!sample) || (sample->co2_raw != 812))
+        {
+            failed++;
+        }
+    }
+}
+
+/**
+ * @brief      measure a loopback c handle on its own thread
+ * @param[in]  *handle pointer to an stcc4 handle
+ * @param[in]  times measurement rounds
+ * @param[out] *failed pointer to a failed flag
+ * @note       none
+ */
+static void a_stcc4_coro_thread(stcc4_handle_t *handle, uint32_t times, uint8_t *failed)
+{
+    int16_t co2_raw;
+    int16_t co2_ppm;
+    uint16_t temperature_raw;
+    float temperature_s;
+    uint16_t humidity_raw;
+    float humidity_s;
+    uint16_t sensor_status;
+    uint32_t i;
+    
+    for (i = 0; i < times; i++)
+    {
+        if ((stcc4_measure_single_shot(handle) != 0) ||
+            (stcc4_read(handle, &co2_raw, &co2_ppm, &temperature_raw, &temperature_s,
+                        &humidity_raw, &humidity_s, &sensor_status) != 0) || (co2_raw != 812))
+        {
+            *failed = 1;
+        }
+    }
+}
+
+/**
+ * @brief     coroutine test
+ * @param[in] address address pin
+ * @param[in] times measurement rounds of the benchmark
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+extern "C" uint8_t stcc4_coro_test(stcc4_address_t address, uint32_t times)
+{
+    uint8_t res;
+    uint8_t failed[CORO_TEST_THREADS];
+    uint32_t threads;
+    uint32_t errors;
+    uint64_t switches;
+    uint64_t start;
+    uint32_t i;
+    
+    /* start coro test */
+    stcc4_interface_debug_print("stcc4: start coro test.\n");
+    stcc4_interface_debug_print("stcc4: coroutine sensor is %d bytes.\n", static_cast<uint32_t>(sizeof(stcc4_coro_sim_sensor_t)));
+#ifdef STCC4_SIMULATOR
+    
+    /* the combined transfer needs a clock stretching part */
+    (void)stcc4_simulator_set_clock_stretch(address, STCC4_BOOL_TRUE);
+#endif
+    
+    /* co_await on the linked interface */
+    {
+        stcc4::Stcc4<stcc4::interface_bus, stcc4::interface_delay> sensor(address);
+        stcc4::executor<stcc4::interface_timer> exec;
+        stcc4_coro_sim_sensor_t coro(sensor, exec);
+        
+        if (!sensor.init())
+        {
+            stcc4_interface_debug_print("stcc4: init failed.\n");
+            
+            return 1;
+        }
+        res = 1;
+        {
+            stcc4::task t = a_stcc4_coro_interface(coro, exec, res);
+            
+            exec.spawn(t);
+            exec.run();
+            if ((!t.done()) || (res != 0))
+            {
+                (void)sensor.deinit();
+                
+                return 1;
+            }
+        }
+        stcc4_interface_debug_print("stcc4: %d resumes, the thread blocked %d times.\n",
+                                    static_cast<uint32_t>(exec.resumes()), static_cast<uint32_t>(exec.sleeps()));
+        if (!sensor.deinit())
+        {
+            stcc4_interface_debug_print("stcc4: deinit failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* thousands of sensors on one thread */
+    stcc4_interface_debug_print("stcc4: %d coroutine sensors benchmark test.\n", CORO_TEST_SENSORS);
+    a_stcc4_coro_put_word(&gs_id[0], 0x0901);
+    a_stcc4_coro_put_word(&gs_id[3], 0x018A);
+    for (i = 0; i < 4; i++)
+    {
+        a_stcc4_coro_put_word(&gs_id[6 + i * 3], static_cast<uint16_t>(0x1234 * (i + 1)));
+    }
+    a_stcc4_coro_put_word(&gs_frame[0], 812);
+    a_stcc4_coro_put_word(&gs_frame[3], 0x6666);
+    a_stcc4_coro_put_word(&gs_frame[6], 0x7FFF);
+    a_stcc4_coro_put_word(&gs_frame[9], 0x0000);
+    {
+        std::vector<stcc4::Stcc4<stcc4_coro_loopback_bus, stcc4_coro_loopback_delay>> sensor;
+        std::vector<std::unique_ptr<stcc4_coro_loopback_sensor_t>> coro;
+        std::vector<stcc4::task> task;
+        stcc4::executor<> exec;
+        
+        sensor.reserve(CORO_TEST_SENSORS);
+        coro.reserve(CORO_TEST_SENSORS);
+        task.reserve(CORO_TEST_SENSORS);
+        errors = 0;
+        for (i = 0; i < CORO_TEST_SENSORS; i++)
+        {
+            sensor.emplace_back(address);
+            if (!sensor.back().init())
+            {
+                stcc4_interface_debug_print("stcc4: loopback init failed.\n");
+                
+                return 1;
+            }
+            coro.push_back(std::make_unique<stcc4_coro_loopback_sensor_t>(sensor.back(), exec));
+            task.push_back(a_stcc4_coro_loopback(*coro.back(), times, errors));
+            exec.spawn(task.back());
+        }
+        switches = a_stcc4_coro_switches();
+        start = a_stcc4_coro_ms();
+        exec.run();
+        start = a_stcc4_coro_ms() - start;
+        switches = a_stcc4_coro_switches() - switches;
+        threads = a_stcc4_coro_threads();
+        for (i = 0; i < CORO_TEST_SENSORS; i++)
+        {
+            errors += task[i].done() ? 0 : 1;
+        }
+        if (errors != 0)
+        {
+            stcc4_interface_debug_print("stcc4: coroutine sensors failed %d times.\n", errors);
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: %d samples in %dms, %d threads, %d context switches, %d sleeps.\n",
+                                    CORO_TEST_SENSORS * times, static_cast<uint32_t>(start), threads,
+                                    static_cast<uint32_t>(switches), static_cast<uint32_t>(exec.sleeps()));
+    }
+    
+    /* the blocking c handle needs a thread per sensor */
+    stcc4_interface_debug_print("stcc4: %d thread per sensor benchmark test.\n", CORO_TEST_THREADS);
+    {
+        std::vector<std::thread> thread;
+        
+        for (i = 0; i < CORO_TEST_THREADS; i++)
+        {
+            DRIVER_STCC4_LINK_INIT(&gs_handle[i], stcc4_handle_t);
+            DRIVER_STCC4_LINK_IIC_INIT(&gs_handle[i], a_stcc4_coro_loopback_init);
+            DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle[i], a_stcc4_coro_loopback_init);
+            DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle[i], a_stcc4_coro_loopback_write);
+            DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle[i], a_stcc4_coro_loopback_read);
+            DRIVER_STCC4_LINK_IIC_WRITE_READ_COMMAND(&gs_handle[i], a_stcc4_coro_loopback_write_read);
+            DRIVER_STCC4_LINK_DELAY_MS(&gs_handle[i], a_stcc4_coro_loopback_delay_ms);
+            DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle[i], stcc4_interface_debug_print);
+            if ((stcc4_set_address_pin(&gs_handle[i], address) != 0) || (stcc4_init(&gs_handle[i]) != 0))
+            {
+                stcc4_interface_debug_print("stcc4: loopback init failed.\n");
+                
+                return 1;
+            }
+            failed[i] = 0;
+        }
+        thread.reserve(CORO_TEST_THREADS);
+        switches = a_stcc4_coro_switches();
+        start = a_stcc4_coro_ms();
+        for (i = 0; i < CORO_TEST_THREADS; i++)
+        {
+            thread.emplace_back(a_stcc4_coro_thread, &gs_handle[i], times, &failed[i]);
+        }
+        threads = a_stcc4_coro_threads();
+        for (i = 0; i < CORO_TEST_THREADS; i++)
+        {
+            thread[i].join();
+        }
+        start = a_stcc4_coro_ms() - start;
+        switches = a_stcc4_coro_switches() - switches;
+        errors = 0;
+        for (i = 0; i < CORO_TEST_THREADS; i++)
+        {
+            errors += failed[i];
+            (void)stcc4_deinit(&gs_handle[i]);
+        }
+        if (errors != 0)
+        {
+            stcc4_interface_debug_print("stcc4: thread per sensor failed %d times.\n", errors);
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: %d samples in %dms, %d threads, %d context switches.\n",
+                                    CORO_TEST_THREADS * times, static_cast<uint32_t>(start), threads,
+                                    static_cast<uint32_t>(switches));
+    }
+    
+#ifdef STCC4_SIMULATOR
+    (void)stcc4_simulator_set_clock_stretch(address, STCC4_BOOL_FALSE);
+#endif
+    
+    /* finish coro test */
+    stcc4_interface_debug_print("stcc4: finish coro test.\n");
+    
+    return 0;
+}
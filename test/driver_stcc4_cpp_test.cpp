@@ -0,0 +1,426 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_cpp_test.cpp
+ * @brief     driver stcc4 cpp test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_cpp_test.h"
+#include "driver_stcc4_interface.hpp"
+#ifdef STCC4_SIMULATOR
+#include "driver_stcc4_interface_simulator.h"
+#endif
+#include <chrono>
+
+/**
+ * @brief cpp test definition
+ */
+#define CPP_TEST_READS        1000000        /**< benchmark reads per round */
+
+static stcc4_handle_t gs_handle;                    /**< stcc4 handle */
+static uint8_t gs_frame[STCC4_RAW_FRAME_SIZE];      /**< loopback measurement frame */
+static uint8_t gs_id[18];                           /**< loopback product id frame */
+
+/**
+ * @brief     put a word with crc
+ * @param[in] *buf pointer to a 3 bytes buffer
+ * @param[in] word data word
+ * @note      none
+ */
+static void a_stcc4_cpp_put_word(uint8_t *buf, uint16_t word)
+{
+    buf[0] = static_cast<uint8_t>(word >> 8);
+    buf[1] = static_cast<uint8_t>(word & 0xFF);
+    (void)stcc4_crc8(buf, 2, buf + 2);
+}
+
+/**
+ * @brief      loopback write and read
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write buffer
+ * @param[in]  wlen length of the write buffer
+ * @param[out] *rbuf pointer to a read buffer
+ * @param[in]  rlen length of the read buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 transfer failed
+ * @note       answers the product id and measurement commands
+ */
+static uint8_t a_stcc4_cpp_loopback_write_read(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    (void)addr;
+    if ((wlen == 2) && (wbuf[0] == 0x36) && (wbuf[1] == 0x5B) && (rlen == sizeof(gs_id)))
+    {
+        memcpy(rbuf, gs_id, sizeof(gs_id));
+        
+        return 0;
+    }
+    if ((wlen == 2) && (wbuf[0] == 0xEC) && (wbuf[1] == 0x05) && (rlen == sizeof(gs_frame)))
+    {
+        memcpy(rbuf, gs_frame, sizeof(gs_frame));
+        
+        return 0;
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     loopback write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      every command is accepted
+ */
+static uint8_t a_stcc4_cpp_loopback_write(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    (void)len;
+    
+    return 0;
+}
+
+/**
+ * @brief      loopback read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 1 read failed
+ * @note       all responses are served by the combined transfer
+ */
+static uint8_t a_stcc4_cpp_loopback_read(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    (void)len;
+    
+    return 1;
+}
+
+/**
+ * @brief  loopback init and deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_stcc4_cpp_loopback_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     loopback delay
+ * @param[in] ms time
+ * @note      the loopback never waits
+ */
+static void a_stcc4_cpp_loopback_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief stcc4 cpp loopback bus policy structure definition
+ */
+struct stcc4_cpp_loopback_bus
+{
+    uint8_t init() noexcept { return a_stcc4_cpp_loopback_init(); }
+    uint8_t deinit() noexcept { return a_stcc4_cpp_loopback_init(); }
+    uint8_t write(uint8_t addr, uint8_t *buf, uint16_t len) noexcept { return a_stcc4_cpp_loopback_write(addr, buf, len); }
+    uint8_t read(uint8_t addr, uint8_t *buf, uint16_t len) noexcept { return a_stcc4_cpp_loopback_read(addr, buf, len); }
+    uint8_t write_read(uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen) noexcept
+    {
+        return a_stcc4_cpp_loopback_write_read(addr, wbuf, wlen, rbuf, rlen);
+    }
+};
+
+/**
+ * @brief stcc4 cpp loopback delay policy structure definition
+ */
+struct stcc4_cpp_loopback_delay
+{
+    void delay_ms(uint32_t ms) const noexcept { a_stcc4_cpp_loopback_delay_ms(ms); }
+};
+
+/**
+ * @brief  get a monotonic timestamp in ns
+ * @return timestamp in ns
+ * @note   none
+ */
+static uint64_t a_stcc4_cpp_ns(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief     link the c handle
+ * @param[in] loopback link the loopback bus instead of the interface
+ * @note      none
+ */
+static void a_stcc4_cpp_link(bool loopback)
+{
+    DRIVER_STCC4_LINK_INIT(&gs_handle, stcc4_handle_t);
+    if (loopback)
+    {
+        DRIVER_STCC4_LINK_IIC_INIT(&gs_handle, a_stcc4_cpp_loopback_init);
+        DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle, a_stcc4_cpp_loopback_init);
+        DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle, a_stcc4_cpp_loopback_write);
+        DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle, a_stcc4_cpp_loopback_read);
+        DRIVER_STCC4_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, a_stcc4_cpp_loopback_write_read);
+        DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, a_stcc4_cpp_loopback_delay_ms);
+    }
+    else
+    {
+        DRIVER_STCC4_LINK_IIC_INIT(&gs_handle, stcc4_interface_iic_init);
+        DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle, stcc4_interface_iic_deinit);
+        DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle, stcc4_interface_iic_write_cmd);
+        DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle, stcc4_interface_iic_read_cmd);
+        DRIVER_STCC4_LINK_IIC_WRITE_READ_COMMAND(&gs_handle, stcc4_interface_iic_write_read_cmd);
+        DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, stcc4_interface_delay_ms);
+    }
+    DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle, stcc4_interface_debug_print);
+}
+
+/**
+ * @brief     compare a c++ sample with the c outputs
+ * @param[in] &s c++ sample
+ * @param[in] co2_raw c co2 raw
+ * @param[in] temperature_raw c temperature raw
+ * @param[in] humidity_raw c humidity raw
+ * @param[in] status c sensor status
+ * @return    status code
+ *            - 0 same
+ *            - 1 different
+ * @note      none
+ */
+static uint8_t a_stcc4_cpp_compare(const stcc4::sample &s, int16_t co2_raw, uint16_t temperature_raw,
+                                   uint16_t humidity_raw, uint16_t status)
+{
+    return ((s.co2_raw != co2_raw) || (s.temperature_raw != temperature_raw) ||
+            (s.humidity_raw != humidity_raw) || (s.status != status)) ? 1 : 0;
+}
+
+/**
+ * @brief     c++ wrapper test
+ * @param[in] address address pin
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+extern "C" uint8_t stcc4_cpp_test(stcc4_address_t address, uint32_t times)
+{
+    uint8_t res;
+    uint32_t id;
+    uint8_t sn[8];
+    uint16_t result;
+    int16_t co2_raw;
+    int16_t co2_ppm;
+    uint16_t temperature_raw;
+    float temperature_s;
+    uint16_t humidity_raw;
+    float humidity_s;
+    uint16_t sensor_status;
+    uint64_t c_ns;
+    uint64_t cpp_ns;
+    uint64_t start;
+    uint32_t i;
+    uint32_t j;
+    
+    /* start cpp test */
+    stcc4_interface_debug_print("stcc4: start cpp test.\n");
+    stcc4_interface_debug_print("stcc4: c handle is %d bytes, c++ sensor is %d bytes.\n",
+                                static_cast<uint32_t>(sizeof(stcc4_handle_t)),
+                                static_cast<uint32_t>(sizeof(stcc4::Stcc4<stcc4::interface_bus, stcc4::interface_delay>)));
+#ifdef STCC4_SIMULATOR
+    
+    /* the combined transfer needs a clock stretching part */
+    (void)stcc4_simulator_set_clock_stretch(address, STCC4_BOOL_TRUE);
+#endif
+    
+    /* the c++ template on the linked interface */
+    {
+        stcc4::Stcc4<stcc4::interface_bus, stcc4::interface_delay> sensor(address);
+        stcc4::result<stcc4::product_id> pid = sensor.get_product_id();
+        stcc4::result<uint16_t> word = 0;
+        stcc4::result<stcc4::sample> sample = stcc4::unexpected{stcc4::error::bus};
+        uint8_t buf[2];
+        
+        if (pid.has_value() || (pid.error_code() != stcc4::error::not_inited))
+        {
+            stcc4_interface_debug_print("stcc4: not inited check failed.\n");
+            
+            return 1;
+        }
+        if (sensor.read_raw(stcc4::span<uint8_t>(buf)).error_code() != stcc4::error::length)
+        {
+            stcc4_interface_debug_print("stcc4: length check failed.\n");
+            
+            return 1;
+        }
+        if (!sensor.init())
+        {
+            stcc4_interface_debug_print("stcc4: init failed.\n");
+            
+            return 1;
+        }
+        pid = sensor.get_product_id();
+        word = sensor.perform_self_test();
+        if ((!pid) || (!word))
+        {
+            stcc4_interface_debug_print("stcc4: get product id or self test failed.\n");
+            (void)sensor.deinit();
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: product id is 0x%08X, self test is 0x%04X.\n", pid->id, *word);
+        if ((!sensor.measure_single_shot()) || (!(sample = sensor.read())))
+        {
+            stcc4_interface_debug_print("stcc4: measure single shot failed.\n");
+            (void)sensor.deinit();
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: co2 is %dppm, temperature is %0.2fC, humidity is %0.2f%%.\n",
+                                    sample->co2_ppm, sample->temperature, sample->humidity);
+        if (!sensor.deinit())
+        {
+            stcc4_interface_debug_print("stcc4: deinit failed.\n");
+            
+            return 1;
+        }
+        
+        /* the c handle must see the same chip */
+        a_stcc4_cpp_link(false);
+        res = stcc4_set_address_pin(&gs_handle, address);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: set address pin failed.\n");
+            
+            return 1;
+        }
+        stcc4_interface_delay_ms(1200);
+        res = stcc4_init(&gs_handle);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: init failed.\n");
+            
+            return 1;
+        }
+        res = stcc4_get_product_id(&gs_handle, &id, sn);
+        if (res == 0)
+        {
+            res = stcc4_perform_self_test(&gs_handle, &result);
+        }
+        (void)stcc4_deinit(&gs_handle);
+        if ((res != 0) || (id != pid->id) || (memcmp(sn, pid->serial.data(), 8) != 0) || (result != *word))
+        {
+            stcc4_interface_debug_print("stcc4: c and c++ check failed.\n");
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: check c and c++ ok.\n");
+        stcc4_interface_delay_ms(1200);
+    }
+    
+    /* per read overhead on a loopback bus */
+    stcc4_interface_debug_print("stcc4: loopback benchmark test.\n");
+    a_stcc4_cpp_put_word(&gs_id[0], 0x0901);
+    a_stcc4_cpp_put_word(&gs_id[3], 0x018A);
+    for (i = 0; i < 4; i++)
+    {
+        a_stcc4_cpp_put_word(&gs_id[6 + i * 3], static_cast<uint16_t>(0x1234 * (i + 1)));
+    }
+    a_stcc4_cpp_put_word(&gs_frame[0], 812);
+    a_stcc4_cpp_put_word(&gs_frame[3], 0x6666);
+    a_stcc4_cpp_put_word(&gs_frame[6], 0x7FFF);
+    a_stcc4_cpp_put_word(&gs_frame[9], 0x0000);
+    {
+        stcc4::Stcc4<stcc4_cpp_loopback_bus, stcc4_cpp_loopback_delay> sensor(address);
+        stcc4::result<stcc4::sample> sample = stcc4::unexpected{stcc4::error::bus};
+        
+        a_stcc4_cpp_link(true);
+        res = stcc4_set_address_pin(&gs_handle, address);
+        if ((res != 0) || (stcc4_init(&gs_handle) != 0) || (!sensor.init()))
+        {
+            stcc4_interface_debug_print("stcc4: loopback init failed.\n");
+            
+            return 1;
+        }
+        c_ns = 0;
+        cpp_ns = 0;
+        for (j = 0; j < times; j++)
+        {
+            start = a_stcc4_cpp_ns();
+            for (i = 0; i < CPP_TEST_READS; i++)
+            {
+                res |= stcc4_read(&gs_handle, &co2_raw, &co2_ppm, &temperature_raw, &temperature_s,
+                                  &humidity_raw, &humidity_s, &sensor_status);
+            }
+            c_ns += a_stcc4_cpp_ns() - start;
+            start = a_stcc4_cpp_ns();
+            for (i = 0; i < CPP_TEST_READS; i++)
+            {
+                sample = sensor.read();
+                res |= sample ? 0 : 1;
+            }
+            cpp_ns += a_stcc4_cpp_ns() - start;
+        }
+        if ((res != 0) || (a_stcc4_cpp_compare(*sample, co2_raw, temperature_raw, humidity_raw, sensor_status) != 0) ||
+            (sample->temperature != temperature_s) || (sample->humidity != humidity_s))
+        {
+            stcc4_interface_debug_print("stcc4: loopback read check failed.\n");
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: c handle read is %0.1fns, c++ template read is %0.1fns, %0.2fx.\n",
+                                    static_cast<double>(c_ns) / (static_cast<double>(times) * CPP_TEST_READS),
+                                    static_cast<double>(cpp_ns) / (static_cast<double>(times) * CPP_TEST_READS),
+                                    (cpp_ns != 0) ? static_cast<double>(c_ns) / static_cast<double>(cpp_ns) : 0.0);
+        (void)stcc4_deinit(&gs_handle);
+        (void)sensor.deinit();
+    }
+    
+#ifdef STCC4_SIMULATOR
+    (void)stcc4_simulator_set_clock_stretch(address, STCC4_BOOL_FALSE);
+#endif
+    
+    /* finish cpp test */
+    stcc4_interface_debug_print("stcc4: finish cpp test.\n");
+    
+    return 0;
+}
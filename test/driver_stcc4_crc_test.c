@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_stcc4_crc_test.c
+ * @brief     driver stcc4 crc test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_crc_test.h"
+#include "driver_stcc4_bench_test.h"
+
+/**
+ * @brief     reference bitwise crc8
+ * @param[in] *data pointer to a data buffer
+ * @param[in] count data length
+ * @return    crc
+ * @note      none
+ */
+static uint8_t a_stcc4_crc_reference(uint8_t *data, uint16_t count)
+{
+    uint16_t i;
+    uint8_t bit;
+    uint8_t crc = 0xFF;
+    
+    for (i = 0; i < count; i++)
+    {
+        crc ^= data[i];
+        for (bit = 8; bit > 0; --bit)
+        {
+            if ((crc & 0x80) != 0)
+            {
+                crc = (uint8_t)((crc << 1) ^ 0x31);
+            }
+            else
+            {
+                crc = (uint8_t)(crc << 1);
+            }
+        }
+    }
+    
+    return crc;
+}
+
+/**
+ * @brief     crc test
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      each round checks all 65536 data words, the cores with a cycle counter also report the cycles,
+ *            keep times below 500 there so the 32 bits counter does not wrap around
+ */
+uint8_t stcc4_crc_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t crc;
+    uint8_t acc;
+    uint8_t buf[2];
+    uint8_t frame[12];
+    uint16_t mask;
+    uint32_t i;
+    uint32_t j;
+    uint32_t cycle_start;
+    uint32_t cycle_stop;
+    uint64_t start;
+    uint64_t stop;
+    double s;
+    double words;
+    
+    /* start crc test */
+    stcc4_interface_debug_print("stcc4: start crc test.\n");
+    stcc4_interface_debug_print("stcc4: crc8 backend is %s.\n",
+                                (STCC4_CRC8_BACKEND == STCC4_CRC8_BACKEND_TABLE_256) ? "table 256" :
+                                (STCC4_CRC8_BACKEND == STCC4_CRC8_BACKEND_TABLE_16) ? "table 16" : "bitwise");
+    
+    /* datasheet example */
+    stcc4_interface_debug_print("stcc4: datasheet example test.\n");
+    buf[0] = 0xBE;
+    buf[1] = 0xEF;
+    res = stcc4_crc8(buf, 2, &crc);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: crc8 failed.\n");
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: crc of 0xBEEF is 0x%02X.\n", crc);
+    stcc4_interface_debug_print("stcc4: check datasheet example %s.\n", (crc == 0x92) ? "ok" : "error");
+    if (crc != 0x92)
+    {
+        return 1;
+    }
+    
+    /* all data words */
+    stcc4_interface_debug_print("stcc4: all data words test.\n");
+    for (i = 0; i < 65536; i++)
+    {
+        buf[0] = (uint8_t)(i >> 8);
+        buf[1] = (uint8_t)(i >> 0);
+        (void)stcc4_crc8(buf, 2, &crc);
+        if (crc != a_stcc4_crc_reference(buf, 2))
+        {
+            stcc4_interface_debug_print("stcc4: crc of 0x%04X is error.\n", i);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: check all data words ok.\n");
+    
+    /* frame check */
+    stcc4_interface_debug_print("stcc4: frame check test.\n");
+    for (i = 0; i < 4; i++)
+    {
+        frame[i * 3 + 0] = (uint8_t)(0x12 + i);
+        frame[i * 3 + 1] = (uint8_t)(0x34 + i);
+        frame[i * 3 + 2] = a_stcc4_crc_reference(&frame[i * 3], 2);
+    }
+    res = stcc4_check_frame(frame, 4, &mask);
+    if ((res != 0) || (mask != 0))
+    {
+        stcc4_interface_debug_print("stcc4: check good frame error.\n");
+        
+        return 1;
+    }
+    frame[10] ^= 0x01;
+    res = stcc4_check_frame(frame, 4, &mask);
+    stcc4_interface_debug_print("stcc4: corrupted status word mask is 0x%02X.\n", mask);
+    if ((res != 0) || (mask != STCC4_CRC_ERROR_SENSOR_STATUS))
+    {
+        stcc4_interface_debug_print("stcc4: check corrupted frame error.\n");
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: check frame ok.\n");
+    
+    /* benchmark */
+    stcc4_interface_debug_print("stcc4: benchmark test.\n");
+    acc = 0;
+    res = stcc4_bench_test_cycles(&cycle_start);
+    start = stcc4_bench_test_ns();
+    for (j = 0; j < times; j++)
+    {
+        for (i = 0; i < 65536; i++)
+        {
+            buf[0] = (uint8_t)(i >> 8);
+            buf[1] = (uint8_t)(i >> 0) ^ acc;
+            (void)stcc4_crc8(buf, 2, &crc);
+            acc ^= crc;
+        }
+    }
+    stop = stcc4_bench_test_ns();
+    (void)stcc4_bench_test_cycles(&cycle_stop);
+    s = (double)(stop - start) / 1e9;
+    words = (double)times * 65536.0;
+    stcc4_interface_debug_print("stcc4: %d words in %0.3fs, checksum 0x%02X.\n", (uint32_t)words, s, acc);
+    if (s > 0.0)
+    {
+        stcc4_interface_debug_print("stcc4: %0.2fns per word.\n", s * 1e9 / words);
+        stcc4_interface_debug_print("stcc4: %0.2f Mwords per second.\n", words / s / 1e6);
+    }
+    if (res == 0)
+    {
+        stcc4_interface_debug_print("stcc4: %0.2f cycles per word.\n", (double)(uint32_t)(cycle_stop - cycle_start) / words);
+    }
+    
+    /* finish crc test */
+    stcc4_interface_debug_print("stcc4: finish crc test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,315 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_filter_test.c
+ * @brief     driver stcc4 filter test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_filter_test.h"
+#include "driver_stcc4_bench_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief filter test definition
+ */
+#define FILTER_TEST_SAMPLES          20000        /**< checked samples */
+#define FILTER_TEST_CHANNELS         4096         /**< benchmark channels */
+#define FILTER_TEST_STEPS            64           /**< benchmark samples per channel */
+#define FILTER_TEST_MEDIAN           9            /**< benchmark median window */
+#define FILTER_TEST_HAMPEL           7            /**< benchmark hampel window */
+
+static stcc4_filter_ema_t gs_ema[FILTER_TEST_CHANNELS];                  /**< ema states */
+static stcc4_filter_median_t gs_median[FILTER_TEST_CHANNELS];            /**< median states */
+static stcc4_filter_hampel_t gs_hampel[FILTER_TEST_CHANNELS];            /**< hampel states */
+static int32_t gs_history[FILTER_TEST_SAMPLES];                          /**< checked input */
+static uint32_t gs_seed;                                                 /**< random seed */
+
+/**
+ * @brief     compare two values for qsort
+ * @param[in] *a pointer to a value
+ * @param[in] *b pointer to a value
+ * @return    order
+ * @note      none
+ */
+static int a_stcc4_filter_compare(const void *a, const void *b)
+{
+    int32_t x = *(const int32_t *)a;
+    int32_t y = *(const int32_t *)b;
+    
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     brute force upper median of the last samples
+ * @param[in] end index after the newest sample
+ * @param[in] window window length
+ * @param[out] *mad pointer to a mad buffer
+ * @return    median
+ * @note      none
+ */
+static int32_t a_stcc4_filter_brute(uint32_t end, uint8_t window, int64_t *mad)
+{
+    int32_t buf[STCC4_FILTER_WINDOW_MAX];
+    int32_t dev[STCC4_FILTER_WINDOW_MAX];
+    uint32_t n;
+    uint32_t i;
+    int32_t m;
+    
+    n = (end < window) ? end : window;
+    memcpy(buf, &gs_history[end - n], sizeof(int32_t) * n);
+    qsort(buf, n, sizeof(int32_t), a_stcc4_filter_compare);
+    m = buf[n / 2];
+    for (i = 0; i < n; i++)
+    {
+        dev[i] = (buf[i] > m) ? buf[i] - m : m - buf[i];
+    }
+    qsort(dev, n, sizeof(int32_t), a_stcc4_filter_compare);
+    *mad = dev[n / 2];
+    
+    return m;
+}
+
+/**
+ * @brief make a noisy co2 like input with spikes
+ * @note  none
+ */
+static void a_stcc4_filter_make(void)
+{
+    uint32_t i;
+    int32_t level;
+    
+    gs_seed = 0xC0FFEE11U;
+    level = 800;
+    for (i = 0; i < FILTER_TEST_SAMPLES; i++)
+    {
+        level += (int32_t)stcc4_bench_test_random(&gs_seed, 3) - 1;
+        gs_history[i] = level + (int32_t)stcc4_bench_test_random(&gs_seed, 21) - 10;
+        if (stcc4_bench_test_random(&gs_seed, 200) == 0)
+        {
+            gs_history[i] += 2000;
+        }
+    }
+}
+
+/**
+ * @brief  run one benchmark round
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_stcc4_filter_benchmark(void)
+{
+    uint64_t start;
+    uint64_t ema_ns;
+    uint64_t median_ns;
+    uint64_t hampel_ns;
+    int64_t sum;
+    uint32_t c;
+    uint32_t t;
+    
+    for (c = 0; c < FILTER_TEST_CHANNELS; c++)
+    {
+        if ((stcc4_filter_ema_init(&gs_ema[c], 100) != 0) ||
+            (stcc4_filter_median_init(&gs_median[c], FILTER_TEST_MEDIAN) != 0) ||
+            (stcc4_filter_hampel_init(&gs_hampel[c], FILTER_TEST_HAMPEL, 3000) != 0))
+        {
+            stcc4_interface_debug_print("stcc4: filter init failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* one sample per channel per step, like a fleet polled at 1 Hz */
+    sum = 0;
+    start = stcc4_bench_test_ns();
+    for (t = 0; t < FILTER_TEST_STEPS; t++)
+    {
+        for (c = 0; c < FILTER_TEST_CHANNELS; c++)
+        {
+            sum += stcc4_filter_ema_update(&gs_ema[c], gs_history[(t * 7 + c) % FILTER_TEST_SAMPLES]);
+        }
+    }
+    ema_ns = stcc4_bench_test_ns() - start;
+    start = stcc4_bench_test_ns();
+    for (t = 0; t < FILTER_TEST_STEPS; t++)
+    {
+        for (c = 0; c < FILTER_TEST_CHANNELS; c++)
+        {
+            sum += stcc4_filter_median_update(&gs_median[c], gs_history[(t * 7 + c) % FILTER_TEST_SAMPLES]);
+        }
+    }
+    median_ns = stcc4_bench_test_ns() - start;
+    start = stcc4_bench_test_ns();
+    for (t = 0; t < FILTER_TEST_STEPS; t++)
+    {
+        for (c = 0; c < FILTER_TEST_CHANNELS; c++)
+        {
+            sum += stcc4_filter_hampel_update(&gs_hampel[c], gs_history[(t * 7 + c) % FILTER_TEST_SAMPLES]);
+        }
+    }
+    hampel_ns = stcc4_bench_test_ns() - start;
+    
+    /* output */
+    stcc4_interface_debug_print("stcc4: %d channels x %d samples, checksum %d.\n",
+                                FILTER_TEST_CHANNELS, FILTER_TEST_STEPS, (int32_t)(sum & 0x7FFFFFFF));
+    stcc4_interface_debug_print("stcc4: ema %d ksamples/s, median of %d %d ksamples/s, hampel of %d %d ksamples/s.\n",
+                                (uint32_t)((uint64_t)FILTER_TEST_CHANNELS * FILTER_TEST_STEPS * 1000000ULL / (ema_ns + 1)),
+                                FILTER_TEST_MEDIAN,
+                                (uint32_t)((uint64_t)FILTER_TEST_CHANNELS * FILTER_TEST_STEPS * 1000000ULL / (median_ns + 1)),
+                                FILTER_TEST_HAMPEL,
+                                (uint32_t)((uint64_t)FILTER_TEST_CHANNELS * FILTER_TEST_STEPS * 1000000ULL / (hampel_ns + 1)));
+    
+    return 0;
+}
+
+/**
+ * @brief     filter test
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t stcc4_filter_test(uint32_t times)
+{
+    stcc4_filter_ema_t ema;
+    stcc4_filter_median_t *median;
+    stcc4_filter_hampel_t *hampel;
+    double reference;
+    int64_t mad;
+    int64_t deviation;
+    int32_t expect;
+    int32_t y;
+    uint32_t spikes;
+    uint32_t i;
+    uint8_t w;
+    
+    /* start filter test */
+    stcc4_interface_debug_print("stcc4: start filter test.\n");
+    stcc4_interface_debug_print("stcc4: median state is %d bytes, hampel state is %d bytes.\n",
+                                (uint32_t)sizeof(stcc4_filter_median_t), (uint32_t)sizeof(stcc4_filter_hampel_t));
+    a_stcc4_filter_make();
+    median = &gs_median[0];
+    hampel = &gs_hampel[0];
+    
+    /* ema against a double reference */
+    stcc4_interface_debug_print("stcc4: ema test.\n");
+    if ((stcc4_filter_ema_init(&ema, 0) == 0) || (stcc4_filter_ema_init(&ema, 250) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: ema init check failed.\n");
+        
+        return 1;
+    }
+    reference = gs_history[0];
+    for (i = 0; i < FILTER_TEST_SAMPLES; i++)
+    {
+        y = stcc4_filter_ema_update(&ema, gs_history[i]);
+        if (i != 0)
+        {
+            reference += (gs_history[i] - reference) * (16384.0 / 65536.0);
+        }
+        if ((y - reference > 1.0) || (reference - y > 1.0))
+        {
+            stcc4_interface_debug_print("stcc4: ema sample %d check failed.\n", i);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: check ema ok.\n");
+    
+    /* median and hampel against sorting every window */
+    for (w = 1; w <= STCC4_FILTER_WINDOW_MAX; w += 2)
+    {
+        stcc4_interface_debug_print("stcc4: window %d test.\n", w);
+        if ((stcc4_filter_median_init(median, w) != 0) || (stcc4_filter_hampel_init(hampel, w, 3000) != 0))
+        {
+            stcc4_interface_debug_print("stcc4: init failed.\n");
+            
+            return 1;
+        }
+        spikes = 0;
+        for (i = 0; i < FILTER_TEST_SAMPLES; i++)
+        {
+            expect = a_stcc4_filter_brute(i + 1, w, &mad);
+            if (stcc4_filter_median_update(median, gs_history[i]) != expect)
+            {
+                stcc4_interface_debug_print("stcc4: median sample %d check failed.\n", i);
+                
+                return 1;
+            }
+            deviation = (gs_history[i] > expect) ? gs_history[i] - expect : expect - gs_history[i];
+            if (deviation * 10000000 > 3000LL * 14826 * mad)
+            {
+                spikes++;
+            }
+            else
+            {
+                expect = gs_history[i];
+            }
+            if (stcc4_filter_hampel_update(hampel, gs_history[i]) != expect)
+            {
+                stcc4_interface_debug_print("stcc4: hampel sample %d check failed.\n", i);
+                
+                return 1;
+            }
+        }
+        if (hampel->rejected != spikes)
+        {
+            stcc4_interface_debug_print("stcc4: hampel rejected check failed.\n");
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: check median ok, hampel rejected %d samples.\n", spikes);
+    }
+    if (stcc4_filter_median_init(median, 2) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: even window check failed.\n");
+        
+        return 1;
+    }
+    
+    /* benchmark */
+    stcc4_interface_debug_print("stcc4: channel benchmark test.\n");
+    for (i = 0; i < times; i++)
+    {
+        if (a_stcc4_filter_benchmark() != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* finish filter test */
+    stcc4_interface_debug_print("stcc4: finish filter test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,232 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_fleet_test.c
+ * @brief     driver stcc4 fleet test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_fleet_test.h"
+#include "driver_stcc4_interface_simulator.h"
+
+/**
+ * @brief fleet test definition
+ */
+#define FLEET_TEST_SENSORS         STCC4_SIMULATOR_MAX_DEVICE        /**< one sensor behind each address pin */
+#define FLEET_TEST_WINDOW_MS       500                               /**< single shot conversion window */
+#define FLEET_TEST_SLACK_MS        10                                /**< allowed delay beyond one window */
+
+static stcc4_handle_t gs_handle[FLEET_TEST_SENSORS];              /**< stcc4 handles */
+static stcc4_fleet_sensor_t gs_sensor[FLEET_TEST_SENSORS];        /**< fleet sensors */
+static stcc4_fleet_t gs_fleet;                                    /**< fleet */
+static uint32_t gs_delay_ms;                                      /**< delayed time */
+
+/**
+ * @brief     counting delay
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_stcc4_fleet_test_delay_ms(uint32_t ms)
+{
+    gs_delay_ms += ms;
+    stcc4_interface_delay_ms(ms);
+}
+
+/**
+ * @brief     deinit the first sensors
+ * @param[in] num sensor number
+ * @note      none
+ */
+static void a_stcc4_fleet_test_deinit(uint32_t num)
+{
+    uint32_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        (void)stcc4_deinit(&gs_handle[i]);
+    }
+}
+
+/**
+ * @brief     run one fleet cycle and check every sensor
+ * @param[in] expect expected fleet result
+ * @param[in] failed index of the sensor expected to fail, FLEET_TEST_SENSORS for none
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      every sensor shares one conversion window, so one window is delayed per cycle
+ */
+static uint8_t a_stcc4_fleet_test_cycle(uint8_t expect, uint32_t failed)
+{
+    uint8_t res;
+    uint32_t i;
+    
+    gs_delay_ms = 0;
+    res = stcc4_fleet_read(&gs_fleet);
+    if (res != expect)
+    {
+        stcc4_interface_debug_print("stcc4: fleet read returned %d.\n", res);
+        
+        return 1;
+    }
+    for (i = 0; i < FLEET_TEST_SENSORS; i++)
+    {
+        if ((i == failed) != (gs_sensor[i].result != 0))
+        {
+            stcc4_interface_debug_print("stcc4: sensor %d result is %d.\n", i, gs_sensor[i].result);
+            
+            return 1;
+        }
+    }
+    if (gs_delay_ms > FLEET_TEST_WINDOW_MS + FLEET_TEST_SLACK_MS)
+    {
+        stcc4_interface_debug_print("stcc4: delayed %dms, more than one conversion window.\n", gs_delay_ms);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fleet test
+ * @param[in] times measurement cycles
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      needs the simulator, one simulated device behind each address pin
+ */
+uint8_t stcc4_fleet_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    
+    /* start fleet test */
+    stcc4_interface_debug_print("stcc4: start fleet test.\n");
+    
+    /* init every sensor */
+    for (i = 0; i < FLEET_TEST_SENSORS; i++)
+    {
+        DRIVER_STCC4_LINK_INIT(&gs_handle[i], stcc4_handle_t);
+        DRIVER_STCC4_LINK_IIC_INIT(&gs_handle[i], stcc4_interface_iic_init);
+        DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle[i], stcc4_interface_iic_deinit);
+        DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle[i], stcc4_interface_iic_write_cmd);
+        DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle[i], stcc4_interface_iic_read_cmd);
+        DRIVER_STCC4_LINK_DELAY_MS(&gs_handle[i], a_stcc4_fleet_test_delay_ms);
+        DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle[i], stcc4_interface_debug_print);
+        res = stcc4_set_address_pin(&gs_handle[i], (i == 0) ? STCC4_ADDRESS_0 : STCC4_ADDRESS_1);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: set address pin failed.\n");
+            a_stcc4_fleet_test_deinit(i);
+            
+            return 1;
+        }
+        res = stcc4_init(&gs_handle[i]);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: sensor %d init failed.\n", i);
+            a_stcc4_fleet_test_deinit(i);
+            
+            return 1;
+        }
+        gs_sensor[i].handle = &gs_handle[i];
+    }
+    
+    /* fleet init */
+    res = stcc4_fleet_init(&gs_fleet, gs_sensor, FLEET_TEST_SENSORS, a_stcc4_fleet_test_delay_ms);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: fleet init failed.\n");
+        a_stcc4_fleet_test_deinit(FLEET_TEST_SENSORS);
+        
+        return 1;
+    }
+    
+    /* every conversion overlaps in one window */
+    stcc4_interface_debug_print("stcc4: overlapped read test.\n");
+    for (i = 0; i < times; i++)
+    {
+        if (a_stcc4_fleet_test_cycle(0, FLEET_TEST_SENSORS) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: overlapped read failed.\n");
+            a_stcc4_fleet_test_deinit(FLEET_TEST_SENSORS);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: %d sensors delayed %dms per cycle, one after another would delay %dms.\n",
+                                FLEET_TEST_SENSORS, gs_delay_ms, FLEET_TEST_SENSORS * FLEET_TEST_WINDOW_MS);
+    for (i = 0; i < FLEET_TEST_SENSORS; i++)
+    {
+        stcc4_interface_debug_print("stcc4: sensor %d co2 is %dppm.\n", i, gs_sensor[i].co2_ppm);
+    }
+    
+    /* a sensor failing to start is skipped */
+    stcc4_interface_debug_print("stcc4: start failure test.\n");
+    (void)stcc4_simulator_inject_nack(STCC4_ADDRESS_1, 1);
+    if (a_stcc4_fleet_test_cycle(1, 1) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: start failure check failed.\n");
+        (void)stcc4_simulator_inject_nack(STCC4_ADDRESS_1, 0);
+        a_stcc4_fleet_test_deinit(FLEET_TEST_SENSORS);
+        
+        return 1;
+    }
+    
+    /* a sensor failing to read does not hold back the others */
+    stcc4_interface_debug_print("stcc4: read failure test.\n");
+    (void)stcc4_simulator_inject_crc_error(STCC4_ADDRESS_1, STCC4_CRC_ERROR_CO2);
+    res = a_stcc4_fleet_test_cycle(1, 1);
+    (void)stcc4_simulator_inject_crc_error(STCC4_ADDRESS_1, 0);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: read failure check failed.\n");
+        a_stcc4_fleet_test_deinit(FLEET_TEST_SENSORS);
+        
+        return 1;
+    }
+    
+    /* the failed sensor recovers in the next cycle */
+    if (a_stcc4_fleet_test_cycle(0, FLEET_TEST_SENSORS) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: recovery check failed.\n");
+        a_stcc4_fleet_test_deinit(FLEET_TEST_SENSORS);
+        
+        return 1;
+    }
+    
+    /* finish fleet test */
+    stcc4_interface_debug_print("stcc4: finish fleet test.\n");
+    a_stcc4_fleet_test_deinit(FLEET_TEST_SENSORS);
+    
+    return 0;
+}
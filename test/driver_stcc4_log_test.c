@@ -0,0 +1,349 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_log_test.c
+ * @brief     driver stcc4 log test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_log_test.h"
+#include "driver_stcc4_bench_test.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/**
+ * @brief log test definition
+ */
+#define LOG_TEST_BIN            "/tmp/stcc4_log_test.bin"        /**< binary log path */
+#define LOG_TEST_CSV            "/tmp/stcc4_log_test.csv"        /**< csv log path */
+#define LOG_TEST_SAMPLES        1000500U                         /**< samples per round, not a whole batch */
+#define LOG_TEST_REOPEN         10U                              /**< samples appended after a reopen */
+
+static stcc4_log_writer_t gs_writer;        /**< log writer */
+
+/**
+ * @brief      make a test record
+ * @param[in]  i record index
+ * @param[out] *record pointer to a record structure
+ * @note       eight sensors sampled once a second, in testing mode for 5 s of every minute
+ */
+static void a_stcc4_log_make(uint32_t i, stcc4_log_record_t *record)
+{
+    record->timestamp = 1760000000U + i / 8;
+    record->co2_raw = (int16_t)(400 + (i % 1000));
+    record->temperature_raw = (uint16_t)(0x6000 + (i % 4096));
+    record->humidity_raw = (uint16_t)(0x8000 + (i % 2048));
+    record->sensor_id = (uint8_t)(i % 8);
+    record->sensor_status = STCC4_LOG_STATUS(((i / 8) % 60 < 5) ? 0x4000U : 0x0000U);
+}
+
+/**
+ * @brief     write test records
+ * @param[in] start first record index
+ * @param[in] num record number
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_stcc4_log_write(uint32_t start, uint32_t num)
+{
+    stcc4_log_record_t record;
+    uint32_t i;
+    
+    if (stcc4_log_open(&gs_writer, LOG_TEST_BIN) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: log open failed.\n");
+        
+        return 1;
+    }
+    for (i = start; i < start + num; i++)
+    {
+        a_stcc4_log_make(i, &record);
+        if (stcc4_log_append(&gs_writer, &record) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: log append failed.\n");
+            (void)stcc4_log_close(&gs_writer);
+            
+            return 1;
+        }
+    }
+    if (stcc4_log_close(&gs_writer) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: log close failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  check a failed batch write
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the file is swapped for a read only descriptor, so every flush fails
+ */
+static uint8_t a_stcc4_log_full(void)
+{
+    stcc4_log_reader_t reader;
+    stcc4_log_record_t record;
+    uint32_t failed;
+    uint32_t i;
+    int fd;
+    
+    (void)unlink(LOG_TEST_BIN);
+    if (stcc4_log_open(&gs_writer, LOG_TEST_BIN) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: log open failed.\n");
+        
+        return 1;
+    }
+    fd = open(LOG_TEST_BIN, O_RDONLY);
+    if (fd < 0)
+    {
+        stcc4_interface_debug_print("stcc4: log open failed.\n");
+        (void)stcc4_log_close(&gs_writer);
+        (void)unlink(LOG_TEST_BIN);
+        
+        return 1;
+    }
+    (void)close(gs_writer.fd);
+    gs_writer.fd = fd;
+    
+    /* the appends after a full batch are refused */
+    failed = 0;
+    for (i = 0; i < 3 * STCC4_LOG_BATCH; i++)
+    {
+        a_stcc4_log_make(i, &record);
+        failed += stcc4_log_append(&gs_writer, &record);
+        if (gs_writer.num > STCC4_LOG_BATCH)
+        {
+            stcc4_interface_debug_print("stcc4: log batch overflow.\n");
+            (void)close(gs_writer.fd);
+            (void)unlink(LOG_TEST_BIN);
+            
+            return 1;
+        }
+    }
+    if (failed != 2 * STCC4_LOG_BATCH + 1)
+    {
+        stcc4_interface_debug_print("stcc4: log append failed %d times.\n", failed);
+        (void)close(gs_writer.fd);
+        (void)unlink(LOG_TEST_BIN);
+        
+        return 1;
+    }
+    
+    /* a writable file takes the kept batch and the next record */
+    (void)close(gs_writer.fd);
+    gs_writer.fd = open(LOG_TEST_BIN, O_WRONLY);
+    a_stcc4_log_make(STCC4_LOG_BATCH, &record);
+    if ((gs_writer.fd < 0) || (stcc4_log_append(&gs_writer, &record) != 0) || (stcc4_log_close(&gs_writer) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: log append after the failure failed.\n");
+        (void)unlink(LOG_TEST_BIN);
+        
+        return 1;
+    }
+    if (stcc4_log_map(&reader, LOG_TEST_BIN) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: log map failed.\n");
+        (void)unlink(LOG_TEST_BIN);
+        
+        return 1;
+    }
+    failed = (reader.num != STCC4_LOG_BATCH + 1) ? 1 : 0;
+    for (i = 0; (failed == 0) && (i < reader.num); i++)
+    {
+        a_stcc4_log_make(i, &record);
+        failed = (memcmp(&record, &reader.record[i], sizeof(stcc4_log_record_t)) != 0) ? 1 : 0;
+    }
+    (void)stcc4_log_unmap(&reader);
+    (void)unlink(LOG_TEST_BIN);
+    if (failed != 0)
+    {
+        stcc4_interface_debug_print("stcc4: log records after the failure check failed.\n");
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: check failed batch write ok.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief  run one benchmark round
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_stcc4_log_benchmark(void)
+{
+    stcc4_log_reader_t reader;
+    stcc4_log_record_t record;
+    FILE *fp;
+    uint64_t start;
+    uint64_t bin_ns;
+    uint64_t csv_ns;
+    uint64_t scan_ns;
+    uint64_t sum;
+    long csv_bytes;
+    uint32_t total;
+    uint32_t i;
+    
+    (void)unlink(LOG_TEST_BIN);
+    (void)unlink(LOG_TEST_CSV);
+    total = LOG_TEST_SAMPLES + LOG_TEST_REOPEN;
+    
+    /* binary append, then reopen on a part batch */
+    start = stcc4_bench_test_ns();
+    if (a_stcc4_log_write(0, LOG_TEST_SAMPLES) != 0)
+    {
+        return 1;
+    }
+    bin_ns = stcc4_bench_test_ns() - start;
+    if (a_stcc4_log_write(LOG_TEST_SAMPLES, LOG_TEST_REOPEN) != 0)
+    {
+        return 1;
+    }
+    
+    /* csv */
+    fp = fopen(LOG_TEST_CSV, "w");
+    if (fp == NULL)
+    {
+        stcc4_interface_debug_print("stcc4: csv open failed.\n");
+        (void)unlink(LOG_TEST_BIN);
+        
+        return 1;
+    }
+    start = stcc4_bench_test_ns();
+    for (i = 0; i < LOG_TEST_SAMPLES; i++)
+    {
+        a_stcc4_log_make(i, &record);
+        (void)fprintf(fp, "%u,%u,%d,%u,%u,%u\n", (unsigned int)record.timestamp, (unsigned int)record.sensor_id,
+                      (int)record.co2_raw, (unsigned int)record.temperature_raw,
+                      (unsigned int)record.humidity_raw, (unsigned int)record.sensor_status);
+    }
+    csv_bytes = ftell(fp);
+    (void)fclose(fp);
+    csv_ns = stcc4_bench_test_ns() - start;
+    
+    /* zero copy scan */
+    if (stcc4_log_map(&reader, LOG_TEST_BIN) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: log map failed.\n");
+        (void)unlink(LOG_TEST_BIN);
+        (void)unlink(LOG_TEST_CSV);
+        
+        return 1;
+    }
+    if ((reader.num != total) || (reader.size != STCC4_LOG_PAGE_SIZE + (uint64_t)total * sizeof(stcc4_log_record_t)))
+    {
+        stcc4_interface_debug_print("stcc4: log size check failed.\n");
+        (void)stcc4_log_unmap(&reader);
+        (void)unlink(LOG_TEST_BIN);
+        (void)unlink(LOG_TEST_CSV);
+        
+        return 1;
+    }
+    start = stcc4_bench_test_ns();
+    sum = 0;
+    for (i = 0; i < reader.num; i++)
+    {
+        sum += (uint64_t)(reader.record[i].co2_raw + reader.record[i].sensor_id);
+    }
+    scan_ns = stcc4_bench_test_ns() - start;
+    for (i = 0; i < reader.num; i++)
+    {
+        a_stcc4_log_make(i, &record);
+        if (memcmp(&record, &reader.record[i], sizeof(stcc4_log_record_t)) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: record %d check failed.\n", i);
+            (void)stcc4_log_unmap(&reader);
+            (void)unlink(LOG_TEST_BIN);
+            (void)unlink(LOG_TEST_CSV);
+            
+            return 1;
+        }
+    }
+    (void)stcc4_log_unmap(&reader);
+    (void)unlink(LOG_TEST_BIN);
+    (void)unlink(LOG_TEST_CSV);
+    
+    /* output */
+    stcc4_interface_debug_print("stcc4: binary %d bytes/sample, %d ksamples/s write.\n",
+                                (uint32_t)sizeof(stcc4_log_record_t),
+                                (uint32_t)((uint64_t)LOG_TEST_SAMPLES * 1000000ULL / (bin_ns + 1)));
+    stcc4_interface_debug_print("stcc4: csv %0.1f bytes/sample, %d ksamples/s write.\n",
+                                (double)csv_bytes / LOG_TEST_SAMPLES,
+                                (uint32_t)((uint64_t)LOG_TEST_SAMPLES * 1000000ULL / (csv_ns + 1)));
+    stcc4_interface_debug_print("stcc4: mapped scan %d ksamples/s, checksum 0x%08X.\n",
+                                (uint32_t)((uint64_t)total * 1000000ULL / (scan_ns + 1)), (uint32_t)sum);
+    
+    return 0;
+}
+
+/**
+ * @brief     log test
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the files are written to /tmp
+ */
+uint8_t stcc4_log_test(uint32_t times)
+{
+    uint32_t i;
+    
+    /* start log test */
+    stcc4_interface_debug_print("stcc4: start log test.\n");
+    stcc4_interface_debug_print("stcc4: %d samples per round, %d after a reopen.\n", LOG_TEST_SAMPLES, LOG_TEST_REOPEN);
+    if (a_stcc4_log_full() != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < times; i++)
+    {
+        if (a_stcc4_log_benchmark() != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* finish log test */
+    stcc4_interface_debug_print("stcc4: finish log test.\n");
+    
+    return 0;
+}
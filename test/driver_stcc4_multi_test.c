@@ -0,0 +1,457 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_multi_test.c
+ * @brief     driver stcc4 multi test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_multi_test.h"
+#ifdef STCC4_SIMULATOR
+#include "driver_stcc4_interface_simulator.h"
+#endif
+
+/**
+ * @brief multi test definition
+ */
+#define MULTI_TEST_MAX_INSTANCE        32        /**< max instance number */
+#define MULTI_TEST_BUS_INDEX           1         /**< iic bus of every instance */
+
+/**
+ * @brief multi test hook enumeration definition
+ */
+typedef enum
+{
+    MULTI_TEST_HOOK_INIT       = 0x00,        /**< iic_init_ctx */
+    MULTI_TEST_HOOK_DEINIT     = 0x01,        /**< iic_deinit_ctx */
+    MULTI_TEST_HOOK_WRITE      = 0x02,        /**< iic_write_cmd_ctx */
+    MULTI_TEST_HOOK_READ       = 0x03,        /**< iic_read_cmd_ctx */
+    MULTI_TEST_HOOK_WRITE_READ = 0x04,        /**< iic_write_read_cmd_ctx */
+    MULTI_TEST_HOOK_DELAY      = 0x05,        /**< delay_ms_ctx */
+    MULTI_TEST_HOOK_MAX        = 0x06,        /**< hook number */
+} multi_test_hook_t;
+
+/**
+ * @brief multi test instance structure definition
+ */
+typedef struct multi_test_instance_s
+{
+    stcc4_interface_bus_t bus;                     /**< bus of the instance */
+    stcc4_handle_t handle;                         /**< stcc4 handle */
+    uint32_t calls[MULTI_TEST_HOOK_MAX];           /**< calls of each hook */
+} multi_test_instance_t;
+
+static multi_test_instance_t gs_instance[MULTI_TEST_MAX_INSTANCE];        /**< instances */
+static const char *const gs_hook_name[MULTI_TEST_HOOK_MAX] =
+{
+    "iic_init_ctx", "iic_deinit_ctx", "iic_write_cmd_ctx",
+    "iic_read_cmd_ctx", "iic_write_read_cmd_ctx", "delay_ms_ctx",
+};                                                                        /**< hook names */
+
+#if (STCC4_OPS_TABLE != 0)
+static uint8_t a_stcc4_multi_iic_init(void *user);
+static uint8_t a_stcc4_multi_iic_deinit(void *user);
+static uint8_t a_stcc4_multi_iic_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+static uint8_t a_stcc4_multi_iic_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+static uint8_t a_stcc4_multi_iic_write_read_cmd(void *user, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen);
+static void a_stcc4_multi_delay_ms(void *user, uint32_t ms);
+
+/**
+ * @brief multi test ops table, shared by every instance
+ */
+static const stcc4_ops_t gs_ops =
+{
+    .debug_print = stcc4_interface_debug_print,
+    .iic_init_ctx = a_stcc4_multi_iic_init,
+    .iic_deinit_ctx = a_stcc4_multi_iic_deinit,
+    .iic_write_cmd_ctx = a_stcc4_multi_iic_write_cmd,
+    .iic_read_cmd_ctx = a_stcc4_multi_iic_read_cmd,
+    .iic_write_read_cmd_ctx = a_stcc4_multi_iic_write_read_cmd,
+    .delay_ms_ctx = a_stcc4_multi_delay_ms,
+};
+#endif
+
+#if (STCC4_OPS_TABLE != 0)
+/**
+ * @brief     relinked delay
+ * @param[in] ms time
+ * @note      differs from stcc4_interface_delay_ms only by its address
+ */
+static void a_stcc4_multi_relink_delay_ms(uint32_t ms)
+{
+    stcc4_interface_delay_ms(ms);
+}
+
+/**
+ * @brief     link a handle by the link macros
+ * @param[in] *handle pointer to an stcc4 handle structure
+ * @param[in] *delay_ms pointer to a delay function
+ * @note      none
+ */
+static void a_stcc4_multi_link(stcc4_handle_t *handle, void (*delay_ms)(uint32_t ms))
+{
+    DRIVER_STCC4_LINK_INIT(handle, stcc4_handle_t);
+    DRIVER_STCC4_LINK_IIC_INIT(handle, stcc4_interface_iic_init);
+    DRIVER_STCC4_LINK_IIC_DEINIT(handle, stcc4_interface_iic_deinit);
+    DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(handle, stcc4_interface_iic_write_cmd);
+    DRIVER_STCC4_LINK_IIC_READ_COMMAND(handle, stcc4_interface_iic_read_cmd);
+    DRIVER_STCC4_LINK_DELAY_MS(handle, delay_ms);
+    DRIVER_STCC4_LINK_DEBUG_PRINT(handle, stcc4_interface_debug_print);
+}
+#endif
+
+/**
+ * @brief     count an instance hook
+ * @param[in] *user pointer to an instance
+ * @param[in] hook counted hook
+ * @return    pointer to the instance bus
+ * @note      none
+ */
+static stcc4_interface_bus_t *a_stcc4_multi_count(void *user, multi_test_hook_t hook)
+{
+    multi_test_instance_t *instance = (multi_test_instance_t *)user;
+    
+    instance->calls[hook]++;
+    
+    return &instance->bus;
+}
+
+/**
+ * @brief     counted iic init
+ * @param[in] *user pointer to an instance
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+static uint8_t a_stcc4_multi_iic_init(void *user)
+{
+    return stcc4_interface_iic_init_ctx(a_stcc4_multi_count(user, MULTI_TEST_HOOK_INIT));
+}
+
+/**
+ * @brief     counted iic deinit
+ * @param[in] *user pointer to an instance
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+static uint8_t a_stcc4_multi_iic_deinit(void *user)
+{
+    return stcc4_interface_iic_deinit_ctx(a_stcc4_multi_count(user, MULTI_TEST_HOOK_DEINIT));
+}
+
+/**
+ * @brief     counted iic write command
+ * @param[in] *user pointer to an instance
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_stcc4_multi_iic_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return stcc4_interface_iic_write_cmd_ctx(a_stcc4_multi_count(user, MULTI_TEST_HOOK_WRITE), addr, buf, len);
+}
+
+/**
+ * @brief      counted iic read command
+ * @param[in]  *user pointer to an instance
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_stcc4_multi_iic_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return stcc4_interface_iic_read_cmd_ctx(a_stcc4_multi_count(user, MULTI_TEST_HOOK_READ), addr, buf, len);
+}
+
+/**
+ * @brief      counted iic write read command
+ * @param[in]  *user pointer to an instance
+ * @param[in]  addr iic device write address
+ * @param[in]  *wbuf pointer to a write data buffer
+ * @param[in]  wlen length of the write data buffer
+ * @param[out] *rbuf pointer to a read data buffer
+ * @param[in]  rlen length of the read data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write read failed
+ * @note       none
+ */
+static uint8_t a_stcc4_multi_iic_write_read_cmd(void *user, uint8_t addr, uint8_t *wbuf, uint16_t wlen, uint8_t *rbuf, uint16_t rlen)
+{
+    return stcc4_interface_iic_write_read_cmd_ctx(a_stcc4_multi_count(user, MULTI_TEST_HOOK_WRITE_READ),
+                                                  addr, wbuf, wlen, rbuf, rlen);
+}
+
+/**
+ * @brief     counted delay ms
+ * @param[in] *user pointer to an instance
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_stcc4_multi_delay_ms(void *user, uint32_t ms)
+{
+    stcc4_interface_delay_ms_ctx(a_stcc4_multi_count(user, MULTI_TEST_HOOK_DELAY), ms);
+}
+
+/**
+ * @brief     deinit the first instances
+ * @param[in] num instance number
+ * @note      none
+ */
+static void a_stcc4_multi_deinit(uint32_t num)
+{
+    uint32_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        (void)stcc4_deinit(&gs_instance[i].handle);
+    }
+}
+
+/**
+ * @brief     multi instance test
+ * @param[in] address address pin
+ * @param[in] times instance number
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      every instance is linked only by the *_ctx functions and owns its bus
+ */
+uint8_t stcc4_multi_test(stcc4_address_t address, uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    int16_t co2_raw;
+    int16_t co2_ppm;
+    uint16_t temperature_raw;
+    float temperature;
+    uint16_t humidity_raw;
+    float humidity;
+    uint16_t sensor_status;
+    
+    /* check the instance number */
+    if ((times == 0) || (times > MULTI_TEST_MAX_INSTANCE))
+    {
+        stcc4_interface_debug_print("stcc4: instance number must be in 1 - %d.\n", MULTI_TEST_MAX_INSTANCE);
+        
+        return 1;
+    }
+    
+    /* start multi test */
+    stcc4_interface_debug_print("stcc4: start multi test.\n");
+    stcc4_interface_debug_print("stcc4: %d instances on iic bus %d.\n", times, MULTI_TEST_BUS_INDEX);
+#if (STCC4_OPS_TABLE != 0)
+    stcc4_interface_debug_print("stcc4: handle is %d bytes, all instances share one %d bytes ops table.\n",
+                                (uint32_t)sizeof(stcc4_handle_t), (uint32_t)sizeof(stcc4_ops_t));
+#else
+    stcc4_interface_debug_print("stcc4: handle is %d bytes, %d bytes of it are linked functions.\n",
+                                (uint32_t)sizeof(stcc4_handle_t), (uint32_t)sizeof(stcc4_ops_t));
+#endif
+    
+    /* link every instance to its own context */
+    for (i = 0; i < times; i++)
+    {
+        multi_test_instance_t *instance = &gs_instance[i];
+        
+        memset(instance->calls, 0, sizeof(instance->calls));
+        instance->bus.index = MULTI_TEST_BUS_INDEX;
+        instance->bus.fd = -1;
+        DRIVER_STCC4_LINK_INIT(&instance->handle, stcc4_handle_t);
+        DRIVER_STCC4_LINK_USER(&instance->handle, instance);
+#if (STCC4_OPS_TABLE != 0)
+        DRIVER_STCC4_LINK_OPS(&instance->handle, &gs_ops);
+#else
+        DRIVER_STCC4_LINK_IIC_INIT_CTX(&instance->handle, a_stcc4_multi_iic_init);
+        DRIVER_STCC4_LINK_IIC_DEINIT_CTX(&instance->handle, a_stcc4_multi_iic_deinit);
+        DRIVER_STCC4_LINK_IIC_WRITE_COMMAND_CTX(&instance->handle, a_stcc4_multi_iic_write_cmd);
+        DRIVER_STCC4_LINK_IIC_READ_COMMAND_CTX(&instance->handle, a_stcc4_multi_iic_read_cmd);
+        DRIVER_STCC4_LINK_IIC_WRITE_READ_COMMAND_CTX(&instance->handle, a_stcc4_multi_iic_write_read_cmd);
+        DRIVER_STCC4_LINK_DELAY_MS_CTX(&instance->handle, a_stcc4_multi_delay_ms);
+        DRIVER_STCC4_LINK_DEBUG_PRINT(&instance->handle, stcc4_interface_debug_print);
+#endif
+        res = stcc4_set_address_pin(&instance->handle, address);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: set address pin failed.\n");
+            
+            return 1;
+        }
+    }
+    
+#ifdef STCC4_SIMULATOR
+    /* the combined transfer needs a clock stretching part */
+    (void)stcc4_simulator_set_clock_stretch(address, STCC4_BOOL_TRUE);
+#endif
+    
+    /* init */
+    stcc4_interface_debug_print("stcc4: init every instance.\n");
+    for (i = 0; i < times; i++)
+    {
+        res = stcc4_init(&gs_instance[i].handle);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: instance %d init failed.\n", i);
+            a_stcc4_multi_deinit(i);
+            
+            return 1;
+        }
+    }
+    
+    /* one single shot from every instance */
+    stcc4_interface_debug_print("stcc4: read every instance.\n");
+    for (i = 0; i < times; i++)
+    {
+        res = stcc4_measure_single_shot(&gs_instance[i].handle);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: instance %d measure single shot failed.\n", i);
+            a_stcc4_multi_deinit(times);
+            
+            return 1;
+        }
+        res = stcc4_read(&gs_instance[i].handle, &co2_raw, &co2_ppm,
+                         &temperature_raw, &temperature,
+                         &humidity_raw, &humidity, &sensor_status);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: instance %d read failed.\n", i);
+            a_stcc4_multi_deinit(times);
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: instance %d co2 is %dppm, temperature is %0.2fC, humidity is %0.2f%%.\n",
+                                    i, co2_ppm, temperature, humidity);
+    }
+    
+    /* deinit, the instances share one device so wait for the stop of the last one */
+    for (i = 0; i < times; i++)
+    {
+        if (i != 0)
+        {
+            stcc4_interface_delay_ms(1200);
+        }
+        res = stcc4_deinit(&gs_instance[i].handle);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: instance %d deinit failed.\n", i);
+            a_stcc4_multi_deinit(times);
+            
+            return 1;
+        }
+    }
+    
+    /* every instance ran the same commands, so each hook saw its own context the same number of times */
+    if ((gs_instance[0].calls[MULTI_TEST_HOOK_READ] + gs_instance[0].calls[MULTI_TEST_HOOK_WRITE_READ]) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: no read hook is called.\n");
+        
+        return 1;
+    }
+    for (j = 0; j < MULTI_TEST_HOOK_MAX; j++)
+    {
+        if ((j != MULTI_TEST_HOOK_READ) && (j != MULTI_TEST_HOOK_WRITE_READ) && (gs_instance[0].calls[j] == 0))
+        {
+            stcc4_interface_debug_print("stcc4: %s is never called.\n", gs_hook_name[j]);
+            
+            return 1;
+        }
+        for (i = 1; i < times; i++)
+        {
+            if (gs_instance[i].calls[j] != gs_instance[0].calls[j])
+            {
+                stcc4_interface_debug_print("stcc4: instance %d %s calls check failed.\n", i, gs_hook_name[j]);
+                
+                return 1;
+            }
+        }
+        stcc4_interface_debug_print("stcc4: %s is called %d times per instance.\n", gs_hook_name[j], gs_instance[0].calls[j]);
+    }
+    stcc4_interface_debug_print("stcc4: check context ok.\n");
+    
+#if (STCC4_OPS_TABLE != 0)
+    /* the link macros fill one shared table, a relink while a handle is inited is rejected */
+    stcc4_interface_debug_print("stcc4: link table relink test.\n");
+    stcc4_interface_delay_ms(1200);
+    a_stcc4_multi_link(&gs_instance[0].handle, stcc4_interface_delay_ms);
+    if ((stcc4_set_address_pin(&gs_instance[0].handle, address) != 0) || (stcc4_init(&gs_instance[0].handle) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: link table init failed.\n");
+        
+        return 1;
+    }
+    a_stcc4_multi_link(&gs_instance[1].handle, a_stcc4_multi_relink_delay_ms);
+    if ((stcc4_set_address_pin(&gs_instance[1].handle, address) != 0) || (stcc4_init(&gs_instance[1].handle) != 3))
+    {
+        stcc4_interface_debug_print("stcc4: link table relink check failed.\n");
+        (void)stcc4_deinit(&gs_instance[1].handle);
+        (void)stcc4_deinit(&gs_instance[0].handle);
+        
+        return 1;
+    }
+    
+    /* a relink after the last deinit is allowed */
+    if (stcc4_deinit(&gs_instance[0].handle) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: link table deinit failed.\n");
+        
+        return 1;
+    }
+    stcc4_interface_delay_ms(1200);
+    if ((stcc4_init(&gs_instance[1].handle) != 0) || (stcc4_deinit(&gs_instance[1].handle) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: link table relink after deinit failed.\n");
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: check link table ok.\n");
+#endif
+    
+#ifdef STCC4_SIMULATOR
+    (void)stcc4_simulator_set_clock_stretch(address, STCC4_BOOL_FALSE);
+#endif
+    
+    /* finish multi test */
+    stcc4_interface_debug_print("stcc4: finish multi test.\n");
+    
+    return 0;
+}
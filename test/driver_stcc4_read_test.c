@@ -35,8 +35,31 @@
  */
 
 #include "driver_stcc4_read_test.h"
+#include "driver_stcc4_periodic.h"
+#ifdef STCC4_SIMULATOR
+#include "driver_stcc4_interface_simulator.h"
+#endif
 
 static stcc4_handle_t gs_handle;        /**< stcc4 handle */
+#ifdef STCC4_SIMULATOR
+static stcc4_address_t gs_nack_address;        /**< nacked address pin */
+static uint8_t gs_nack_arm;                    /**< nack the transfers after the next delay */
+
+/**
+ * @brief     read test delay
+ * @param[in] ms time
+ * @note      an armed delay makes the simulated stcc4 nack until it is cleared
+ */
+static void a_stcc4_read_test_delay_ms(uint32_t ms)
+{
+    if (gs_nack_arm != 0)
+    {
+        gs_nack_arm = 0;
+        (void)stcc4_simulator_inject_nack(gs_nack_address, 0xFFFFU);
+    }
+    stcc4_interface_delay_ms(ms);
+}
+#endif
 
 /**
  * @brief     read test
@@ -52,6 +75,8 @@ uint8_t stcc4_read_test(stcc4_address_t address, uint32_t times)
     uint8_t res;
     uint32_t i;
     stcc4_info_t info;
+    stcc4_periodic_t periodic;
+    stcc4_periodic_stats_t stats;
     
     /* link functions */
     DRIVER_STCC4_LINK_INIT(&gs_handle, stcc4_handle_t);
@@ -59,7 +84,11 @@ uint8_t stcc4_read_test(stcc4_address_t address, uint32_t times)
     DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle, stcc4_interface_iic_deinit);
     DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle, stcc4_interface_iic_write_cmd);
     DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle, stcc4_interface_iic_read_cmd);
+#ifdef STCC4_SIMULATOR
+    DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, a_stcc4_read_test_delay_ms);
+#else
     DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, stcc4_interface_delay_ms);
+#endif
     DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle, stcc4_interface_debug_print);
     
     /* stcc4 info */
@@ -118,6 +147,36 @@ uint8_t stcc4_read_test(stcc4_address_t address, uint32_t times)
         return 1;
     }
     
+    /* a blocking start must block the single shot begin */
+    {
+        stcc4_measure_state_t state;
+        uint32_t ready_ms;
+        
+        res = stcc4_get_measure_state(&gs_handle, &state);
+        if ((res != 0) || (state != STCC4_MEASURE_STATE_CONTINUOUS) ||
+            (stcc4_measure_single_shot_begin(&gs_handle, 0, &ready_ms) != 4))
+        {
+            stcc4_interface_debug_print("stcc4: continuous measure state check failed.\n");
+            (void)stcc4_stop_continuous_measurement(&gs_handle);
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: check continuous measure state ok.\n");
+    }
+    
+    /* sample half a period after the sensor update on absolute 1000ms deadlines */
+    stcc4_interface_delay_ms(500);
+    res = stcc4_periodic_init(&periodic, 1000, stcc4_interface_timestamp_us, stcc4_interface_sleep_until_us);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: periodic init failed.\n");
+        (void)stcc4_stop_continuous_measurement(&gs_handle);
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* loop */
     for (i = 0; i < times; i++)
     {
@@ -129,8 +188,8 @@ uint8_t stcc4_read_test(stcc4_address_t address, uint32_t times)
         float humidity_s;
         uint16_t sensor_status;
         
-        /* delay 1000ms */
-        stcc4_interface_delay_ms(1000);
+        /* wait for the next deadline */
+        (void)stcc4_periodic_wait(&periodic);
         
         /* read data */
         res = stcc4_read(&gs_handle, &co2_raw, &co2_ppm,
@@ -151,6 +210,12 @@ uint8_t stcc4_read_test(stcc4_address_t address, uint32_t times)
         stcc4_interface_debug_print("stcc4: sensor status is 0x%04X.\n", sensor_status);
     }
     
+    /* output the period stats */
+    (void)stcc4_periodic_get_stats(&periodic, &stats);
+    stcc4_interface_debug_print("stcc4: jitter min %dus, max %dus, mean %dus.\n", 
+                                stats.jitter_min_us, stats.jitter_max_us, stats.jitter_mean_us);
+    stcc4_interface_debug_print("stcc4: %d missed deadlines.\n", stats.missed);
+    
     /* stop continuous measurement */
     res = stcc4_stop_continuous_measurement(&gs_handle);
     if (res != 0)
@@ -207,6 +272,292 @@ uint8_t stcc4_read_test(stcc4_address_t address, uint32_t times)
         stcc4_interface_debug_print("stcc4: sensor status is 0x%04X.\n", sensor_status);
     }
     
+    /* polled measure single shot test */
+    stcc4_interface_debug_print("stcc4: polled measure single shot test.\n");
+    
+    /* poll from 50% of the worst case time with 5ms to 40ms back-off steps */
+    res = stcc4_set_ready_polling_backoff(&gs_handle, 50, 5, 40);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set ready polling backoff failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* enable ready polling */
+    res = stcc4_set_ready_polling(&gs_handle, STCC4_BOOL_TRUE);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set ready polling failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* loop */
+    for (i = 0; i < times; i++)
+    {
+        int16_t co2_raw;
+        int16_t co2_ppm;
+        uint16_t temperature_raw;
+        float temperature_s;
+        uint16_t humidity_raw;
+        float humidity_s;
+        uint16_t sensor_status;
+        uint32_t ready_ms;
+        
+        /* delay 1000ms */
+        stcc4_interface_delay_ms(1000);
+        
+        /* measure single shot */
+        res = stcc4_measure_single_shot(&gs_handle);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: measure single shot failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* read data */
+        res = stcc4_read(&gs_handle, &co2_raw, &co2_ppm,
+                         &temperature_raw, &temperature_s,
+                         &humidity_raw, &humidity_s, &sensor_status);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: read failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* get the observed ready time */
+        res = stcc4_get_observed_ready_time(&gs_handle, &ready_ms);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: get observed ready time failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        stcc4_interface_debug_print("stcc4: data is ready after %dms.\n", ready_ms);
+        stcc4_interface_debug_print("stcc4: co2 is %02dppm.\n", co2_ppm);
+        stcc4_interface_debug_print("stcc4: temperature is %0.2fC.\n", temperature_s);
+        stcc4_interface_debug_print("stcc4: humidity is %0.2f%%.\n", humidity_s);
+        stcc4_interface_debug_print("stcc4: sensor status is 0x%04X.\n", sensor_status);
+    }
+    
+#ifdef STCC4_SIMULATOR
+    /* a poll that runs out of the worst case time must fail the single shot */
+    stcc4_interface_debug_print("stcc4: polled measure single shot timeout test.\n");
+    stcc4_interface_delay_ms(1000);
+    gs_nack_address = address;
+    gs_nack_arm = 1;
+    res = stcc4_measure_single_shot(&gs_handle);
+    gs_nack_arm = 0;
+    (void)stcc4_simulator_inject_nack(address, 0);
+    if (res != 1)
+    {
+        stcc4_interface_debug_print("stcc4: polled timeout check failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: check polled timeout ok.\n");
+#endif
+    
+    /* disable ready polling */
+    res = stcc4_set_ready_polling(&gs_handle, STCC4_BOOL_FALSE);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set ready polling failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* non-blocking measure single shot test */
+    stcc4_interface_debug_print("stcc4: non-blocking measure single shot test.\n");
+    
+    /* loop */
+    for (i = 0; i < times; i++)
+    {
+        int16_t co2_raw;
+        int16_t co2_ppm;
+        uint16_t temperature_raw;
+        float temperature_s;
+        uint16_t humidity_raw;
+        float humidity_s;
+        uint16_t sensor_status;
+        uint32_t timestamp;
+        uint32_t ready;
+        
+        /* begin measure single shot */
+        timestamp = 0;
+        res = stcc4_measure_single_shot_begin(&gs_handle, timestamp, &ready);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: measure single shot begin failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* poll until the data is ready */
+        do
+        {
+            /* delay 10ms */
+            stcc4_interface_delay_ms(10);
+            timestamp += 10;
+            
+            /* poll data */
+            res = stcc4_measure_poll(&gs_handle, timestamp, &ready,
+                                     &co2_raw, &co2_ppm,
+                                     &temperature_raw, &temperature_s,
+                                     &humidity_raw, &humidity_s, &sensor_status);
+        } while (res == 6);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: measure poll failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        stcc4_interface_debug_print("stcc4: data is ready after %dms.\n", timestamp);
+        stcc4_interface_debug_print("stcc4: co2 is %02dppm.\n", co2_ppm);
+        stcc4_interface_debug_print("stcc4: temperature is %0.2fC.\n", temperature_s);
+        stcc4_interface_debug_print("stcc4: humidity is %0.2f%%.\n", humidity_s);
+        stcc4_interface_debug_print("stcc4: sensor status is 0x%04X.\n", sensor_status);
+    }
+    
+    /* fixed read test */
+    stcc4_interface_debug_print("stcc4: fixed read test.\n");
+    
+    /* start continuous measurement */
+    res = stcc4_start_continuous_measurement(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: start continuous measurement failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* loop */
+    for (i = 0; i < times; i++)
+    {
+        int16_t co2_raw;
+        int16_t co2_ppm;
+        uint16_t temperature_raw;
+        int32_t temperature_mdeg;
+        uint16_t humidity_raw;
+        int32_t humidity_mpercentage;
+        uint16_t sensor_status;
+        
+        /* delay 1000ms */
+        stcc4_interface_delay_ms(1000);
+        
+        /* read data */
+        res = stcc4_read_fixed(&gs_handle, &co2_raw, &co2_ppm,
+                               &temperature_raw, &temperature_mdeg,
+                               &humidity_raw, &humidity_mpercentage, &sensor_status);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: read fixed failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        stcc4_interface_debug_print("stcc4: co2 is %02dppm.\n", co2_ppm);
+        stcc4_interface_debug_print("stcc4: temperature is %dmC.\n", temperature_mdeg);
+        stcc4_interface_debug_print("stcc4: humidity is %dm%%.\n", humidity_mpercentage);
+        stcc4_interface_debug_print("stcc4: sensor status is 0x%04X.\n", sensor_status);
+    }
+    
+    /* stop continuous measurement */
+    res = stcc4_stop_continuous_measurement(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: stop continuous measurement failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* raw frame read test */
+    stcc4_interface_debug_print("stcc4: raw frame read test.\n");
+    
+    /* start continuous measurement */
+    res = stcc4_start_continuous_measurement(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: start continuous measurement failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* loop */
+    for (i = 0; i < times; i++)
+    {
+        int16_t co2_raw;
+        int16_t co2_ppm;
+        uint16_t temperature_raw;
+        float temperature_s;
+        uint16_t humidity_raw;
+        float humidity_s;
+        uint16_t sensor_status;
+        uint8_t frame[STCC4_RAW_FRAME_SIZE];
+        
+        /* delay 1000ms */
+        stcc4_interface_delay_ms(1000);
+        
+        /* read the raw frame with the crc check deferred */
+        res = stcc4_read_raw_frame(&gs_handle, frame, STCC4_BOOL_FALSE);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: read raw frame failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* decode the raw frame */
+        res = stcc4_decode_raw_frame(frame, STCC4_BOOL_TRUE, &co2_raw, &co2_ppm,
+                                     &temperature_raw, &temperature_s,
+                                     &humidity_raw, &humidity_s, &sensor_status);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: decode raw frame failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        stcc4_interface_debug_print("stcc4: co2 is %02dppm.\n", co2_ppm);
+        stcc4_interface_debug_print("stcc4: temperature is %0.2fC.\n", temperature_s);
+        stcc4_interface_debug_print("stcc4: humidity is %0.2f%%.\n", humidity_s);
+        stcc4_interface_debug_print("stcc4: sensor status is 0x%04X.\n", sensor_status);
+    }
+    
+    /* stop continuous measurement */
+    res = stcc4_stop_continuous_measurement(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: stop continuous measurement failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* finish read test */
     stcc4_interface_debug_print("stcc4: finish read test.\n");
     (void)stcc4_deinit(&gs_handle);
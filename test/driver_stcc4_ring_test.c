@@ -0,0 +1,317 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_ring_test.c
+ * @brief     driver stcc4 ring test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_ring_test.h"
+#include "driver_stcc4_bench_test.h"
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * @brief ring test benchmark definition
+ */
+#define RING_TEST_SAMPLES        1000000U        /**< samples per benchmark round */
+#define RING_TEST_BATCH          16U             /**< consumer batch size */
+
+static stcc4_ring_t gs_ring;                                  /**< ring */
+static stcc4_ring_sample_t gs_batch[STCC4_RING_SIZE];        /**< pop buffer */
+
+/**
+ * @brief     make a test sample
+ * @param[in] seq sequence number
+ * @param[in] stamp timestamp
+ * @return    sample
+ * @note      the sequence number is carried in the raw temperature and humidity
+ */
+static stcc4_ring_sample_t a_stcc4_ring_make(uint32_t seq, uint32_t stamp)
+{
+    stcc4_ring_sample_t sample;
+    
+    memset(&sample, 0, sizeof(stcc4_ring_sample_t));
+    sample.timestamp_us = stamp;
+    sample.temperature_raw = (uint16_t)(seq & 0xFFFFU);
+    sample.humidity_raw = (uint16_t)(seq >> 16);
+    
+    return sample;
+}
+
+/**
+ * @brief     get the sequence number of a test sample
+ * @param[in] *sample pointer to a sample structure
+ * @return    sequence number
+ * @note      none
+ */
+static uint32_t a_stcc4_ring_seq(const stcc4_ring_sample_t *sample)
+{
+    return ((uint32_t)sample->humidity_raw << 16) | sample->temperature_raw;
+}
+
+#if defined(__linux__)
+
+/**
+ * @brief ring benchmark producer structure definition
+ */
+typedef struct ring_test_producer_s
+{
+    uint32_t count;         /**< samples to push */
+    uint32_t full;          /**< pushes refused by a full ring */
+} ring_test_producer_t;
+
+/**
+ * @brief     ring benchmark producer thread
+ * @param[in] *arg pointer to a producer structure
+ * @return    NULL
+ * @note      the benchmark stores the low 32 bits of a ns clock in the timestamp,
+ *            a full ring is retried after a yield so every sample reaches the consumer
+ */
+static void *a_stcc4_ring_producer(void *arg)
+{
+    ring_test_producer_t *producer = (ring_test_producer_t *)arg;
+    stcc4_ring_sample_t sample;
+    uint32_t i;
+    
+    for (i = 0; i < producer->count; i++)
+    {
+        sample = a_stcc4_ring_make(i, (uint32_t)stcc4_bench_test_ns());
+        while (stcc4_ring_push(&gs_ring, &sample) != 0)
+        {
+            producer->full++;
+            (void)sched_yield();
+            sample.timestamp_us = (uint32_t)stcc4_bench_test_ns();
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief  run one contention benchmark round
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_stcc4_ring_benchmark(void)
+{
+    pthread_t thread;
+    ring_test_producer_t producer;
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t latency_sum;
+    uint32_t latency_min;
+    uint32_t latency_max;
+    uint32_t latency;
+    uint32_t expect;
+    uint32_t batches;
+    uint32_t num;
+    uint32_t i;
+    
+    (void)stcc4_ring_init(&gs_ring);
+    producer.count = RING_TEST_SAMPLES;
+    producer.full = 0;
+    latency_sum = 0;
+    latency_min = 0xFFFFFFFFU;
+    latency_max = 0;
+    expect = 0;
+    batches = 0;
+    start = stcc4_bench_test_ns();
+    if (pthread_create(&thread, NULL, a_stcc4_ring_producer, &producer) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: create producer failed.\n");
+        
+        return 1;
+    }
+    while (expect < RING_TEST_SAMPLES)
+    {
+        if (stcc4_ring_pop(&gs_ring, gs_batch, RING_TEST_BATCH, &num) != 0)
+        {
+            (void)sched_yield();
+            
+            continue;
+        }
+        batches++;
+        for (i = 0; i < num; i++)
+        {
+            if (a_stcc4_ring_seq(&gs_batch[i]) != expect)
+            {
+                stcc4_interface_debug_print("stcc4: sample %d out of order.\n", expect);
+                (void)pthread_join(thread, NULL);
+                
+                return 1;
+            }
+            latency = (uint32_t)stcc4_bench_test_ns() - gs_batch[i].timestamp_us;
+            latency_sum += latency;
+            if (latency < latency_min)
+            {
+                latency_min = latency;
+            }
+            if (latency > latency_max)
+            {
+                latency_max = latency;
+            }
+            expect++;
+        }
+    }
+    elapsed = stcc4_bench_test_ns() - start;
+    (void)pthread_join(thread, NULL);
+    
+    /* output */
+    stcc4_interface_debug_print("stcc4: %d samples in %d batches, %d full pushes.\n",
+                                RING_TEST_SAMPLES, batches, producer.full);
+    stcc4_interface_debug_print("stcc4: throughput %d samples/s.\n",
+                                (uint32_t)((uint64_t)RING_TEST_SAMPLES * 1000000000ULL / (elapsed + 1)));
+    stcc4_interface_debug_print("stcc4: latency min %d ns max %d ns mean %d ns.\n",
+                                latency_min, latency_max, (uint32_t)(latency_sum / RING_TEST_SAMPLES));
+    
+    return 0;
+}
+
+#endif
+
+/**
+ * @brief     ring test
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the contention benchmark needs linux
+ */
+uint8_t stcc4_ring_test(uint32_t times)
+{
+    stcc4_ring_sample_t sample;
+    uint32_t overrun;
+    uint32_t num;
+    uint32_t i;
+    uint32_t j;
+    
+    /* start ring test */
+    stcc4_interface_debug_print("stcc4: start ring test.\n");
+    stcc4_interface_debug_print("stcc4: ring size is %d, ring struct is %d bytes.\n",
+                                STCC4_RING_SIZE, (uint32_t)sizeof(stcc4_ring_t));
+    
+    /* empty ring */
+    stcc4_interface_debug_print("stcc4: empty ring test.\n");
+    if (stcc4_ring_init(&gs_ring) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: init failed.\n");
+        
+        return 1;
+    }
+    if (stcc4_ring_pop(&gs_ring, gs_batch, STCC4_RING_SIZE, &num) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: empty pop check failed.\n");
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: check empty pop %s.\n", num == 0 ? "ok" : "error");
+    
+    /* full ring and overrun */
+    stcc4_interface_debug_print("stcc4: overrun test.\n");
+    for (i = 0; i < STCC4_RING_SIZE + 3; i++)
+    {
+        sample = a_stcc4_ring_make(i, i);
+        if ((stcc4_ring_push(&gs_ring, &sample) == 0) != (i < STCC4_RING_SIZE))
+        {
+            stcc4_interface_debug_print("stcc4: push %d check failed.\n", i);
+            
+            return 1;
+        }
+    }
+    (void)stcc4_ring_get_overrun(&gs_ring, &overrun);
+    if (overrun != 3)
+    {
+        stcc4_interface_debug_print("stcc4: overrun check failed.\n");
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: check overrun ok.\n");
+    
+    /* batch pop across the wrap */
+    stcc4_interface_debug_print("stcc4: batch pop test.\n");
+    if ((stcc4_ring_pop(&gs_ring, gs_batch, 5, &num) != 0) || (num != 5) ||
+        (a_stcc4_ring_seq(&gs_batch[0]) != 0) || (a_stcc4_ring_seq(&gs_batch[4]) != 4))
+    {
+        stcc4_interface_debug_print("stcc4: batch pop check failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 5; i++)
+    {
+        sample = a_stcc4_ring_make(STCC4_RING_SIZE + i, 0);
+        if (stcc4_ring_push(&gs_ring, &sample) != 0)
+        {
+            stcc4_interface_debug_print("stcc4: wrap push check failed.\n");
+            
+            return 1;
+        }
+    }
+    if ((stcc4_ring_pop(&gs_ring, gs_batch, STCC4_RING_SIZE, &num) != 0) || (num != STCC4_RING_SIZE))
+    {
+        stcc4_interface_debug_print("stcc4: wrap pop check failed.\n");
+        
+        return 1;
+    }
+    for (j = 0; j < num; j++)
+    {
+        if (a_stcc4_ring_seq(&gs_batch[j]) != j + 5)
+        {
+            stcc4_interface_debug_print("stcc4: wrap order check failed.\n");
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: check batch pop ok.\n");
+    
+#if defined(__linux__)
+    /* contention benchmark */
+    stcc4_interface_debug_print("stcc4: contention benchmark test.\n");
+    for (i = 0; i < times; i++)
+    {
+        if (a_stcc4_ring_benchmark() != 0)
+        {
+            return 1;
+        }
+    }
+#else
+    (void)times;
+#endif
+    
+    /* finish ring test */
+    stcc4_interface_debug_print("stcc4: finish ring test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,325 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_rollup_test.c
+ * @brief     driver stcc4 rollup test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_rollup_test.h"
+#include "driver_stcc4_bench_test.h"
+
+/**
+ * @brief rollup test definition
+ */
+#define ROLLUP_TEST_SAMPLES        9000        /**< samples of the checked sensor */
+#define ROLLUP_TEST_HOUR           3600        /**< one hour of 1 Hz samples */
+
+/**
+ * @brief rollup test sample structure definition
+ */
+typedef struct rollup_test_sample_s
+{
+    uint32_t timestamp;                             /**< time in s */
+    int32_t value[STCC4_ROLLUP_CHANNEL_MAX];        /**< channel values */
+} rollup_test_sample_t;
+
+static stcc4_rollup_t gs_rollup;                                  /**< rollup */
+static rollup_test_sample_t gs_sample[ROLLUP_TEST_SAMPLES];       /**< raw history of sensor 0 */
+static uint32_t gs_num;                                           /**< raw history length */
+static uint32_t gs_emitted[STCC4_ROLLUP_LEVELS];                  /**< emitted buckets */
+static uint8_t gs_error;                                          /**< emit check error */
+static uint32_t gs_seed;                                          /**< random seed */
+static const uint32_t gs_width[3] = {60, 3600, 86400};            /**< minute, hour and day */
+
+/**
+ * @brief      compute a bucket from the raw history
+ * @param[in]  start bucket start
+ * @param[in]  width bucket width
+ * @param[out] *bucket pointer to a bucket structure
+ * @note       none
+ */
+static void a_stcc4_rollup_brute(uint32_t start, uint32_t width, stcc4_rollup_bucket_t *bucket)
+{
+    uint32_t i;
+    uint8_t c;
+    
+    memset(bucket, 0, sizeof(stcc4_rollup_bucket_t));
+    bucket->start = start;
+    bucket->width = width;
+    for (i = 0; i < gs_num; i++)
+    {
+        if ((gs_sample[i].timestamp < start) || (gs_sample[i].timestamp - start >= width))
+        {
+            continue;
+        }
+        for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+        {
+            if ((bucket->count == 0) || (gs_sample[i].value[c] < bucket->min[c]))
+            {
+                bucket->min[c] = gs_sample[i].value[c];
+            }
+            if ((bucket->count == 0) || (gs_sample[i].value[c] > bucket->max[c]))
+            {
+                bucket->max[c] = gs_sample[i].value[c];
+            }
+            bucket->last[c] = gs_sample[i].value[c];
+            bucket->sum[c] += gs_sample[i].value[c];
+        }
+        bucket->count++;
+    }
+    for (c = 0; (c < STCC4_ROLLUP_CHANNEL_MAX) && (bucket->count != 0); c++)
+    {
+        bucket->mean[c] = (int32_t)(bucket->sum[c] / (int64_t)bucket->count);
+    }
+}
+
+/**
+ * @brief     compare a bucket with the raw history
+ * @param[in] *bucket pointer to a bucket structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_stcc4_rollup_check(const stcc4_rollup_bucket_t *bucket)
+{
+    stcc4_rollup_bucket_t expect;
+    uint8_t c;
+    
+    a_stcc4_rollup_brute(bucket->start, bucket->width, &expect);
+    if (expect.count != bucket->count)
+    {
+        return 1;
+    }
+    for (c = 0; c < STCC4_ROLLUP_CHANNEL_MAX; c++)
+    {
+        if ((expect.min[c] != bucket->min[c]) || (expect.max[c] != bucket->max[c]) || (expect.mean[c] != bucket->mean[c]) ||
+            (expect.last[c] != bucket->last[c]) || (expect.sum[c] != bucket->sum[c]))
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     closed bucket callback
+ * @param[in] level level index
+ * @param[in] sensor sensor index
+ * @param[in] *bucket pointer to a bucket structure
+ * @note      sensor 0 buckets are checked against the raw history
+ */
+static void a_stcc4_rollup_emit(uint8_t level, uint16_t sensor, const stcc4_rollup_bucket_t *bucket)
+{
+    if (sensor != 0)
+    {
+        return;
+    }
+    gs_emitted[level]++;
+    if (a_stcc4_rollup_check(bucket) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: level %d bucket at %d check failed.\n", level, bucket->start);
+        gs_error = 1;
+    }
+}
+
+/**
+ * @brief  run one benchmark round
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   a fleet of STCC4_ROLLUP_SENSORS sensors fed one hour of 1 Hz samples
+ */
+static uint8_t a_stcc4_rollup_benchmark(void)
+{
+    stcc4_rollup_bucket_t bucket;
+    uint64_t start;
+    uint64_t update_ns;
+    uint64_t query_ns;
+    uint64_t scan_ns;
+    int64_t sum;
+    uint32_t t;
+    uint32_t i;
+    uint16_t s;
+    
+    if (stcc4_rollup_init(&gs_rollup, STCC4_ROLLUP_SENSORS, gs_width, 3, NULL) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: rollup init failed.\n");
+        
+        return 1;
+    }
+    
+    /* update */
+    start = stcc4_bench_test_ns();
+    for (t = 0; t < ROLLUP_TEST_HOUR; t++)
+    {
+        for (s = 0; s < STCC4_ROLLUP_SENSORS; s++)
+        {
+            (void)stcc4_rollup_update(&gs_rollup, s, 1760000000U + t, 800 + (int32_t)(t & 63), 23000 + (int32_t)s, 45000);
+        }
+    }
+    update_ns = stcc4_bench_test_ns() - start;
+    
+    /* query the open hour of every sensor */
+    start = stcc4_bench_test_ns();
+    sum = 0;
+    for (s = 0; s < STCC4_ROLLUP_SENSORS; s++)
+    {
+        (void)stcc4_rollup_query(&gs_rollup, 1, s, &bucket);
+        sum += bucket.max[STCC4_ROLLUP_CHANNEL_CO2];
+    }
+    query_ns = stcc4_bench_test_ns() - start;
+    
+    /* the same answer from an hour of raw samples of one sensor */
+    gs_num = 0;
+    for (i = 0; i < ROLLUP_TEST_HOUR; i++)
+    {
+        gs_sample[gs_num].timestamp = 1760000000U + i;
+        gs_sample[gs_num].value[STCC4_ROLLUP_CHANNEL_CO2] = 800 + (int32_t)(i & 63);
+        gs_sample[gs_num].value[STCC4_ROLLUP_CHANNEL_TEMPERATURE] = 23000;
+        gs_sample[gs_num].value[STCC4_ROLLUP_CHANNEL_HUMIDITY] = 45000;
+        gs_num++;
+    }
+    start = stcc4_bench_test_ns();
+    a_stcc4_rollup_brute(1760000000U - 1760000000U % 3600, 3600, &bucket);
+    scan_ns = stcc4_bench_test_ns() - start;
+    
+    /* output */
+    stcc4_interface_debug_print("stcc4: %d sensors, %d updates in %d us, %d ns/update.\n",
+                                STCC4_ROLLUP_SENSORS, STCC4_ROLLUP_SENSORS * ROLLUP_TEST_HOUR, (uint32_t)(update_ns / 1000),
+                                (uint32_t)(update_ns / ((uint64_t)STCC4_ROLLUP_SENSORS * ROLLUP_TEST_HOUR)));
+    stcc4_interface_debug_print("stcc4: open hour query %d ns/sensor, raw hour scan %d ns/sensor, checksum %d.\n",
+                                (uint32_t)(query_ns / STCC4_ROLLUP_SENSORS), (uint32_t)scan_ns, (int32_t)(sum & 0x7FFFFFFF));
+    
+    return 0;
+}
+
+/**
+ * @brief     rollup test
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t stcc4_rollup_test(uint32_t times)
+{
+    stcc4_rollup_bucket_t bucket;
+    uint32_t t;
+    uint32_t i;
+    uint8_t l;
+    
+    /* start rollup test */
+    stcc4_interface_debug_print("stcc4: start rollup test.\n");
+    stcc4_interface_debug_print("stcc4: rollup struct is %d bytes for %d sensors.\n",
+                                (uint32_t)sizeof(stcc4_rollup_t), STCC4_ROLLUP_SENSORS);
+    
+    /* init checks */
+    if (stcc4_rollup_init(&gs_rollup, 2, (const uint32_t[]){60, 90}, 2, NULL) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: width check failed.\n");
+        
+        return 1;
+    }
+    if (stcc4_rollup_init(&gs_rollup, 2, gs_width, 2, a_stcc4_rollup_emit) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: rollup init failed.\n");
+        
+        return 1;
+    }
+    if ((stcc4_rollup_query(&gs_rollup, 1, 0, &bucket) != 0) || (bucket.count != 0))
+    {
+        stcc4_interface_debug_print("stcc4: empty query check failed.\n");
+        
+        return 1;
+    }
+    
+    /* buckets against the raw history */
+    stcc4_interface_debug_print("stcc4: bucket test.\n");
+    gs_seed = 0x2545F491U;
+    gs_num = 0;
+    gs_error = 0;
+    memset(gs_emitted, 0, sizeof(gs_emitted));
+    t = 1760000000U + 1234;
+    for (i = 0; i < ROLLUP_TEST_SAMPLES; i++)
+    {
+        t += (stcc4_bench_test_random(&gs_seed, 100) == 0) ? 1 + stcc4_bench_test_random(&gs_seed, 200) : 1;
+        gs_sample[i].timestamp = t;
+        gs_sample[i].value[STCC4_ROLLUP_CHANNEL_CO2] = 400 + (int32_t)stcc4_bench_test_random(&gs_seed, 2000);
+        gs_sample[i].value[STCC4_ROLLUP_CHANNEL_TEMPERATURE] = -5000 + (int32_t)stcc4_bench_test_random(&gs_seed, 40000);
+        gs_sample[i].value[STCC4_ROLLUP_CHANNEL_HUMIDITY] = (int32_t)stcc4_bench_test_random(&gs_seed, 100000);
+        gs_num = i + 1;
+        if ((stcc4_rollup_update(&gs_rollup, 0, t, gs_sample[i].value[0], gs_sample[i].value[1], gs_sample[i].value[2]) != 0) ||
+            (stcc4_rollup_update(&gs_rollup, 1, t, 0, 0, 0) != 0))
+        {
+            stcc4_interface_debug_print("stcc4: update failed.\n");
+            
+            return 1;
+        }
+        if (gs_error != 0)
+        {
+            return 1;
+        }
+    }
+    if (stcc4_rollup_update(&gs_rollup, 0, t - 120, 0, 0, 0) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: old sample check failed.\n");
+        
+        return 1;
+    }
+    for (l = 0; l < 2; l++)
+    {
+        if ((stcc4_rollup_query(&gs_rollup, l, 0, &bucket) != 0) || (bucket.count == 0) || (a_stcc4_rollup_check(&bucket) != 0))
+        {
+            stcc4_interface_debug_print("stcc4: level %d open bucket check failed.\n", l);
+            
+            return 1;
+        }
+    }
+    stcc4_interface_debug_print("stcc4: %d minute and %d hour buckets checked.\n", gs_emitted[0], gs_emitted[1]);
+    
+    /* fleet benchmark */
+    stcc4_interface_debug_print("stcc4: fleet benchmark test.\n");
+    for (i = 0; i < times; i++)
+    {
+        if (a_stcc4_rollup_benchmark() != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* finish rollup test */
+    stcc4_interface_debug_print("stcc4: finish rollup test.\n");
+    
+    return 0;
+}
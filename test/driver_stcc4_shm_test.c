@@ -0,0 +1,338 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_shm_test.c
+ * @brief     driver stcc4 shm test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_shm_test.h"
+#include "driver_stcc4_bench_test.h"
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * @brief shm test definition
+ */
+#define SHM_TEST_NAME            "/stcc4_shm_test"        /**< test segment name */
+#define SHM_TEST_READERS         16                       /**< max reader processes */
+#define SHM_TEST_DURATION_MS     100                      /**< reader run time in ms */
+
+/**
+ * @brief shm test reader result structure definition
+ */
+typedef struct shm_test_result_s
+{
+    uint64_t reads;         /**< successful reads */
+    uint32_t torn;          /**< inconsistent samples */
+} shm_test_result_t;
+
+/**
+ * @brief     make a test sample
+ * @param[in] count sample number
+ * @param[out] *sample pointer to a sample structure
+ * @note      every field is derived from the count so a torn read is visible
+ */
+static void a_stcc4_shm_make(uint32_t count, stcc4_shm_sample_t *sample)
+{
+    memset(sample, 0, sizeof(stcc4_shm_sample_t));
+    sample->timestamp_us = count * 3U;
+    sample->count = count;
+    sample->co2_ppm = (int16_t)(count & 0x7FFF);
+    sample->sensor_status = (uint16_t)(count >> 15);
+    sample->temperature = (float)(count & 0xFFFF);
+    sample->humidity = (float)(count & 0xFF);
+}
+
+/**
+ * @brief     check a test sample
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 consistent
+ *            - 1 torn
+ * @note      none
+ */
+static uint8_t a_stcc4_shm_check(const stcc4_shm_sample_t *sample)
+{
+    stcc4_shm_sample_t expect;
+    
+    a_stcc4_shm_make(sample->count, &expect);
+    
+    return (memcmp(&expect, sample, sizeof(stcc4_shm_sample_t)) == 0) ? 0 : 1;
+}
+
+/**
+ * @brief     reader process body
+ * @param[in] *result pointer to a shared result structure
+ * @note      never returns
+ */
+static void a_stcc4_shm_reader(shm_test_result_t *result)
+{
+    stcc4_shm_t shm;
+    stcc4_shm_sample_t sample;
+    uint64_t reads;
+    uint64_t stop;
+    uint32_t torn;
+    uint32_t i;
+    
+    if (stcc4_shm_open(&shm, SHM_TEST_NAME) != 0)
+    {
+        _exit(1);
+    }
+    reads = 0;
+    torn = 0;
+    stop = stcc4_bench_test_ns() + (uint64_t)SHM_TEST_DURATION_MS * 1000000ULL;
+    while (stcc4_bench_test_ns() < stop)
+    {
+        for (i = 0; i < 1024; i++)
+        {
+            if (stcc4_shm_read(&shm, &sample) == 0)
+            {
+                reads++;
+                torn += a_stcc4_shm_check(&sample);
+            }
+        }
+    }
+    result->reads = reads;
+    result->torn = torn;
+    (void)stcc4_shm_close(&shm);
+    
+    _exit(0);
+}
+
+/**
+ * @brief     run one benchmark with num readers
+ * @param[in] *shm pointer to a writer shm structure
+ * @param[in] *result pointer to a shared result array
+ * @param[in] num reader number
+ * @param[in,out] *count pointer to a publish counter
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the parent publishes as fast as it can while the readers run
+ */
+static uint8_t a_stcc4_shm_benchmark(stcc4_shm_t *shm, shm_test_result_t *result, uint32_t num, uint32_t *count)
+{
+    stcc4_shm_sample_t sample;
+    pid_t pid[SHM_TEST_READERS];
+    uint64_t reads;
+    uint32_t publishes;
+    uint32_t running;
+    uint32_t torn;
+    uint32_t i;
+    int status;
+    uint8_t res;
+    
+    memset(result, 0, sizeof(shm_test_result_t) * SHM_TEST_READERS);
+    for (i = 0; i < num; i++)
+    {
+        pid[i] = fork();
+        if (pid[i] == 0)
+        {
+            a_stcc4_shm_reader(&result[i]);
+        }
+        if (pid[i] < 0)
+        {
+            stcc4_interface_debug_print("stcc4: fork failed.\n");
+            num = i;
+            
+            break;
+        }
+    }
+    
+    /* publish until every reader exits */
+    res = 0;
+    publishes = 0;
+    running = num;
+    while (running != 0)
+    {
+        for (i = 0; i < 1024; i++)
+        {
+            a_stcc4_shm_make(++(*count), &sample);
+            (void)stcc4_shm_publish(shm, &sample);
+        }
+        publishes += 1024;
+        for (i = 0; i < num; i++)
+        {
+            if ((pid[i] > 0) && (waitpid(pid[i], &status, WNOHANG) == pid[i]))
+            {
+                if ((!WIFEXITED(status)) || (WEXITSTATUS(status) != 0))
+                {
+                    res = 1;
+                }
+                pid[i] = 0;
+                running--;
+            }
+        }
+    }
+    if ((res != 0) || (num == 0))
+    {
+        stcc4_interface_debug_print("stcc4: reader failed.\n");
+        
+        return 1;
+    }
+    
+    /* sum the readers */
+    reads = 0;
+    torn = 0;
+    for (i = 0; i < num; i++)
+    {
+        reads += result[i].reads;
+        torn += result[i].torn;
+    }
+    stcc4_interface_debug_print("stcc4: %d readers, %d kreads/s total, %d kreads/s per reader, %d publishes.\n",
+                                num, (uint32_t)(reads / SHM_TEST_DURATION_MS),
+                                (uint32_t)(reads / SHM_TEST_DURATION_MS / num), publishes);
+    if (torn != 0)
+    {
+        stcc4_interface_debug_print("stcc4: %d torn samples.\n", torn);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     shm test
+ * @param[in] times benchmark rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      each round runs 1, 2, 4, 8 and 16 reader processes
+ */
+uint8_t stcc4_shm_test(uint32_t times)
+{
+    stcc4_shm_t writer;
+    stcc4_shm_t reader;
+    stcc4_shm_sample_t sample;
+    shm_test_result_t *result;
+    uint32_t count;
+    uint32_t num;
+    uint32_t i;
+    
+    /* start shm test */
+    stcc4_interface_debug_print("stcc4: start shm test.\n");
+    (void)stcc4_shm_unlink(SHM_TEST_NAME);
+    
+    /* publish and read */
+    stcc4_interface_debug_print("stcc4: publish and read test.\n");
+    if (stcc4_shm_open(&reader, SHM_TEST_NAME) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: open a missing segment check failed.\n");
+        (void)stcc4_shm_close(&reader);
+        
+        return 1;
+    }
+    if (stcc4_shm_create(&writer, SHM_TEST_NAME) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: create failed.\n");
+        
+        return 1;
+    }
+    if (stcc4_shm_open(&reader, SHM_TEST_NAME) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: open failed.\n");
+        (void)stcc4_shm_close(&writer);
+        (void)stcc4_shm_unlink(SHM_TEST_NAME);
+        
+        return 1;
+    }
+    if (stcc4_shm_read(&reader, &sample) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: read before publish check failed.\n");
+        (void)stcc4_shm_close(&reader);
+        (void)stcc4_shm_close(&writer);
+        (void)stcc4_shm_unlink(SHM_TEST_NAME);
+        
+        return 1;
+    }
+    count = 1;
+    a_stcc4_shm_make(count, &sample);
+    (void)stcc4_shm_publish(&writer, &sample);
+    memset(&sample, 0, sizeof(stcc4_shm_sample_t));
+    if ((stcc4_shm_read(&reader, &sample) != 0) || (sample.count != 1) || (a_stcc4_shm_check(&sample) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: read check failed.\n");
+        (void)stcc4_shm_close(&reader);
+        (void)stcc4_shm_close(&writer);
+        (void)stcc4_shm_unlink(SHM_TEST_NAME);
+        
+        return 1;
+    }
+    if (stcc4_shm_publish(&reader, &sample) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: reader publish check failed.\n");
+        (void)stcc4_shm_close(&reader);
+        (void)stcc4_shm_close(&writer);
+        (void)stcc4_shm_unlink(SHM_TEST_NAME);
+        
+        return 1;
+    }
+    (void)stcc4_shm_close(&reader);
+    stcc4_interface_debug_print("stcc4: check publish and read ok.\n");
+    
+    /* reader benchmark */
+    stcc4_interface_debug_print("stcc4: reader benchmark test.\n");
+    result = (shm_test_result_t *)mmap(NULL, sizeof(shm_test_result_t) * SHM_TEST_READERS, PROT_READ | PROT_WRITE,
+                                       MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (result == MAP_FAILED)
+    {
+        stcc4_interface_debug_print("stcc4: map result failed.\n");
+        (void)stcc4_shm_close(&writer);
+        (void)stcc4_shm_unlink(SHM_TEST_NAME);
+        
+        return 1;
+    }
+    for (i = 0; i < times; i++)
+    {
+        for (num = 1; num <= SHM_TEST_READERS; num *= 2)
+        {
+            if (a_stcc4_shm_benchmark(&writer, result, num, &count) != 0)
+            {
+                (void)munmap(result, sizeof(shm_test_result_t) * SHM_TEST_READERS);
+                (void)stcc4_shm_close(&writer);
+                (void)stcc4_shm_unlink(SHM_TEST_NAME);
+                
+                return 1;
+            }
+        }
+    }
+    (void)munmap(result, sizeof(shm_test_result_t) * SHM_TEST_READERS);
+    (void)stcc4_shm_close(&writer);
+    (void)stcc4_shm_unlink(SHM_TEST_NAME);
+    
+    /* finish shm test */
+    stcc4_interface_debug_print("stcc4: finish shm test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,511 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_simulator_test.c
+ * @brief     driver stcc4 simulator test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "driver_stcc4_simulator_test.h"
+#include "driver_stcc4_interface_simulator.h"
+#include "driver_stcc4_bench_test.h"
+
+static stcc4_handle_t gs_handle;        /**< stcc4 handle */
+
+/**
+ * @brief  get the virtual time
+ * @return virtual time in ms
+ * @note   none
+ */
+static uint32_t a_stcc4_simulator_now(void)
+{
+    uint32_t ms;
+    
+    (void)stcc4_simulator_get_time_ms(&ms);
+    
+    return ms;
+}
+
+/**
+ * @brief     check the elapsed virtual time
+ * @param[in] *name pointer to a step name buffer
+ * @param[in] start step start time in ms
+ * @param[in] expect expected step time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_stcc4_simulator_check_time(const char *name, uint32_t start, uint32_t expect)
+{
+    uint32_t elapsed;
+    
+    elapsed = a_stcc4_simulator_now() - start;
+    stcc4_interface_debug_print("stcc4: %s took %dms, expect %dms.\n", name, elapsed, expect);
+    if (elapsed != expect)
+    {
+        stcc4_interface_debug_print("stcc4: %s check failed.\n", name);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     check the ready edge of a busy command
+ * @param[in] *name pointer to a step name buffer
+ * @param[in] reg command
+ * @param[in] busy_ms busy time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the device must nack one ms before the busy time and answer at the busy time
+ */
+static uint8_t a_stcc4_simulator_check_busy(const char *name, uint16_t reg, uint32_t busy_ms)
+{
+    uint32_t product_id;
+    uint8_t unique_serial_number[8];
+    
+    if (stcc4_set_reg(&gs_handle, reg, NULL, 0) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: %s set reg failed.\n", name);
+        
+        return 1;
+    }
+    stcc4_interface_delay_ms(busy_ms - 1);
+    if (stcc4_get_product_id(&gs_handle, &product_id, unique_serial_number) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: %s answered after %dms.\n", name, busy_ms - 1);
+        
+        return 1;
+    }
+    stcc4_interface_delay_ms(1);
+    if (stcc4_get_product_id(&gs_handle, &product_id, unique_serial_number) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: %s did not answer after %dms.\n", name, busy_ms);
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: %s ready after %dms.\n", name, busy_ms);
+    
+    return 0;
+}
+
+/**
+ * @brief  read one sample
+ * @return status code
+ *         - 0 success
+ *         - 1 read failed
+ * @note   none
+ */
+static uint8_t a_stcc4_simulator_read(void)
+{
+    int16_t co2_raw;
+    int16_t co2_ppm;
+    uint16_t temperature_raw;
+    float temperature_s;
+    uint16_t humidity_raw;
+    float humidity_s;
+    uint16_t sensor_status;
+    
+    return stcc4_read(&gs_handle, &co2_raw, &co2_ppm, &temperature_raw, &temperature_s,
+                      &humidity_raw, &humidity_s, &sensor_status);
+}
+
+/**
+ * @brief     simulator test
+ * @param[in] address address pin
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      checks the command timing of the simulated device against its virtual clock
+ */
+uint8_t stcc4_simulator_test(stcc4_address_t address)
+{
+    uint8_t res;
+    uint16_t result;
+    uint32_t start;
+    uint32_t begin;
+    uint32_t ready_ms;
+    uint32_t product_id;
+    uint8_t unique_serial_number[8];
+    uint64_t wall;
+    
+    /* link functions */
+    DRIVER_STCC4_LINK_INIT(&gs_handle, stcc4_handle_t);
+    DRIVER_STCC4_LINK_IIC_INIT(&gs_handle, stcc4_interface_iic_init);
+    DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle, stcc4_interface_iic_deinit);
+    DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle, stcc4_interface_iic_write_cmd);
+    DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle, stcc4_interface_iic_read_cmd);
+    DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, stcc4_interface_delay_ms);
+    DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle, stcc4_interface_debug_print);
+    
+    /* start simulator test */
+    stcc4_interface_debug_print("stcc4: start simulator test.\n");
+    stcc4_simulator_power_on();
+    wall = stcc4_bench_test_ns();
+    begin = a_stcc4_simulator_now();
+    
+    /* set address pin */
+    res = stcc4_set_address_pin(&gs_handle, address);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set address pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* stcc4 init */
+    start = a_stcc4_simulator_now();
+    res = stcc4_init(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: init failed.\n");
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_check_time("init", start, 11) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* busy edges */
+    if (a_stcc4_simulator_check_busy("conditioning", 0x29BCU, 22000) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* single shot edge */
+    stcc4_interface_debug_print("stcc4: single shot test.\n");
+    res = stcc4_set_reg(&gs_handle, 0x219DU, NULL, 0);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set reg failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    stcc4_interface_delay_ms(499);
+    if (a_stcc4_simulator_read() == 0)
+    {
+        stcc4_interface_debug_print("stcc4: single shot answered after 499ms.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    stcc4_interface_delay_ms(1);
+    if (a_stcc4_simulator_read() != 0)
+    {
+        stcc4_interface_debug_print("stcc4: single shot did not answer after 500ms.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_read() == 0)
+    {
+        stcc4_interface_debug_print("stcc4: single shot answered twice.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    start = a_stcc4_simulator_now();
+    res = stcc4_measure_single_shot(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: measure single shot failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_check_time("single shot", start, 500) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_read() != 0)
+    {
+        stcc4_interface_debug_print("stcc4: read failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* polled single shot */
+    stcc4_interface_debug_print("stcc4: polled single shot test.\n");
+    if ((stcc4_simulator_set_single_shot_time(address, 320) != 0) ||
+        (stcc4_set_ready_polling_backoff(&gs_handle, 50, 5, 40) != 0) ||
+        (stcc4_set_ready_polling(&gs_handle, STCC4_BOOL_TRUE) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: set ready polling failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    start = a_stcc4_simulator_now();
+    res = stcc4_measure_single_shot(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: measure single shot failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* polls at 250, 255, 265, 285 and 325ms, the last one acks and reads 1ms later */
+    if (a_stcc4_simulator_check_time("polled single shot", start, 326) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = stcc4_get_observed_ready_time(&gs_handle, &ready_ms);
+    if ((res != 0) || (ready_ms != 326))
+    {
+        stcc4_interface_debug_print("stcc4: observed ready time check failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_read() != 0)
+    {
+        stcc4_interface_debug_print("stcc4: polled frame is missing.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_read() == 0)
+    {
+        stcc4_interface_debug_print("stcc4: polled frame answered twice.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((stcc4_set_ready_polling(&gs_handle, STCC4_BOOL_FALSE) != 0) ||
+        (stcc4_simulator_set_single_shot_time(address, 500) != 0))
+    {
+        stcc4_interface_debug_print("stcc4: set ready polling failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* continuous edge */
+    stcc4_interface_debug_print("stcc4: continuous test.\n");
+    start = a_stcc4_simulator_now();
+    res = stcc4_start_continuous_measurement(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: start continuous measurement failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_check_time("start continuous", start, 1000) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_read() != 0)
+    {
+        stcc4_interface_debug_print("stcc4: first sample is missing.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_read() == 0)
+    {
+        stcc4_interface_debug_print("stcc4: sample answered twice.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    stcc4_interface_delay_ms(start + 1999 - a_stcc4_simulator_now());
+    if (a_stcc4_simulator_read() == 0)
+    {
+        stcc4_interface_debug_print("stcc4: sample answered after 999ms.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_read() != 0)
+    {
+        stcc4_interface_debug_print("stcc4: sample did not answer after 1000ms.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    start = a_stcc4_simulator_now();
+    res = stcc4_stop_continuous_measurement(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: stop continuous measurement failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_check_time("stop continuous", start, 1200) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* sleep */
+    stcc4_interface_debug_print("stcc4: sleep test.\n");
+    res = stcc4_enter_sleep_mode(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: enter sleep mode failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (stcc4_get_product_id(&gs_handle, &product_id, unique_serial_number) == 0)
+    {
+        stcc4_interface_debug_print("stcc4: sleeping device answered.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    start = a_stcc4_simulator_now();
+    res = stcc4_exit_sleep_mode(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: exit sleep mode failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_check_time("exit sleep", start, 5) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (stcc4_get_product_id(&gs_handle, &product_id, unique_serial_number) != 0)
+    {
+        stcc4_interface_debug_print("stcc4: device did not wake up.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* self test and factory reset */
+    start = a_stcc4_simulator_now();
+    res = stcc4_perform_self_test(&gs_handle, &result);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: perform self test failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_check_time("self test", start, 360) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    start = a_stcc4_simulator_now();
+    res = stcc4_perform_factory_reset(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: perform factory reset failed.\n");
+        
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_stcc4_simulator_check_time("factory reset", start, 90) != 0)
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* a time mode switch keeps the us timestamp continuous */
+    {
+        uint32_t before;
+        uint32_t wall;
+        uint32_t back;
+        
+        before = stcc4_interface_timestamp_us();
+        stcc4_simulator_set_virtual_time((STCC4_SIMULATOR_VIRTUAL_TIME != 0) ? STCC4_BOOL_FALSE : STCC4_BOOL_TRUE);
+        wall = stcc4_interface_timestamp_us();
+        stcc4_simulator_set_virtual_time((STCC4_SIMULATOR_VIRTUAL_TIME != 0) ? STCC4_BOOL_TRUE : STCC4_BOOL_FALSE);
+        back = stcc4_interface_timestamp_us();
+        if (((int32_t)(wall - before) <= -1000) || ((int32_t)(wall - before) >= 10000) ||
+            ((int32_t)(back - wall) <= -1000) || ((int32_t)(back - wall) >= 10000))
+        {
+            stcc4_interface_debug_print("stcc4: timestamp jumps by %dus and %dus at the time mode switch.\n",
+                                        (int32_t)(wall - before), (int32_t)(back - wall));
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+        stcc4_interface_debug_print("stcc4: check time mode switch ok.\n");
+    }
+    
+    /* output */
+    stcc4_interface_debug_print("stcc4: %dms virtual time in %0.3fs wall time.\n", a_stcc4_simulator_now() - begin,
+                                (double)(stcc4_bench_test_ns() - wall) / 1e9);
+    
+    /* finish simulator test */
+    stcc4_interface_debug_print("stcc4: finish simulator test.\n");
+    (void)stcc4_deinit(&gs_handle);
+    
+    return 0;
+}
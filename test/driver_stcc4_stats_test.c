@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      test/driver_stcc4_stats_test.c
+ * @brief     driver stcc4 stats test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_stcc4_stats_test.h"
+
+static stcc4_handle_t gs_handle;        /**< stcc4 handle */
+static stcc4_stats_t gs_stats;          /**< stcc4 stats */
+
+/**
+ * @brief stcc4 stats command name definition
+ */
+static const char *const gs_command_name[STCC4_STATS_COMMAND_MAX] =
+{
+    "start continuous",
+    "stop continuous",
+    "read measurement",
+    "set rht",
+    "set pressure",
+    "single shot",
+    "enter sleep",
+    "exit sleep",
+    "conditioning",
+    "soft reset",
+    "factory reset",
+    "self test",
+    "enable testing",
+    "disable testing",
+    "forced recalibration",
+    "get product id",
+    "other",
+};
+
+/**
+ * @brief     check a command stats
+ * @param[in] command stats command
+ * @param[in] calls expected calls
+ * @param[in] bytes expected bus bytes
+ * @param[in] delay_us min delay time in us
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_stcc4_stats_check(stcc4_stats_command_t command, uint32_t calls, uint32_t bytes, uint64_t delay_us)
+{
+    stcc4_command_stats_t *stats;
+    
+    stats = &gs_stats.command[command];
+    if ((stats->calls != calls) || (stats->bus_bytes != bytes) || 
+        (stats->iic_errors != 0) || (stats->crc_errors != 0) || (stats->delay_us < delay_us))
+    {
+        stcc4_interface_debug_print("stcc4: %s stats check failed.\n", gs_command_name[command]);
+        
+        return 1;
+    }
+    stcc4_interface_debug_print("stcc4: %s stats check passed.\n", gs_command_name[command]);
+    
+    return 0;
+}
+
+/**
+ * @brief  print the stats table
+ * @note   none
+ */
+static void a_stcc4_stats_print(void)
+{
+    uint8_t i;
+    uint8_t j;
+    uint32_t count;
+    uint32_t half;
+    stcc4_command_stats_t *stats;
+    
+    for (i = 0; i < STCC4_STATS_COMMAND_MAX; i++)
+    {
+        stats = &gs_stats.command[i];
+        if (stats->calls == 0)
+        {
+            continue;
+        }
+        
+        /* find the median bucket */
+        count = 0;
+        half = (stats->calls + 1) / 2;
+        for (j = 0; j < STCC4_STATS_HISTOGRAM_SIZE; j++)
+        {
+            count += stats->histogram[j];
+            if (count >= half)
+            {
+                break;
+            }
+        }
+        stcc4_interface_debug_print("stcc4: %-20s calls %4d bytes %5d iic errors %d crc errors %d bus %8dus delay %9dus p50 < %dus.\n",
+                                    gs_command_name[i], stats->calls, stats->bus_bytes, stats->iic_errors, stats->crc_errors,
+                                    (uint32_t)stats->bus_us, (uint32_t)stats->delay_us, 1U << (j + 1));
+    }
+}
+
+/**
+ * @brief     stats test
+ * @param[in] address address pin
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      needs STCC4_INSTRUMENTATION
+ */
+uint8_t stcc4_stats_test(stcc4_address_t address, uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t product_id;
+    uint8_t unique_serial_number[8];
+    int16_t co2_raw;
+    int16_t co2_ppm;
+    uint16_t temperature_raw;
+    float temperature_s;
+    uint16_t humidity_raw;
+    float humidity_s;
+    uint16_t sensor_status;
+    
+    /* link functions */
+    DRIVER_STCC4_LINK_INIT(&gs_handle, stcc4_handle_t);
+    DRIVER_STCC4_LINK_IIC_INIT(&gs_handle, stcc4_interface_iic_init);
+    DRIVER_STCC4_LINK_IIC_DEINIT(&gs_handle, stcc4_interface_iic_deinit);
+    DRIVER_STCC4_LINK_IIC_WRITE_COMMAND(&gs_handle, stcc4_interface_iic_write_cmd);
+    DRIVER_STCC4_LINK_IIC_READ_COMMAND(&gs_handle, stcc4_interface_iic_read_cmd);
+    DRIVER_STCC4_LINK_DELAY_MS(&gs_handle, stcc4_interface_delay_ms);
+    DRIVER_STCC4_LINK_DEBUG_PRINT(&gs_handle, stcc4_interface_debug_print);
+    DRIVER_STCC4_LINK_TIMESTAMP_US(&gs_handle, stcc4_interface_timestamp_us);
+    
+    /* start stats test */
+    stcc4_interface_debug_print("stcc4: start stats test.\n");
+    
+    /* set address pin */
+    res = stcc4_set_address_pin(&gs_handle, address);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: set address pin failed.\n");
+        
+        return 1;
+    }
+    
+    /* stcc4 init */
+    res = stcc4_init(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* the init commands are counted */
+    res = stcc4_get_stats(&gs_handle, &gs_stats);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: get stats failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((a_stcc4_stats_check(STCC4_STATS_COMMAND_PERFORM_SOFT_RESET, 1, 1, 10000) != 0) ||
+        (a_stcc4_stats_check(STCC4_STATS_COMMAND_GET_PRODUCT_ID, 1, 2 + 18, 1000) != 0))
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* clear stats */
+    res = stcc4_clear_stats(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: clear stats failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* run the commands */
+    for (i = 0; i < times; i++)
+    {
+        res = stcc4_get_product_id(&gs_handle, &product_id, unique_serial_number);
+        if (res != 0)
+        {
+            stcc4_interface_debug_print("stcc4: get product id failed.\n");
+            (void)stcc4_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    res = stcc4_measure_single_shot(&gs_handle);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: measure single shot failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = stcc4_read(&gs_handle, &co2_raw, &co2_ppm, &temperature_raw, &temperature_s,
+                     &humidity_raw, &humidity_s, &sensor_status);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: read failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* check the stats */
+    res = stcc4_get_stats(&gs_handle, &gs_stats);
+    if (res != 0)
+    {
+        stcc4_interface_debug_print("stcc4: get stats failed.\n");
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((a_stcc4_stats_check(STCC4_STATS_COMMAND_GET_PRODUCT_ID, times, times * (2 + 18), times * 1000) != 0) ||
+        (a_stcc4_stats_check(STCC4_STATS_COMMAND_MEASURE_SINGLE_SHOT, 1, 2, 500000) != 0) ||
+        (a_stcc4_stats_check(STCC4_STATS_COMMAND_READ_MEASUREMENT, 1, 2 + 12, 1000) != 0) ||
+        (a_stcc4_stats_check(STCC4_STATS_COMMAND_PERFORM_SOFT_RESET, 0, 0, 0) != 0))
+    {
+        (void)stcc4_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_stcc4_stats_print();
+    
+    /* finish stats test */
+    stcc4_interface_debug_print("stcc4: finish stats test.\n");
+    (void)stcc4_deinit(&gs_handle);
+    
+    return 0;
+}